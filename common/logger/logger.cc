@@ -63,9 +63,224 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 using namespace ngcommon;
 
 
+/*
+ * Writes the log file from a background thread.
+ *
+ * Messages go through a bounded ring buffer where every cell has a sequence
+ * number telling whether it is free for the producer at a given position or
+ * holds the message the consumer expects there, so any number of threads log
+ * without taking a lock. The writer takes every queued message and does a
+ * single write and flush for all of them.
+ */
+class Logger::Log_writer
+{
+public:
+  Log_writer(std::ofstream &out, size_t capacity, Overflow_policy policy)
+    : _out(out), _policy(policy), _enqueue_pos(0), _dequeue_pos(0), _written(0), _dropped(0),
+      _reported_drops(0), _sleeping(false), _stop(false)
+  {
+    size_t size = 2;
+    while (size < capacity)
+      size <<= 1;
+
+    _mask = size - 1;
+    _cells = std::vector<Cell>(size);
+    for (size_t index = 0; index < size; index++)
+      _cells[index].sequence.store(index, std::memory_order_relaxed);
+
+    _thread = std::thread(&Log_writer::run, this);
+  }
+
+  ~Log_writer()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _wake.notify_one();
+    _thread.join();
+  }
+
+  void push(std::string &message)
+  {
+    while (!try_push(message))
+    {
+      if (_policy != OVERFLOW_BLOCK)
+      {
+        _dropped++;
+        return;
+      }
+
+      wake_writer();
+      std::unique_lock<std::mutex> lock(_mutex);
+      _progress.wait_for(lock, std::chrono::milliseconds(10));
+    }
+
+    // Otherwise the writer finds the message on its next round, so logging
+    // does not wake it up on every message
+    if (_sleeping.load() && _enqueue_pos.load() - _written.load() > _mask / 2)
+      wake_writer();
+  }
+
+  void flush()
+  {
+    // The writer takes the messages in the order their cells were reserved
+    size_t target = _enqueue_pos.load();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_written.load() < target && !_stop)
+    {
+      _wake.notify_one();
+      _progress.wait_for(lock, std::chrono::milliseconds(10));
+    }
+  }
+
+  unsigned long long dropped() const
+  {
+    return _dropped.load();
+  }
+
+private:
+  struct Cell
+  {
+    Cell() : sequence(0) {}
+    Cell(const Cell &) : sequence(0) {}
+
+    std::atomic<size_t> sequence;
+    std::string message;
+  };
+
+  // Messages written at most on each write, so producers waiting for room
+  // are woken up soon
+  static const size_t k_max_batch = 1024;
+  // How long queued messages may wait to be written when nobody waits for them
+  static const int k_idle_wait_ms = 50;
+
+  std::ofstream &_out;
+  Overflow_policy _policy;
+  std::vector<Cell> _cells;
+  size_t _mask;
+
+  std::atomic<size_t> _enqueue_pos;
+  size_t _dequeue_pos;
+  std::atomic<size_t> _written;
+  std::atomic<unsigned long long> _dropped;
+  unsigned long long _reported_drops;
+
+  std::mutex _mutex;
+  std::condition_variable _wake;
+  std::condition_variable _progress;
+  std::atomic<bool> _sleeping;
+  bool _stop;
+  std::thread _thread;
+
+  bool try_push(std::string &message)
+  {
+    size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;)
+    {
+      cell = &_cells[pos & _mask];
+      size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      if (sequence == pos)
+      {
+        if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      }
+      else if (sequence < pos)
+        return false;  // full, the cell still has the message of the previous round
+      else
+        pos = _enqueue_pos.load(std::memory_order_relaxed);
+    }
+
+    cell->message.swap(message);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Only the writer thread takes messages
+  bool try_pop(std::string *batch)
+  {
+    Cell *cell = &_cells[_dequeue_pos & _mask];
+    if (cell->sequence.load(std::memory_order_acquire) != _dequeue_pos + 1)
+      return false;
+
+    batch->append(cell->message);
+    cell->message.clear();
+    cell->sequence.store(_dequeue_pos + _mask + 1, std::memory_order_release);
+    _dequeue_pos++;
+    return true;
+  }
+
+  void wake_writer()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _wake.notify_one();
+  }
+
+  void run()
+  {
+    std::string batch;
+    batch.reserve(64 * 1024);
+
+    for (;;)
+    {
+      size_t count = 0;
+      while (count < k_max_batch && try_pop(&batch))
+        count++;
+
+      unsigned long long dropped = _dropped.load();
+      if (_policy == OVERFLOW_COUNT && dropped != _reported_drops)
+      {
+        batch += format_message(NULL, format("%llu log messages were discarded, the log queue was full",
+                                             dropped - _reported_drops).c_str(), LOG_WARNING);
+        batch += "\n";
+        _reported_drops = dropped;
+      }
+
+      if (!batch.empty())
+      {
+        _out.write(batch.data(), (std::streamsize)batch.size());
+        _out.flush();
+        batch.clear();
+      }
+
+      if (count)
+      {
+        _written += count;
+        std::lock_guard<std::mutex> lock(_mutex);
+        _progress.notify_all();
+        continue;
+      }
+
+      // Producers check _sleeping after publishing their message, so if the
+      // queue fills up meanwhile they wake the writer up
+      std::unique_lock<std::mutex> lock(_mutex);
+      _sleeping.store(true);
+      Cell *cell = &_cells[_dequeue_pos & _mask];
+      bool empty = cell->sequence.load(std::memory_order_acquire) != _dequeue_pos + 1;
+      if (empty && _stop)
+        break;
+      if (empty)
+        _wake.wait_for(lock, std::chrono::milliseconds(k_idle_wait_ms));
+      _sleeping.store(false);
+    }
+
+    _progress.notify_all();
+  }
+};
+
+
 Logger* Logger::instance = NULL;
 
 Logger::Logger_levels_table Logger::log_levels_table;
@@ -97,6 +312,53 @@ void Logger::detach_log_hook(Log_hook hook)
 }
 
 
+void Logger::start_async_writer(size_t capacity, Overflow_policy policy)
+{
+  if (writer || !out.is_open())
+    return;
+
+  writer = new Log_writer(out, capacity, policy);
+
+  // The instance is never destroyed, the queued messages are written when
+  // the process exits
+  static bool flush_registered = false;
+  if (!flush_registered)
+  {
+    flush_registered = true;
+    atexit(flush_at_exit);
+  }
+}
+
+
+void Logger::stop_async_writer()
+{
+  delete writer;
+  writer = NULL;
+}
+
+
+void Logger::flush()
+{
+  if (writer)
+    writer->flush();
+  else if (out.is_open())
+    out.flush();
+}
+
+
+unsigned long long Logger::get_dropped_messages()
+{
+  return writer ? writer->dropped() : 0;
+}
+
+
+void Logger::flush_at_exit()
+{
+  if (instance)
+    instance->flush();
+}
+
+
 void Logger::set_log_level(LOG_LEVEL log_level_)
 {
   this->log_level = log_level_;
@@ -146,28 +408,41 @@ std::string Logger::format(const char* formats, ...)
 }
 
 
-void Logger::log_text(LOG_LEVEL level, const char* domain, const char* text)
+void Logger::out_message(LOG_LEVEL level, const char* domain, const char* message)
 {
-  assert_logger_initialized();
+  std::string s = format_message(domain, message, level);
+  s += "\n";
 
-  if (instance && level <= instance->log_level)
+  if (instance->use_stderr)
   {
-    std::string s = instance->format_message(domain, text, level);
-    s += "\n";
-    const char* buf = s.c_str();
+    instance->out_to_stderr(s.c_str());
+  }
 
-    instance->out.write(buf, (std::streamsize)strlen(buf));
+  std::list<Log_hook>::const_iterator myend = instance->hook_list.end();
+  for (std::list<Log_hook>::const_iterator it = instance->hook_list.begin(); it != myend; it++)
+    (*it)(s.c_str(), level, domain);
+
+  if (instance->writer)
+  {
+    // Takes the message, s is left empty
+    instance->writer->push(s);
+    if (level <= LOG_ERROR)
+      instance->writer->flush();
+  }
+  else
+  {
+    instance->out.write(s.data(), (std::streamsize)s.size());
     instance->out.flush();
+  }
+}
 
-    if (instance->use_stderr)
-    {
-      instance->out_to_stderr(buf);
-    }
 
-    std::list<Log_hook>::const_iterator myend = instance->hook_list.end();
-    for (std::list<Log_hook>::const_iterator it = instance->hook_list.begin(); it != myend; it++)
-      (*it)(buf, level, domain);
-  }
+void Logger::log_text(LOG_LEVEL level, const char* domain, const char* text)
+{
+  assert_logger_initialized();
+
+  if (instance && level <= instance->log_level)
+    out_message(level, domain, text);
 }
 
 
@@ -177,37 +452,32 @@ void Logger::log(LOG_LEVEL level, const char* domain, const char* formats, ...)
 
   if (instance && level <= instance->log_level)
   {
-    char *mybuf;
+    // Most messages fit, so they are formatted without sizing them first
+    char buffer[1024];
     va_list args;
     va_start(args, formats);
-#ifdef WIN32
-    int n = _vscprintf(formats, args);
-#else
-    size_t n = (size_t)vsnprintf(NULL, 0, formats, args);
-#endif
-    va_end(args);
-
-    mybuf = (char*)malloc(n + 1);
-    va_start(args, formats);
-    vsnprintf(mybuf, n + 1, formats, args);
+    int n = vsnprintf(buffer, sizeof(buffer), formats, args);
     va_end(args);
-    std::string s = instance->format_message(domain, mybuf, level);
-    s += "\n";
-    const char* buf = s.c_str();
-
-    instance->out.write(buf, (std::streamsize)strlen(buf));
-    instance->out.flush();
 
-    if (instance->use_stderr)
+    if (n >= 0 && (size_t)n < sizeof(buffer))
     {
-      instance->out_to_stderr(buf);
+      out_message(level, domain, buffer);
     }
+    else
+    {
+#ifdef WIN32
+      va_start(args, formats);
+      n = _vscprintf(formats, args);
+      va_end(args);
+#endif
+      std::string mybuf;
+      mybuf.resize((size_t)n + 1);
+      va_start(args, formats);
+      vsnprintf(&mybuf[0], (size_t)n + 1, formats, args);
+      va_end(args);
 
-    std::list<Log_hook>::const_iterator myend = instance->hook_list.end();
-    for (std::list<Log_hook>::const_iterator it = instance->hook_list.begin(); it != myend; it++)
-      (*it)(buf, level, domain);
-
-    free(mybuf);
+      out_message(level, domain, mybuf.c_str());
+    }
   }
 }
 
@@ -324,6 +594,7 @@ void Logger::create_instance(const char *filename, bool use_stderr, Logger::LOG_
 
 
 Logger::Logger(const char *filename, bool use_stderr_, Logger::LOG_LEVEL log_level_)
+  : writer(NULL)
 {
   this->use_stderr = use_stderr_;
   this->log_level = log_level_;
@@ -338,6 +609,7 @@ Logger::Logger(const char *filename, bool use_stderr_, Logger::LOG_LEVEL log_lev
 
 Logger::~Logger()
 {
+  stop_async_writer();
   if (out.is_open())
     out.close();
 }
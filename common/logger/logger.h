@@ -79,6 +79,27 @@ public:
   void set_log_level(LOG_LEVEL log_level);
   LOG_LEVEL get_log_level();
 
+  // What to do with a message when the async writer queue is full
+  enum Overflow_policy
+  {
+    OVERFLOW_BLOCK = 1,  // wait until the writer makes room
+    OVERFLOW_DROP = 2,   // discard the message
+    OVERFLOW_COUNT = 3   // discard the message, the writer logs how many were discarded
+  };
+
+  // Messages are queued and written to the log file in batches by a background
+  // thread, instead of writing and flushing the file on every call. Errors are
+  // still on the file when the log call returns. Hooks and stderr output are
+  // not affected
+  static const size_t ASYNC_WRITER_CAPACITY = 8192;
+  void start_async_writer(size_t capacity = ASYNC_WRITER_CAPACITY, Overflow_policy policy = OVERFLOW_BLOCK);
+  // Writes the queued messages and goes back to synchronous writes, no other
+  // thread may be logging meanwhile
+  void stop_async_writer();
+  // Waits until the queued messages are written
+  void flush();
+  unsigned long long get_dropped_messages();
+
 #if __GNUC__ > 2 || (__GNUC__ == 2 && __GNUC_MINOR__ > 4)
   static void log(LOG_LEVEL level, const char* domain, const char* format, ...) __attribute__((__format__(__printf__, 3, 4)));
   static std::string format(const char* formats, ...) __attribute__((__format__(__printf__, 1, 2)));
@@ -157,6 +178,10 @@ private:
   static std::string format_message_common(const char* domain, const char* message, Logger::LOG_LEVEL log_level);
   static const char* get_log_level_desc(LOG_LEVEL log_level);
   static void assert_logger_initialized();
+  static void out_message(LOG_LEVEL level, const char* domain, const char* message);
+  static void flush_at_exit();
+
+  class Log_writer;
 
   static Logger* instance;
   static struct Logger_levels_table log_levels_table;
@@ -165,6 +190,7 @@ private:
   bool use_stderr;
   std::ofstream out;
   std::list<Log_hook> hook_list;
+  Log_writer *writer;
 
   friend class tests::LoggerTestProxy;
 };
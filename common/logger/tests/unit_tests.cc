@@ -16,8 +16,13 @@
 
 
 #include <cctype>
+#include <chrono>
+#include <cstdio>
 #include <fstream>
+#include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "logger.h"
 #include "gtest/gtest.h"
@@ -202,5 +207,113 @@ namespace tests
     }
   }
 
+  size_t count_lines(const std::string &contents, const char *text)
+  {
+    size_t count = 0;
+    for (size_t idx = contents.find(text); idx != std::string::npos; idx = contents.find(text, idx + 1))
+      count++;
+    return count;
+  }
+
+  TEST(Logger, async_writer)
+  {
+    const std::string* filename = get_path("myasynclog.txt");
+    std::remove(filename->c_str());
+    Logger::create_instance(filename->c_str(), false, Logger::LOG_DEBUG);
+
+    Logger *l= Logger::singleton();
+    l->start_async_writer(64, Logger::OVERFLOW_BLOCK);
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; thread++)
+    {
+      threads.push_back(std::thread([thread]()
+      {
+        for (int index = 0; index < 1000; index++)
+          Logger::log(Logger::LOG_DEBUG, "Unit Test Domain", "Async message %d from %d", index, thread);
+      }));
+    }
+    for (std::vector<std::thread>::iterator thread = threads.begin(); thread != threads.end(); ++thread)
+      thread->join();
+
+    // Errors are written before the call returns
+    l->log(Logger::LOG_ERROR, "Unit Test Domain", "Async error");
+    const std::string* contents = get_file_contents("myasynclog.txt");
+
+    EXPECT_EQ(4000u, count_lines(*contents, ": Debug: Unit Test Domain: Async message "));
+    EXPECT_EQ(1u, count_lines(*contents, ": Error: Unit Test Domain: Async error\n"));
+    EXPECT_EQ(1u, count_lines(*contents, "Async message 999 from 3\n"));
+    EXPECT_EQ(0u, l->get_dropped_messages());
+    delete contents;
+
+    l->stop_async_writer();
+    l->log(Logger::LOG_DEBUG, "Unit Test Domain", "Sync message");
+    contents = get_file_contents("myasynclog.txt");
+    EXPECT_EQ(1u, count_lines(*contents, "Sync message\n"));
+
+    delete filename;
+    delete contents;
+  }
+
+  TEST(Logger, async_writer_overflow)
+  {
+    const std::string* filename = get_path("myasynclog.txt");
+    std::remove(filename->c_str());
+    Logger::create_instance(filename->c_str(), false, Logger::LOG_DEBUG);
+
+    Logger *l= Logger::singleton();
+    l->start_async_writer(2, Logger::OVERFLOW_COUNT);
+
+    for (int index = 0; index < 10000; index++)
+      l->log(Logger::LOG_DEBUG, "Unit Test Domain", "Overflow message %d", index);
+    l->flush();
+    unsigned long long dropped = l->get_dropped_messages();
+    l->stop_async_writer();
+
+    // Every message is either written or counted as discarded
+    const std::string* contents = get_file_contents("myasynclog.txt");
+    EXPECT_EQ(10000u, count_lines(*contents, "Overflow message ") + dropped);
+    if (dropped)
+    {
+      EXPECT_NE(std::string::npos, contents->find(" log messages were discarded, the log queue was full\n"));
+    }
+
+    delete filename;
+    delete contents;
+  }
+
+  // Messages/sec logged at debug level, writing and flushing the file on
+  // every message against the async writer. Only prints the rates, run it
+  // with --gtest_also_run_disabled_tests
+  TEST(Logger, DISABLED_async_writer_performance)
+  {
+    const int count = 100000;
+    const std::string* filename = get_path("myasynclog.txt");
+    std::remove(filename->c_str());
+    Logger::create_instance(filename->c_str(), false, Logger::LOG_DEBUG);
+    Logger *l= Logger::singleton();
+
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    for (int index = 0; index < count; index++)
+      l->log(Logger::LOG_DEBUG, "Unit Test Domain", "SELECT * FROM mysql_innodb_cluster_metadata.instances WHERE instance_id = %d", index);
+    double sync_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    l->start_async_writer();
+    start = std::chrono::high_resolution_clock::now();
+    for (int index = 0; index < count; index++)
+      l->log(Logger::LOG_DEBUG, "Unit Test Domain", "SELECT * FROM mysql_innodb_cluster_metadata.instances WHERE instance_id = %d", index);
+    double async_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    l->stop_async_writer();
+
+    std::cout << "sync: " << static_cast<unsigned long long>(count / sync_seconds) << " messages/sec" << std::endl;
+    std::cout << "async: " << static_cast<unsigned long long>(count / async_seconds) << " messages/sec" << std::endl;
+
+    const std::string* contents = get_file_contents("myasynclog.txt");
+    EXPECT_EQ(2u * count, count_lines(*contents, "WHERE instance_id = "));
+
+    delete filename;
+    delete contents;
+  }
+
 } // namespace tests
 } // namespace ngcommon
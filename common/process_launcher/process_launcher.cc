@@ -17,6 +17,8 @@
 #include "exception.h"
 
 #include <boost/format.hpp>
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <system_error>
 
@@ -165,11 +167,40 @@ void Process_launcher::close() {
   is_alive = false;
 }
 
+int Process_launcher::finish(int timeout_ms) {
+  // Closing our end of stdout too, a child blocked writing to a full pipe
+  // gets an error instead of waiting for a read that will not come
+  if (!CloseHandle(child_in_wr))
+    report_error(NULL);
+  if (!CloseHandle(child_out_rd))
+    report_error(NULL);
+
+  if (WaitForSingleObject(pi.hProcess, timeout_ms) == WAIT_TIMEOUT) {
+    if (!TerminateProcess(pi.hProcess, 128 + 9))
+      report_error(NULL);
+    // TerminateProcess is async, wait for process to end.
+    WaitForSingleObject(pi.hProcess, INFINITE);
+  }
+
+  DWORD dwExit = wait();
+  is_alive = false;
+
+  if (!CloseHandle(pi.hProcess))
+    report_error(NULL);
+  if (!CloseHandle(pi.hThread))
+    report_error(NULL);
+
+  return dwExit;
+}
+
 int Process_launcher::read_one_char() {
   char buf[1];
   BOOL bSuccess = FALSE;
   DWORD dwBytesRead, dwCode;
 
+  if (read_position < read_buffer.size())
+    return read_buffer[read_position++];
+
   while (!(bSuccess = ReadFile(child_out_rd, buf, 1, &dwBytesRead, NULL))) {
     dwCode = GetLastError();
     if (dwCode == ERROR_NO_DATA) continue;
@@ -182,7 +213,7 @@ int Process_launcher::read_one_char() {
   return buf[0];
 }
 
-int Process_launcher::read(char *buf, size_t count) {
+int Process_launcher::read_pipe(char *buf, size_t count) {
   BOOL bSuccess = FALSE;
   DWORD dwBytesRead, dwCode;
   int i = 0;
@@ -374,9 +405,53 @@ void Process_launcher::close()
   is_alive = false;
 }
 
+int Process_launcher::finish(int timeout_ms)
+{
+  int status = 0;
+  pid_t ret;
+
+  // Closing our end of stdout too, a child blocked writing to a full pipe
+  // gets EPIPE instead of waiting for a read that will not come
+  ::close(fd_in[1]);
+  ::close(fd_out[0]);
+  is_alive = false;
+
+  for(int waited = 0;; waited += 10)
+  {
+    ret = ::waitpid(childpid, &status, WNOHANG);
+    if(ret != 0 && !(ret == -1 && errno == EINTR))
+      break;
+
+    if(waited >= timeout_ms)
+    {
+      ::kill(childpid, SIGKILL);
+      do
+      {
+        ret = ::waitpid(childpid, &status, 0);
+      }
+      while(ret == -1 && errno == EINTR);
+      break;
+    }
+    usleep(10000);
+  }
+
+  // ECHILD when wait() already reaped it, the exit code was given there
+  if(ret == -1)
+  {
+    if(errno != ECHILD)
+      report_error(NULL);
+    return 0;
+  }
+
+  return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
 int Process_launcher::read_one_char()
 {
   int c;
+  if (read_position < read_buffer.size())
+    return read_buffer[read_position++];
+
   do
   {
     if((c = ::read(fd_out[0], &c, 1)) >= 0)
@@ -389,7 +464,7 @@ int Process_launcher::read_one_char()
   return -1;
 }
 
-int Process_launcher::read(char *buf, size_t count)
+int Process_launcher::read_pipe(char *buf, size_t count)
 {
   int n;
   do {
@@ -460,7 +535,8 @@ int Process_launcher::wait()
 
   do
   {
-    ret = ::wait(&status);
+    // Other child processes may be running, like a long lived one
+    ret = ::waitpid(childpid, &status, 0);
     exited = WIFEXITED(status);
     exitstatus = WEXITSTATUS(status);
     if(ret == -1)
@@ -492,3 +568,121 @@ uint64_t Process_launcher::get_fd_read()
 void Process_launcher::kill() {
   close();
 }
+
+int Process_launcher::read(char *buf, size_t count) {
+  if (read_position < read_buffer.size()) {
+    size_t size = std::min(count, read_buffer.size() - read_position);
+    memcpy(buf, read_buffer.data() + read_position, size);
+    read_position += size;
+    return static_cast<int>(size);
+  }
+
+  return read_pipe(buf, count);
+}
+
+size_t Process_launcher::fill_read_buffer() {
+  // The size of a pipe buffer on most systems
+  static const size_t block_size = 4096;
+
+  if (read_position == read_buffer.size()) {
+    read_buffer.resize(block_size);
+    int size = read_pipe(&read_buffer[0], block_size);
+    read_buffer.resize(size > 0 ? size : 0);
+    read_position = 0;
+  }
+
+  return read_buffer.size() - read_position;
+}
+
+bool Process_launcher::read_line(std::string *line) {
+  line->clear();
+
+  size_t available;
+  while ((available = fill_read_buffer()) > 0) {
+    const char *start = read_buffer.data() + read_position;
+    const char *end = static_cast<const char *>(memchr(start, '\n', available));
+    size_t size = end ? end - start + 1 : available;
+
+    line->append(start, size);
+    read_position += size;
+
+    if (end)
+      return true;
+  }
+
+  return !line->empty();
+}
+
+size_t Process_launcher::read_available(std::string *data) {
+  size_t available = fill_read_buffer();
+
+  data->append(read_buffer, read_position, available);
+  read_position += available;
+
+  return available;
+}
+
+void Json_record_splitter::append(const char *data, size_t size) {
+  const char *end = data + size;
+
+  // The text before the first record is kept apart
+  if (!started) {
+    const char *open = static_cast<const char *>(memchr(data, '{', size));
+    if (!open) {
+      preamble.append(data, size);
+      return;
+    }
+
+    preamble.append(data, open - data);
+    started = true;
+    data = open;
+  }
+
+  while (data < end) {
+    const char *newline = static_cast<const char *>(memchr(data, '\n', end - data));
+    const char *line_end = newline ? newline : end;
+
+    // A line closes the record if its last character other than '\r' is '}'
+    for (const char *c = line_end; c > data; --c) {
+      if (*(c - 1) != '\r') {
+        last_closed = *(c - 1) == '}';
+        break;
+      }
+    }
+
+    buffer.append(data, line_end - data);
+    if (!newline)
+      break;
+
+    if (last_closed) {
+      records.push_back(std::string());
+      records.back().swap(buffer);
+      last_closed = false;
+    } else {
+      buffer.push_back('\n');
+    }
+
+    data = newline + 1;
+  }
+}
+
+bool Json_record_splitter::next_record(std::string *record) {
+  if (records.empty())
+    return false;
+
+  record->swap(records.front());
+  records.pop_front();
+
+  return true;
+}
+
+bool Json_record_splitter::take_preamble(std::string *text) {
+  if (!started || preamble_taken)
+    return false;
+
+  preamble_taken = true;
+  text->assign(preamble);
+  preamble.clear();
+
+  return !text->empty();
+}
@@ -27,6 +27,8 @@
 //#  include <poll.h>
 #endif
 #include <stdint.h>
+#include <deque>
+#include <string>
 
 namespace ngcommon {
 // Launches a process as child of current process and exposes the stdin & stdout of the child process
@@ -47,7 +49,7 @@ public:
    * Argument 'args' must have a last entry that is NULL.
    * If redirect_stderr is true, the child's stderr is redirected to the same stream than child's stdout.
    */
-  Process_launcher(const char *cmd_line, const char ** args, bool redirect_stderr = true) : is_alive(false) {
+  Process_launcher(const char *cmd_line, const char ** args, bool redirect_stderr = true) : is_alive(false), read_position(0) {
     this->cmd_line = cmd_line;
     this->args = args;
     this->redirect_stderr = redirect_stderr;
@@ -74,6 +76,26 @@ public:
    */
   int read(char *buf, size_t count);
 
+  /**
+   * Reads the next line from the stdout of the child process, including its
+   * terminator, the last line may come without it.
+   * The output is read in blocks into an internal buffer instead of a byte
+   * at a time, the other read functions take the buffered output first.
+   * @param line where the line is stored, replacing its content.
+   * @return false once the whole output was read.
+   * Throws an exception in case of error when reading.
+   */
+  bool read_line(std::string *line);
+
+  /**
+   * Reads the output available: the one already buffered or, if there is
+   * none, the one returned by a single read from the child process.
+   * @param data where the output is appended.
+   * @return the number of bytes read, 0 once the whole output was read.
+   * Throws an exception in case of error when reading.
+   */
+  size_t read_available(std::string *data);
+
   /**
    * Write into stdin of child process.
    * Returns an shcore::Exception in case of error when writing.
@@ -91,6 +113,15 @@ public:
    */
   void kill();
 
+  /**
+   * Closes the stdin and stdout of the child process and waits for it to
+   * exit, for the programs ending on end of input. Unlike kill(), the child
+   * process is not signaled, so it does not matter if wait() already reaped
+   * it, unless it is still running after timeout_ms: then it is killed.
+   * Returns the exit code of the process, 0 if wait() already returned it.
+   */
+  int finish(int timeout_ms = 5000);
+
   /**
    * Returns the child process handle.
    * In Linux this needs to be cast to pid_t, in Windows to cast to HANDLE.
@@ -125,6 +156,15 @@ private:
   /** Closes child process */
   void close();
 
+  /** Reads from the child's stdout, without going through the read buffer */
+  int read_pipe(char *buf, size_t count);
+
+  /**
+   * Reads a block of output into the read buffer if all the buffered output
+   * was taken, returns the size of the output left on the buffer.
+   */
+  size_t fill_read_buffer();
+
   const char *cmd_line;
   const char **args;
   bool is_alive;
@@ -142,6 +182,52 @@ private:
   //  struct pollfd _s_pollfd[2];
 #endif
   bool redirect_stderr;
+
+  // Output read from the child's stdout not taken yet, from read_position
+  std::string read_buffer;
+  size_t read_position;
+};
+
+/**
+ * Splits the output of a child process logging JSON records, like
+ * mysqlprovision, as it is read.
+ *
+ * A record starts with the first '{' and ends with a line that ends with
+ * '}', so a record can take several lines. The text found before the first
+ * record, usually prompts, is the preamble.
+ */
+class Json_record_splitter {
+public:
+  Json_record_splitter() : started(false), preamble_taken(false), last_closed(false) {}
+
+  /** Adds output of the child process, in chunks of any size */
+  void append(const char *data, size_t size);
+
+  /**
+   * Takes the next complete record, without the line terminator.
+   * Returns false if there is none.
+   */
+  bool next_record(std::string *record);
+
+  /**
+   * Takes the preamble once the first record started.
+   * Returns false if it is empty, already taken or not complete yet.
+   */
+  bool take_preamble(std::string *text);
+
+  /**
+   * The output not split yet: the incomplete record or, if no record was
+   * found, the whole output. To be used once the output ended.
+   */
+  const std::string &remaining() const { return started ? buffer : preamble; }
+
+private:
+  bool started;
+  bool preamble_taken;
+  bool last_closed;
+  std::string preamble;
+  std::string buffer;
+  std::deque<std::string> records;
 };
 }  // namespace ngcommon
 
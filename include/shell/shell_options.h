@@ -25,6 +25,9 @@
 #include "shellcore/ishell_core.h"
 #include "utils/utils_connection.h"
 
+// Statements sent ahead of their results when --pipeline has no value
+#define DEFAULT_PIPELINE_SIZE 100
+
 namespace mysqlsh {
 struct SHCORE_PUBLIC Shell_options {
 public:
@@ -56,6 +59,7 @@ public:
   bool print_cmd_line_helper;
   bool print_version;
   bool force;
+  int pipeline_size;
   bool interactive;
   bool full_interactive;
   bool passwords_from_stdin;
@@ -66,6 +70,7 @@ public:
   std::string execute_statement;
   std::string execute_dba_statement;
   ngcommon::Logger::LOG_LEVEL log_level;
+  ngcommon::Logger::Overflow_policy log_overflow;
   bool wizards;
   bool admin_mode;
 
@@ -51,6 +51,7 @@ public:
 public:
   static Object_bridge_ref create(const shcore::Argument_list &args);
   static Object_bridge_ref unrepr(const std::string &s);
+  static Object_bridge_ref unrepr(const char *data, size_t length);
   static Object_bridge_ref from_ms(int64_t ms_since_epoch);
 
 private:
@@ -96,6 +96,9 @@ public:
   virtual void abort() = 0;
   virtual bool is_module(const std::string& UNUSED(file_name)) { return false; }
   virtual void execute_module(const std::string& UNUSED(file_name), std::function<void(shcore::Value)> UNUSED(result_processor)) { /* Does Nothing by default*/ }
+  // Called once a stream was completely handled, to process anything the
+  // language left pending
+  virtual void finish_input(std::function<void(shcore::Value)> UNUSED(result_processor)) { /* Does Nothing by default*/ }
 protected:
   bool _killed;
   IShell_core *_owner;
@@ -27,6 +27,12 @@
 #define SHCORE_SHOW_WARNINGS "showWarnings"
 #define SHCORE_BATCH_CONTINUE_ON_ERROR "batchContinueOnError"
 #define SHCORE_USE_WIZARDS "useWizards"
+// Number of SQL statements sent ahead of their results when running SQL in
+// batch mode over an X Protocol session, 0 disables pipelining
+#define SHCORE_BATCH_PIPELINE_SIZE "batchPipelineSize"
+// When enabled, results printed on the scripting modes are streamed instead of
+// buffered, so their records are no longer available once printed
+#define SHCORE_OUTPUT_STREAMING "outputStreaming"
 // This option controls the management of globals/locals namespace when running python scripts
 // ie. if several runs of Python scripts inside shell must be considered part of the same instance.
 #define SHCORE_MULTIPLE_INSTANCES "multipleInstances"
@@ -36,6 +42,14 @@
 
 #define SHCORE_SANDBOX_DIR "sandboxDir"
 
+// AdminAPI: seconds the metadata read by cluster.status() and describe() is
+// reused by the next calls, 0 reads it on every call
+#define SHCORE_METADATA_CACHE_TTL "metadataCacheTtl"
+
+// AdminAPI: runs the mysqlprovision commands on a single process started
+// on first use instead of starting a new one for each command
+#define SHCORE_PROVISIONING_WORKER "provisioningWorker"
+
 namespace shcore {
 class SHCORE_PUBLIC  Shell_core_options :public shcore::Cpp_object_bridge {
 public:
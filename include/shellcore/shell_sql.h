@@ -25,8 +25,19 @@
 #include "shellcore/common.h"
 #include "../utils/utils_mysql_parsing.h"
 #include <boost/system/error_code.hpp>
+#include <deque>
 #include <stack>
 
+namespace mysqlx {
+class Result;
+}
+
+namespace mysqlsh {
+namespace mysqlx {
+class BaseSession;
+}
+}
+
 namespace shcore {
 class SHCORE_PUBLIC Shell_sql : public Shell_language {
 public:
@@ -42,17 +53,37 @@ public:
   virtual bool print_help(const std::string& topic);
   void print_exception(const shcore::Exception &e);
   virtual void abort();
+  virtual void finish_input(std::function<void(shcore::Value)> result_processor);
 
 private:
+  // Statement sent on the pipeline whose result was not processed yet
+  struct Pipelined_statement {
+    std::string statement;
+    mysql::splitter::Delimiters::delim_type_t delimiter;
+    std::shared_ptr<mysqlsh::mysqlx::BaseSession> session;
+    std::shared_ptr< ::mysqlx::Result> result;
+    size_t index;
+  };
+
   std::string _sql_cache;
   mysql::splitter::Delimiters _delimiters;
   std::stack<std::string> _parsing_context_stack;
+  std::deque<Pipelined_statement> _pipeline;
+  size_t _pipelined_count;
+  size_t _pipelined_bytes;
+  bool _pipeline_failed;
 
   Value process_sql(const std::string &query_str,
       mysql::splitter::Delimiters::delim_type_t delimiter,
       std::shared_ptr<mysqlsh::ShellDevelopmentSession> session,
       std::function<void(shcore::Value)> result_processor);
 
+  void print_result(Value result,
+      mysql::splitter::Delimiters::delim_type_t delimiter,
+      std::function<void(shcore::Value)> result_processor);
+  size_t pipeline_size() const;
+  void process_pipelined(std::function<void(shcore::Value)> result_processor);
+
   void cmd_process_file(const std::vector<std::string>& params);
 };
 };
@@ -141,23 +141,32 @@ struct SHCORE_PUBLIC Value {
   typedef std::shared_ptr<Map_type> Map_type_ref;
 
   Value_type type;
-  union {
+
+  // The active member is selected by type and is constructed in place, so
+  // strings short enough for the std::string inline buffer and container
+  // references need no allocation of their own
+  union Storage {
     bool b;
-    std::string *s;
+    std::string s;
     int64_t i;
     uint64_t ui;
     double d;
-    std::shared_ptr<class Object_bridge> *o;
-    std::shared_ptr<Array_type> *array;
-    std::shared_ptr<Map_type> *map;
-    std::weak_ptr<Map_type> *mapref;
-    std::shared_ptr<class Function_base> *func;
+    std::shared_ptr<class Object_bridge> o;
+    std::shared_ptr<Array_type> array;
+    std::shared_ptr<Map_type> map;
+    std::weak_ptr<Map_type> mapref;
+    std::shared_ptr<class Function_base> func;
+
+    Storage() {}
+    ~Storage() {}
   } value;
 
   Value() : type(Undefined) {}
   Value(const Value &copy);
+  Value(Value &&other);
 
   explicit Value(const std::string &s);
+  explicit Value(std::string &&s);
   explicit Value(const char *);
   explicit Value(const char *, size_t n);
   explicit Value(int i);
@@ -186,10 +195,13 @@ struct SHCORE_PUBLIC Value {
 
   //! parse a string returned by repr() back into a Value
   static Value parse(const std::string &s);
+  //! same as above, for data that is not NUL terminated, i.e. a row field
+  static Value parse(const char *data, size_t length);
 
   ~Value();
 
   Value &operator= (const Value &other);
+  Value &operator= (Value &&other);
 
   bool operator == (const Value &other) const;
 
@@ -218,15 +230,23 @@ struct SHCORE_PUBLIC Value {
   int64_t as_int() const;
   uint64_t as_uint() const;
   double as_double() const;
-  const std::string &as_string() const { check_type(String); return *value.s; }
+  const std::string &as_string() const { check_type(String); return value.s; }
   template<class C>
-  std::shared_ptr<C> as_object() const { check_type(Object); return std::dynamic_pointer_cast<C>(*value.o); }
-  std::shared_ptr<Object_bridge> as_object() const { check_type(Object); return std::dynamic_pointer_cast<Object_bridge>(*value.o); }
-  std::shared_ptr<Map_type> as_map() const { check_type(Map); return *value.map; }
-  std::shared_ptr<Array_type> as_array() const { check_type(Array); return *value.array; }
-  std::shared_ptr<Function_base> as_function() const { check_type(Function); return std::dynamic_pointer_cast<Function_base>(*value.func); }
+  std::shared_ptr<C> as_object() const { check_type(Object); return std::dynamic_pointer_cast<C>(value.o); }
+  std::shared_ptr<Object_bridge> as_object() const { check_type(Object); return value.o; }
+  std::shared_ptr<Map_type> as_map() const { check_type(Map); return value.map; }
+  std::shared_ptr<Array_type> as_array() const { check_type(Array); return value.array; }
+  std::shared_ptr<Function_base> as_function() const { check_type(Function); return value.func; }
 
 private:
+  // Constructs the storage for the type of other, which is left untouched
+  // on copy and Undefined on move
+  void copy_from(const Value &other);
+  void move_from(Value &other);
+
+  // Destroys the storage of the current type
+  void release();
+
   static Value parse(char **pc);
   static Value parse_map(char **pc);
   static Value parse_array(char **pc);
@@ -265,6 +285,7 @@ public:
   void ensure_at_least(unsigned int minc, const char *context) const;
 
   void push_back(const Value &value) { _args.push_back(value); }
+  void push_back(Value &&value) { _args.push_back(std::move(value)); }
   void pop_back() { _args.pop_back(); }
   size_t size() const { return _args.size(); }
   const Value &at(size_t i) const { return _args.at(i); }
@@ -23,6 +23,8 @@
 #include "shellcore/types_common.h"
 #include "shellcore/types.h"
 
+#include <unordered_map>
+
 namespace shcore {
 enum NamingStyle {
   LowerCamelCase = 0,
@@ -33,8 +35,8 @@ enum NamingStyle {
 class SHCORE_PUBLIC Cpp_property_name {
 public:
   Cpp_property_name(const std::string &name, bool constant = false);
-  std::string name(const NamingStyle& style);
-  std::string base_name();
+  const std::string &name(const NamingStyle& style) const;
+  const std::string &base_name() const;
 
 private:
 
@@ -50,7 +52,7 @@ public:
   virtual ~Cpp_function() {}
 
   virtual std::string name();
-  virtual std::string name(const NamingStyle& style);
+  virtual const std::string &name(const NamingStyle& style) const;
 
   virtual std::vector<std::pair<std::string, Value_type> > signature();
 
@@ -68,6 +70,7 @@ public:
 
 protected:
   friend class Cpp_object_bridge;
+  friend class Cpp_member_registry;
 
   Cpp_function(const std::string &name, const Function &func, bool var_args);
   Cpp_function(const std::string &name, const Function &func, const char *arg1_name, Value_type arg1_type = Undefined, ...);
@@ -82,6 +85,88 @@ protected:
   bool _var_args;
 };
 
+class Cpp_object_bridge;
+
+/**
+ * The functions and properties of an object or class by their name on each
+ * naming style, so the member a script asks for is found without going
+ * through all of them and building their names on the way.
+ *
+ * When several members share a name the first one added is found, as it
+ * happened when the members were searched in order.
+ */
+class SHCORE_PUBLIC Cpp_member_index {
+public:
+  struct Function_entry {
+    std::string base_name;
+    std::shared_ptr<Cpp_function> function;
+  };
+
+  void add_function(const std::string &base_name, const std::shared_ptr<Cpp_function> &function);
+  void remove_function(const Cpp_function &function);
+  void add_property(const std::shared_ptr<Cpp_property_name> &property);
+  void remove_property(const Cpp_property_name &property);
+
+  const Function_entry *function(const std::string &name, NamingStyle style) const;
+  const std::shared_ptr<Cpp_property_name> *property(const std::string &name, NamingStyle style) const;
+
+private:
+  std::unordered_map<std::string, Function_entry> _functions[2];
+  std::unordered_map<std::string, std::shared_ptr<Cpp_property_name> > _properties[2];
+};
+
+/**
+ * The methods and properties of a class, shared by all its instances.
+ *
+ * Cpp_object_bridge::add_method() binds a function object to each instance
+ * and names it on every naming style, which is noticeable on the classes
+ * created by the thousands, like the rows of a result. Those classes build
+ * a registry once instead, usually on a function static, and give it to the
+ * Cpp_object_bridge constructor so their instances only hold their data.
+ * The methods are bound to an instance only when a script retrieves them.
+ *
+ * A derived class registry starts as a copy of the one of its base class.
+ */
+class SHCORE_PUBLIC Cpp_member_registry {
+public:
+  typedef std::function<Value(Cpp_object_bridge *object, const shcore::Argument_list &args)> Method;
+
+  Cpp_member_registry();
+
+  void add_method(const std::string &name, const Method &method, const char *arg1_name, Value_type arg1_type = Undefined, ...);
+  void add_varargs_method(const std::string &name, const Method &method);
+  void add_constant(const std::string &name);
+  void add_property(const std::string &name, const std::string &getter = "");
+
+  // Calls the given method of the object the registry method is called on
+  template<class T>
+  static Method method(Value (T::*member)(const shcore::Argument_list &args)) {
+    return [member](Cpp_object_bridge *object, const shcore::Argument_list &args) {
+      return (static_cast<T *>(object)->*member)(args);
+    };
+  }
+
+  template<class T>
+  static Method method(Value (T::*member)(const shcore::Argument_list &args) const) {
+    return [member](Cpp_object_bridge *object, const shcore::Argument_list &args) {
+      return (static_cast<T *>(object)->*member)(args);
+    };
+  }
+
+private:
+  friend class Cpp_object_bridge;
+
+  struct Method_entry {
+    // Holds the names and signature, it is not bound to any object
+    std::shared_ptr<Cpp_function> function;
+    Method method;
+  };
+
+  std::map<std::string, Method_entry> _methods;
+  std::vector<std::shared_ptr<Cpp_property_name> > _properties;
+  Cpp_member_index _index;
+};
+
 class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
 public:
   struct ScopedStyle {
@@ -133,6 +218,9 @@ public:
   virtual shcore::Value help(const shcore::Argument_list &args);
 
 protected:
+  // The members are the ones on the registry plus any added to the instance
+  Cpp_object_bridge(const Cpp_member_registry &members);
+
   virtual void add_method(const std::string &name, Cpp_function::Function func,
                   const char *arg1_name, Value_type arg1_type = Undefined, ...);
   virtual void add_varargs_method(const std::string &name, Cpp_function::Function func);
@@ -150,12 +238,31 @@ protected:
   // Returns the base name of the given member
   std::string get_base_name(const std::string& member) const;
 
+  // Look the members up on the instance first and then on the class. The
+  // functions are found by their base name or by their name on a style
+  std::shared_ptr<Cpp_function> find_function(const std::string &name) const;
+  const Cpp_member_index::Function_entry *find_function(const std::string &name, NamingStyle style) const;
+  const std::shared_ptr<Cpp_property_name> *find_property(const std::string &name, NamingStyle style) const;
+
   typedef std::pair< std::string, std::shared_ptr<Cpp_function> > FunctionEntry;
   std::map<std::string, std::shared_ptr<Cpp_function> > _funcs;
   std::vector<std::shared_ptr<Cpp_property_name> > _properties;
 
   // The global active naming style
   NamingStyle naming_style;
+
+private:
+  // The class members, if any
+  const Cpp_member_registry *_members;
+
+  // The members added to the instance, created with the first of them so
+  // the instances of classes using a registry do not carry it
+  std::unique_ptr<Cpp_member_index> _index;
+
+  void add_function(const std::string &name, const std::shared_ptr<Cpp_function> &function);
+  void add_property_name(const std::shared_ptr<Cpp_property_name> &property);
+  std::vector<std::shared_ptr<Cpp_property_name> > properties() const;
+  std::map<std::string, std::shared_ptr<Cpp_function> > functions() const;
 };
 };
 
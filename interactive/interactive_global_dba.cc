@@ -54,17 +54,25 @@ mysqlsh::dba::ReplicationGroupState Global_dba::check_preconditions(const std::s
   return dba->check_preconditions(function_name);
 }
 
-std::vector<std::pair<std::string, std::string>> Global_dba::get_replicaset_instances_status(std::string *out_cluster_name,
+std::vector<mysqlsh::dba::InstanceProbe> Global_dba::get_replicaset_instances_state(std::string *out_cluster_name,
           const shcore::Value::Map_type_ref &options) const {
   ScopedStyle ss(_target.get(), naming_style);
   auto dba = std::dynamic_pointer_cast<mysqlsh::dba::Dba>(_target);
-  return dba->get_replicaset_instances_status(out_cluster_name, options);
+  return dba->get_replicaset_instances_state(out_cluster_name, options);
 }
 
-void Global_dba::validate_instances_status_reboot_cluster(const shcore::Argument_list &args) const {
+void Global_dba::validate_instances_status_reboot_cluster(
+    const std::vector<mysqlsh::dba::InstanceProbe> &instances_state) const {
   ScopedStyle ss(_target.get(), naming_style);
   auto dba = std::dynamic_pointer_cast<mysqlsh::dba::Dba>(_target);
-  return dba->validate_instances_status_reboot_cluster(args);
+  return dba->validate_instances_status_reboot_cluster(instances_state);
+}
+
+shcore::Value Global_dba::reboot_probed_cluster(const shcore::Argument_list &args,
+    const std::vector<mysqlsh::dba::InstanceProbe> &instances_state) const {
+  ScopedStyle ss(_target.get(), naming_style);
+  auto dba = std::dynamic_pointer_cast<mysqlsh::dba::Dba>(_target);
+  return dba->reboot_probed_cluster(args, &instances_state);
 }
 
 shcore::Argument_list Global_dba::check_instance_op_params(const shcore::Argument_list &args,
@@ -490,12 +498,16 @@ shcore::Value Global_dba::reboot_cluster_from_complete_outage(const shcore::Argu
       println("Reconfiguring the cluster '" + cluster_name + "' from complete outage...");
     }
 
+    // Get the all the instances and their status, probing them once for both
+    // the checks here and the reboot itself
+    std::vector<mysqlsh::dba::InstanceProbe> instances_state = get_replicaset_instances_state(&cluster_name, options);
+
     // Verify the status of the instances
-    validate_instances_status_reboot_cluster(args);
+    validate_instances_status_reboot_cluster(instances_state);
 
-    // Get the all the instances and their status
-    std::vector<std::pair<std::string, std::string>> instances_status
-        = get_replicaset_instances_status(&cluster_name, options);
+    std::vector<std::pair<std::string, std::string>> instances_status;
+    for (auto &probe : instances_state)
+      instances_status.emplace_back(probe.address, probe.error);
 
     // Validate the rejoinInstances list if provided
     if (!confirm_rescan_rejoins) {
@@ -636,9 +648,9 @@ shcore::Value Global_dba::reboot_cluster_from_complete_outage(const shcore::Argu
 
       new_args.push_back(shcore::Value(cluster_name));
       new_args.push_back(shcore::Value(options));
-      ret_val = call_target("rebootClusterFromCompleteOutage", new_args);
+      ret_val = reboot_probed_cluster(new_args, instances_state);
     } else {
-      ret_val = call_target("rebootClusterFromCompleteOutage", args);
+      ret_val = reboot_probed_cluster(args, instances_state);
     }
 
     println();
@@ -49,9 +49,11 @@ public:
 
 private:
   mysqlsh::dba::ReplicationGroupState check_preconditions(const std::string& function_name) const;
-  std::vector<std::pair<std::string, std::string>> get_replicaset_instances_status(std::string *out_cluster_name,
+  std::vector<mysqlsh::dba::InstanceProbe> get_replicaset_instances_state(std::string *out_cluster_name,
           const shcore::Value::Map_type_ref &options) const;
-  void validate_instances_status_reboot_cluster(const shcore::Argument_list &args) const;
+  void validate_instances_status_reboot_cluster(const std::vector<mysqlsh::dba::InstanceProbe> &instances_state) const;
+  shcore::Value reboot_probed_cluster(const shcore::Argument_list &args,
+                                      const std::vector<mysqlsh::dba::InstanceProbe> &instances_state) const;
   shcore::Argument_list check_instance_op_params(const shcore::Argument_list &args, const std::string& function_name);
   shcore::Value perform_instance_operation(const shcore::Argument_list &args, const std::string &fname, const std::string& progressive, const std::string& past);
   void dump_table(const std::vector<std::string>& column_names, const std::vector<std::string>& column_labels, shcore::Value::Array_type_ref documents);
@@ -17,8 +17,13 @@
  * 02110-1301  USA
  */
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
 #include <string>
 #include <random>
+#include <thread>
+#include <vector>
 #ifndef WIN32
 #include <sys/un.h>
 #endif
@@ -44,6 +49,50 @@ using namespace mysqlsh;
 using namespace mysqlsh::dba;
 using namespace shcore;
 
+namespace {
+// Opens a classic session to a cluster instance
+std::shared_ptr<mysqlsh::ShellDevelopmentSession> connect_instance(const std::string &address,
+    const std::string &user, const std::string &password) {
+  shcore::Argument_list session_args;
+  Value::Map_type_ref instance_options(new shcore::Value::Map_type);
+
+  shcore::Value::Map_type_ref connection_data = shcore::get_connection_data(address);
+
+  (*instance_options)["host"] = shcore::Value(connection_data->get_string("host"));
+  (*instance_options)["port"] = shcore::Value(static_cast<int>(connection_data->get_int("port")));
+  // We assume the root password is the same on all instances
+  (*instance_options)["password"] = shcore::Value(password);
+  (*instance_options)["user"] = shcore::Value(user);
+  session_args.push_back(shcore::Value(instance_options));
+
+  return mysqlsh::connect_session(session_args, mysqlsh::SessionType::Classic);
+}
+
+// Reads with a single session what the reboot validations need from the
+// instance: its GR instance type and GTID_EXECUTED. Connection failures are
+// thrown, failures reading the state are returned on "error"
+shcore::Value read_instance_state(const std::string &address, const std::string &user,
+                                  const std::string &password) {
+  std::shared_ptr<mysqlsh::ShellDevelopmentSession> session = connect_instance(address, user, password);
+  auto classic = dynamic_cast<mysqlsh::mysql::ClassicSession*>(session.get());
+
+  shcore::Value::Map_type_ref state(new shcore::Value::Map_type());
+  try {
+    (*state)["type"] = shcore::Value(static_cast<int>(get_gr_instance_type(classic->connection())));
+
+    std::string value;
+    get_server_variable(classic->connection(), "GLOBAL.GTID_EXECUTED", value);
+    (*state)["gtidExecuted"] = shcore::Value(value);
+  } catch (std::exception &e) {
+    (*state)["error"] = shcore::Value("Error reading the state of " + address + ": " + e.what());
+  }
+
+  session->close(shcore::Argument_list());
+
+  return shcore::Value(state);
+}
+}
+
 #define PASSWORD_LENGHT 16
 
 std::set<std::string> Dba::_deploy_instance_opts = {"portx", "sandboxDir", "password", "dbPassword", "allowRootFrom", "ignoreSslError"};
@@ -91,6 +140,9 @@ void Dba::init() {
   add_method("stopSandboxInstance", std::bind(&Dba::stop_sandbox_instance, this, _1), "data", shcore::Map, NULL);
   add_method("deleteSandboxInstance", std::bind(&Dba::delete_sandbox_instance, this, _1), "data", shcore::Map, NULL);
   add_method("killSandboxInstance", std::bind(&Dba::kill_sandbox_instance, this, _1), "data", shcore::Map, NULL);
+  add_method("deploySandboxInstances", std::bind(&Dba::deploy_sandbox_instances, this, _1), "data", shcore::Map, NULL);
+  add_method("startSandboxInstances", std::bind(&Dba::start_sandbox_instances, this, _1), "data", shcore::Map, NULL);
+  add_method("stopSandboxInstances", std::bind(&Dba::stop_sandbox_instances, this, _1), "data", shcore::Map, NULL);
   add_method("configureLocalInstance", std::bind(&Dba::configure_local_instance, this, _1), "data", shcore::Map, NULL);
   add_varargs_method("rebootClusterFromCompleteOutage", std::bind(&Dba::reboot_cluster_from_complete_outage, this, _1));
   add_varargs_method("help", std::bind(&Dba::help, this, _1));
@@ -625,7 +677,8 @@ shcore::Value Dba::check_instance_configuration(const shcore::Argument_list &arg
   return ret_val;
 }
 
-shcore::Value Dba::exec_instance_op(const std::string &function, const shcore::Argument_list &args) {
+shcore::Value Dba::exec_instance_op(const std::string &function, const shcore::Argument_list &args,
+                                    ProvisioningInterface &provisioning) {
   shcore::Value ret_val;
 
   shcore::Value::Map_type_ref options; // Map with the connection data
@@ -702,20 +755,20 @@ shcore::Value Dba::exec_instance_op(const std::string &function, const shcore::A
   int rc = 0;
   if (function == "deploy") {
     // First we need to create the instance
-    rc = _provisioning_interface->create_sandbox(port, portx, sandbox_dir, password, mycnf_options, ignore_ssl_error, errors);
+    rc = provisioning.create_sandbox(port, portx, sandbox_dir, password, mycnf_options, ignore_ssl_error, errors);
     if (rc == 0) {
-      rc = _provisioning_interface->start_sandbox(port, sandbox_dir, errors);
+      rc = provisioning.start_sandbox(port, sandbox_dir, errors);
       //std::string uri = "localhost:" + std::to_string(port);
       //ret_val = shcore::Value::wrap<Instance>(new Instance(uri, uri, options));
     }
   } else if (function == "delete")
-      rc = _provisioning_interface->delete_sandbox(port, sandbox_dir, errors);
+      rc = provisioning.delete_sandbox(port, sandbox_dir, errors);
   else if (function == "kill")
-    rc = _provisioning_interface->kill_sandbox(port, sandbox_dir, errors);
+    rc = provisioning.kill_sandbox(port, sandbox_dir, errors);
   else if (function == "stop")
-    rc = _provisioning_interface->stop_sandbox(port, sandbox_dir, password, errors);
+    rc = provisioning.stop_sandbox(port, sandbox_dir, password, errors);
   else if (function == "start")
-    rc = _provisioning_interface->start_sandbox(port, sandbox_dir, errors);
+    rc = provisioning.start_sandbox(port, sandbox_dir, errors);
 
   if (rc != 0) {
     std::vector<std::string> str_errors;
@@ -793,52 +846,59 @@ shcore::Value Dba::deploy_sandbox_instance(const shcore::Argument_list &args, co
   args.ensure_count(1, 2, get_function_name(fname).c_str());
 
   try {
-    ret_val = exec_instance_op("deploy", args);
-
-    if (args.size() == 2) {
-      shcore::Argument_map opt_map(*args.map_at(1));
-      // create root@<addr> if needed
-      // Valid values:
-      // allowRootFrom: address
-      // allowRootFrom: %
-      // allowRootFrom: null (that is, disable the option)
-      if (opt_map.has_key("allowRootFrom") && opt_map.at("allowRootFrom").type != shcore::Null) {
-        std::string remote_root = opt_map.string_at("allowRootFrom");
-        if (!remote_root.empty()) {
-          int port = args.int_at(0);
-          std::string password;
-          std::string uri = "root@localhost:" + std::to_string(port);
-          if (opt_map.has_key("password"))
-            password = opt_map.string_at("password");
-          else if (opt_map.has_key("dbPassword"))
-            password = opt_map.string_at("dbPassword");
-
-          auto session = std::dynamic_pointer_cast<mysqlsh::mysql::ClassicSession>(
-                mysqlsh::connect_session(uri, password, mysqlsh::SessionType::Classic));
-          assert(session);
-
-          log_info("Creating root@%s account for sandbox %i", remote_root.c_str(), port);
-          session->execute_sql("SET sql_log_bin = 0");
-          {
-            sqlstring create_user("CREATE USER root@? IDENTIFIED BY ?", 0);
-            create_user << remote_root << password;
-            create_user.done();
-            session->execute_sql(create_user);
-          }
-          {
-            sqlstring grant("GRANT ALL ON *.* TO root@? WITH GRANT OPTION", 0);
-            grant << remote_root;
-            grant.done();
-            session->execute_sql(grant);
-          }
-          session->execute_sql("SET sql_log_bin = 1");
+    ret_val = deploy_instance(args, *_provisioning_interface);
+  }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name(fname));
 
-          session->close(shcore::Argument_list());
+  return ret_val;
+}
+
+// Creates and starts the sandbox, then the remote root account if requested
+shcore::Value Dba::deploy_instance(const shcore::Argument_list &args, ProvisioningInterface &provisioning) {
+  shcore::Value ret_val = exec_instance_op("deploy", args, provisioning);
+
+  if (args.size() == 2) {
+    shcore::Argument_map opt_map(*args.map_at(1));
+    // create root@<addr> if needed
+    // Valid values:
+    // allowRootFrom: address
+    // allowRootFrom: %
+    // allowRootFrom: null (that is, disable the option)
+    if (opt_map.has_key("allowRootFrom") && opt_map.at("allowRootFrom").type != shcore::Null) {
+      std::string remote_root = opt_map.string_at("allowRootFrom");
+      if (!remote_root.empty()) {
+        int port = args.int_at(0);
+        std::string password;
+        std::string uri = "root@localhost:" + std::to_string(port);
+        if (opt_map.has_key("password"))
+          password = opt_map.string_at("password");
+        else if (opt_map.has_key("dbPassword"))
+          password = opt_map.string_at("dbPassword");
+
+        auto session = std::dynamic_pointer_cast<mysqlsh::mysql::ClassicSession>(
+              mysqlsh::connect_session(uri, password, mysqlsh::SessionType::Classic));
+        assert(session);
+
+        log_info("Creating root@%s account for sandbox %i", remote_root.c_str(), port);
+        session->execute_sql("SET sql_log_bin = 0");
+        {
+          sqlstring create_user("CREATE USER root@? IDENTIFIED BY ?", 0);
+          create_user << remote_root << password;
+          create_user.done();
+          session->execute_sql(create_user);
         }
+        {
+          sqlstring grant("GRANT ALL ON *.* TO root@? WITH GRANT OPTION", 0);
+          grant << remote_root;
+          grant.done();
+          session->execute_sql(grant);
+        }
+        session->execute_sql("SET sql_log_bin = 1");
+
+        session->close(shcore::Argument_list());
       }
     }
   }
-  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name(fname));
 
   return ret_val;
 }
@@ -877,7 +937,7 @@ shcore::Value Dba::delete_sandbox_instance(const shcore::Argument_list &args) {
   args.ensure_count(1, 2, get_function_name("deleteSandboxInstance").c_str());
 
   try {
-    ret_val = exec_instance_op("delete", args);
+    ret_val = exec_instance_op("delete", args, *_provisioning_interface);
   }
   CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("deleteSandboxInstance"));
 
@@ -919,7 +979,7 @@ shcore::Value Dba::kill_sandbox_instance(const shcore::Argument_list &args) {
   args.ensure_count(1, 2, get_function_name("killSandboxInstance").c_str());
 
   try {
-    ret_val = exec_instance_op("kill", args);
+    ret_val = exec_instance_op("kill", args, *_provisioning_interface);
   }
   CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("killSandboxInstance"));
 
@@ -963,7 +1023,7 @@ shcore::Value Dba::stop_sandbox_instance(const shcore::Argument_list &args) {
 
   args.ensure_count(1, 2, get_function_name("stopSandboxInstance").c_str());
   try {
-    ret_val = exec_instance_op("stop", args);
+    ret_val = exec_instance_op("stop", args, *_provisioning_interface);
   }
   CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("stopSandboxInstance"));
 
@@ -1005,13 +1065,266 @@ shcore::Value Dba::start_sandbox_instance(const shcore::Argument_list &args) {
   args.ensure_count(1, 2, get_function_name("startSandboxInstance").c_str());
 
   try {
-    ret_val = exec_instance_op("start", args);
+    ret_val = exec_instance_op("start", args, *_provisioning_interface);
   }
   CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("startSandboxInstance"));
 
   return ret_val;
 }
 
+/*
+ * Runs the sandbox operation on each port of the list, up to maxThreads at
+ * once, and returns the outcome of each instance in the order of the list.
+ * An instance failing does not stop the others.
+ */
+shcore::Value Dba::exec_instances_op(const std::string &function, const shcore::Argument_list &args) {
+  auto ports = args.array_at(0);
+  if (ports->empty())
+    throw shcore::Exception::argument_error("The list of ports can not be empty");
+
+  std::vector<std::string> addresses;
+  for (auto &port : *ports) {
+    if (port.type != shcore::Integer && port.type != shcore::UInteger)
+      throw shcore::Exception::argument_error("Invalid value for the list of ports: " + port.descr() +
+                                              " is not a port number");
+
+    std::string address = std::to_string(port.as_int());
+    if (std::find(addresses.begin(), addresses.end(), address) != addresses.end())
+      throw shcore::Exception::argument_error("Invalid value for the list of ports: " + address + " is duplicated");
+
+    addresses.push_back(address);
+  }
+
+  // The options of each instance are the ones of the single instance
+  // operations, except maxThreads
+  size_t max_threads = 4;
+  shcore::Value::Map_type_ref options;
+  if (args.size() == 2) {
+    options.reset(new shcore::Value::Map_type(*args.map_at(1)));
+
+    if (options->has_key("maxThreads")) {
+      int64_t threads = shcore::Argument_map(*options).int_at("maxThreads");
+      if (threads < 1)
+        throw shcore::Exception::argument_error("Invalid value for 'maxThreads': Please use a number greater than 0");
+
+      max_threads = static_cast<size_t>(threads);
+      options->erase("maxThreads");
+    }
+
+    if (function == "deploy" && options->has_key("portx"))
+      throw shcore::Exception::argument_error("Invalid values in the options: portx, it can not be shared by the instances");
+  }
+
+  // Unlike probes, the operations change the instances, so they are always
+  // waited for however long they take. Each thread runs the instances it takes
+  // from the list on its own mysqlprovision, not verbose so the output of the
+  // instances is not mixed
+  shcore::Interpreter_delegate *delegate = _shell_core->get_delegate();
+  std::vector<shcore::Value> results(addresses.size());
+  std::mutex mutex;
+  size_t next = 0;
+  auto run = [&]() {
+    ProvisioningInterface provisioning(delegate);
+    for (;;) {
+      size_t index;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (next == addresses.size())
+          break;
+        index = next++;
+      }
+
+      int port = std::stoi(addresses[index]);
+      shcore::Argument_list instance_args;
+      instance_args.push_back(shcore::Value(port));
+      if (options)
+        instance_args.push_back(shcore::Value(options));
+
+      shcore::Value::Map_type_ref instance(new shcore::Value::Map_type());
+      (*instance)["port"] = shcore::Value(port);
+
+      auto start = std::chrono::steady_clock::now();
+      std::string error;
+      try {
+        if (function == "deploy")
+          deploy_instance(instance_args, provisioning);
+        else
+          exec_instance_op(function, instance_args, provisioning);
+      } catch (std::exception &e) {
+        error = e.what();
+        if (error.empty())
+          error = "Unknown error";
+      } catch (...) {
+        // Nothing may leave the thread
+        error = "Unknown error";
+      }
+      auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+      (*instance)["status"] = shcore::Value(error.empty() ? "ok" : "error");
+      if (!error.empty()) {
+        (*instance)["error"] = shcore::Value(error);
+        log_warning("Sandbox %s on port %d failed: %s", function.c_str(), port, error.c_str());
+      }
+
+      log_info("Sandbox %s on port %d took %lld ms", function.c_str(), port, static_cast<long long>(elapsed.count()));
+
+      // Every thread writes different entries
+      results[index] = shcore::Value(instance);
+    }
+
+    // Deploying with allowRootFrom uses classic sessions, the client library
+    // keeps per thread data
+    mysql_thread_end();
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t index = 0; index < std::min(max_threads, addresses.size()); index++)
+    threads.push_back(std::thread(run));
+  for (auto &thread : threads)
+    thread.join();
+
+  shcore::Value::Array_type_ref ret_val(new shcore::Value::Array_type(results.begin(), results.end()));
+  return shcore::Value(ret_val);
+}
+
+REGISTER_HELP(DBA_DEPLOYSANDBOXINSTANCES_BRIEF, "Creates new MySQL Server instances on localhost, concurrently.");
+REGISTER_HELP(DBA_DEPLOYSANDBOXINSTANCES_PARAM, "@param ports List with the ports where the new instances will listen for connections.");
+REGISTER_HELP(DBA_DEPLOYSANDBOXINSTANCES_PARAM1, "@param options Optional dictionary with options affecting the new deployed instances.");
+REGISTER_HELP(DBA_DEPLOYSANDBOXINSTANCES_RETURN, "@returns A list with the result on each instance.");
+REGISTER_HELP(DBA_DEPLOYSANDBOXINSTANCES_DETAIL, "This function deploys a new MySQL Server instance on each of the given ports, "\
+"as deploySandboxInstance does, taking the same options for all of them except portx, which is calculated for each instance. "\
+"The instances are deployed concurrently, the next option limits how many at once:");
+REGISTER_HELP(DBA_DEPLOYSANDBOXINSTANCES_DETAIL1, "@li maxThreads: number of instances deployed at the same time, by default 4.");
+REGISTER_HELP(DBA_DEPLOYSANDBOXINSTANCES_DETAIL2, "The result has an entry for each port, in the order of the list, with the port, "\
+"the status, either ok or error, and the error when the instance failed. An instance failing does not stop the others.");
+REGISTER_HELP(DBA_DEPLOYSANDBOXINSTANCES_DETAIL3, "The mysqlprovision output of the instances is not printed in verbose mode.");
+
+/**
+* $(DBA_DEPLOYSANDBOXINSTANCES_BRIEF)
+*
+* $(DBA_DEPLOYSANDBOXINSTANCES_PARAM)
+* $(DBA_DEPLOYSANDBOXINSTANCES_PARAM1)
+*
+* $(DBA_DEPLOYSANDBOXINSTANCES_RETURN)
+*
+* $(DBA_DEPLOYSANDBOXINSTANCES_DETAIL)
+*
+* $(DBA_DEPLOYSANDBOXINSTANCES_DETAIL1)
+*
+* $(DBA_DEPLOYSANDBOXINSTANCES_DETAIL2)
+*
+* $(DBA_DEPLOYSANDBOXINSTANCES_DETAIL3)
+*/
+#if DOXYGEN_JS
+List Dba::deploySandboxInstances(List ports, Dictionary options) {}
+#elif DOXYGEN_PY
+list Dba::deploy_sandbox_instances(list ports, dict options) {}
+#endif
+shcore::Value Dba::deploy_sandbox_instances(const shcore::Argument_list &args) {
+  shcore::Value ret_val;
+
+  args.ensure_count(1, 2, get_function_name("deploySandboxInstances").c_str());
+
+  try {
+    ret_val = exec_instances_op("deploy", args);
+  }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("deploySandboxInstances"));
+
+  return ret_val;
+}
+
+REGISTER_HELP(DBA_STARTSANDBOXINSTANCES_BRIEF, "Starts existing MySQL Server instances on localhost, concurrently.");
+REGISTER_HELP(DBA_STARTSANDBOXINSTANCES_PARAM, "@param ports List with the ports where the instances listen for MySQL connections.");
+REGISTER_HELP(DBA_STARTSANDBOXINSTANCES_PARAM1, "@param options Optional dictionary with options affecting the result.");
+REGISTER_HELP(DBA_STARTSANDBOXINSTANCES_RETURN, "@returns A list with the result on each instance.");
+REGISTER_HELP(DBA_STARTSANDBOXINSTANCES_DETAIL, "This function starts the MySQL Server instance on each of the given ports, "\
+"as startSandboxInstance does, taking the same options for all of them. The instances are started concurrently, the next option "\
+"limits how many at once:");
+REGISTER_HELP(DBA_STARTSANDBOXINSTANCES_DETAIL1, "@li maxThreads: number of instances started at the same time, by default 4.");
+REGISTER_HELP(DBA_STARTSANDBOXINSTANCES_DETAIL2, "The result has an entry for each port, in the order of the list, with the port, "\
+"the status, either ok or error, and the error when the instance failed. An instance failing does not stop the others.");
+REGISTER_HELP(DBA_STARTSANDBOXINSTANCES_DETAIL3, "The mysqlprovision output of the instances is not printed in verbose mode.");
+
+/**
+* $(DBA_STARTSANDBOXINSTANCES_BRIEF)
+*
+* $(DBA_STARTSANDBOXINSTANCES_PARAM)
+* $(DBA_STARTSANDBOXINSTANCES_PARAM1)
+*
+* $(DBA_STARTSANDBOXINSTANCES_RETURN)
+*
+* $(DBA_STARTSANDBOXINSTANCES_DETAIL)
+*
+* $(DBA_STARTSANDBOXINSTANCES_DETAIL1)
+*
+* $(DBA_STARTSANDBOXINSTANCES_DETAIL2)
+*
+* $(DBA_STARTSANDBOXINSTANCES_DETAIL3)
+*/
+#if DOXYGEN_JS
+List Dba::startSandboxInstances(List ports, Dictionary options) {}
+#elif DOXYGEN_PY
+list Dba::start_sandbox_instances(list ports, dict options) {}
+#endif
+shcore::Value Dba::start_sandbox_instances(const shcore::Argument_list &args) {
+  shcore::Value ret_val;
+
+  args.ensure_count(1, 2, get_function_name("startSandboxInstances").c_str());
+
+  try {
+    ret_val = exec_instances_op("start", args);
+  }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("startSandboxInstances"));
+
+  return ret_val;
+}
+
+REGISTER_HELP(DBA_STOPSANDBOXINSTANCES_BRIEF, "Stops running MySQL Server instances on localhost, concurrently.");
+REGISTER_HELP(DBA_STOPSANDBOXINSTANCES_PARAM, "@param ports List with the ports of the instances to be stopped.");
+REGISTER_HELP(DBA_STOPSANDBOXINSTANCES_PARAM1, "@param options Optional dictionary with options affecting the result.");
+REGISTER_HELP(DBA_STOPSANDBOXINSTANCES_RETURN, "@returns A list with the result on each instance.");
+REGISTER_HELP(DBA_STOPSANDBOXINSTANCES_DETAIL, "This function gracefully stops the MySQL Server instance on each of the given "\
+"ports, as stopSandboxInstance does, taking the same options for all of them. The instances are stopped concurrently, the next "\
+"option limits how many at once:");
+REGISTER_HELP(DBA_STOPSANDBOXINSTANCES_DETAIL1, "@li maxThreads: number of instances stopped at the same time, by default 4.");
+REGISTER_HELP(DBA_STOPSANDBOXINSTANCES_DETAIL2, "The result has an entry for each port, in the order of the list, with the port, "\
+"the status, either ok or error, and the error when the instance failed. An instance failing does not stop the others.");
+REGISTER_HELP(DBA_STOPSANDBOXINSTANCES_DETAIL3, "The mysqlprovision output of the instances is not printed in verbose mode.");
+
+/**
+* $(DBA_STOPSANDBOXINSTANCES_BRIEF)
+*
+* $(DBA_STOPSANDBOXINSTANCES_PARAM)
+* $(DBA_STOPSANDBOXINSTANCES_PARAM1)
+*
+* $(DBA_STOPSANDBOXINSTANCES_RETURN)
+*
+* $(DBA_STOPSANDBOXINSTANCES_DETAIL)
+*
+* $(DBA_STOPSANDBOXINSTANCES_DETAIL1)
+*
+* $(DBA_STOPSANDBOXINSTANCES_DETAIL2)
+*
+* $(DBA_STOPSANDBOXINSTANCES_DETAIL3)
+*/
+#if DOXYGEN_JS
+List Dba::stopSandboxInstances(List ports, Dictionary options) {}
+#elif DOXYGEN_PY
+list Dba::stop_sandbox_instances(list ports, dict options) {}
+#endif
+shcore::Value Dba::stop_sandbox_instances(const shcore::Argument_list &args) {
+  shcore::Value ret_val;
+
+  args.ensure_count(1, 2, get_function_name("stopSandboxInstances").c_str());
+
+  try {
+    ret_val = exec_instances_op("stop", args);
+  }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("stopSandboxInstances"));
+
+  return ret_val;
+}
+
 REGISTER_HELP(DBA_CONFIGURELOCALINSTANCE_BRIEF, "Validates and configures an instance for cluster usage.");
 REGISTER_HELP(DBA_CONFIGURELOCALINSTANCE_PARAM, "@param instance An instance definition.");
 REGISTER_HELP(DBA_CONFIGURELOCALINSTANCE_PARAM1, "@param options Additional options for the operation.");
@@ -1365,6 +1678,11 @@ None Dba::reboot_cluster_from_complete_outage(str clusterName, dict options) {}
 #endif
 
 shcore::Value Dba::reboot_cluster_from_complete_outage(const shcore::Argument_list &args) {
+  return reboot_probed_cluster(args, nullptr);
+}
+
+shcore::Value Dba::reboot_probed_cluster(const shcore::Argument_list &args,
+                                         const std::vector<InstanceProbe> *probed_state) {
   args.ensure_count(0, 2, get_function_name("rebootClusterFromCompleteOutage").c_str());
 
   shcore::Value ret_val;
@@ -1405,6 +1723,8 @@ shcore::Value Dba::reboot_cluster_from_complete_outage(const shcore::Argument_li
     if (options) {
       shcore::Argument_map opt_map(*options);
 
+      opt_map.ensure_keys({}, _reboot_cluster_opts, "the options");
+
       if (opt_map.has_key("removeInstances"))
         remove_instances_ref = opt_map.array_at("removeInstances");
 
@@ -1563,13 +1883,20 @@ shcore::Value Dba::reboot_cluster_from_complete_outage(const shcore::Argument_li
     // 4.1 None of the instances can belong to a GR Group
     // 4.2 If any of the instances belongs to a GR group or is already managed by the
     // InnoDB Cluster, so include that information on the error message
-    validate_instances_status_reboot_cluster(args);
+    // The instances are probed once for both validations, unless the caller
+    // already did
+    std::vector<InstanceProbe> instances_state;
+    if (probed_state)
+      instances_state = *probed_state;
+    else
+      instances_state = get_replicaset_instances_state(&cluster_name, options);
+    validate_instances_status_reboot_cluster(instances_state);
 
     // 5. Verify which of the online instances has the GTID superset.
     // 5.1 Skip the verification on the list of instances to be removed: "removeInstances"
     // 5.2 If the current session instance doesn't have the GTID superset, error out
     // with that information and including on the message the instance with the GTID superset
-    validate_instances_gtid_reboot_cluster(&cluster_name, options, instance_session);
+    validate_instances_gtid_reboot_cluster(instance_session, instances_state);
 
     // Get the group_replication_group_name
     group_replication_group_name = _metadata_storage->get_replicaset_group_name();
@@ -1618,18 +1945,17 @@ ReplicationGroupState Dba::check_preconditions(const std::string& function_name)
 }
 
 /*
- * get_replicaset_instances_status:
+ * get_replicaset_instances_state:
  *
- * Given a cluster id, this function verifies the connectivity status of all the instances
- * of the default replicaSet of the cluster. It returns a list of pairs <instance_id, status>,
- * on which 'status' is empty if the instance is reachable, or if not reachable contains the
- * connection failure error message
+ * Given a cluster id, this function probes all the instances of the default replicaSet of the
+ * cluster but the current session instance, concurrently and with a single session each.
+ * For every instance the probe error is empty if the instance is reachable, or if not reachable
+ * contains the connection failure error message. The value of the reachable ones is their state,
+ * see read_instance_state().
  */
-std::vector<std::pair<std::string, std::string>> Dba::get_replicaset_instances_status(std::string *out_cluster_name,
+std::vector<InstanceProbe> Dba::get_replicaset_instances_state(std::string *out_cluster_name,
           const shcore::Value::Map_type_ref &options) {
-  std::vector<std::pair<std::string, std::string>> instances_status;
-  std::shared_ptr<mysqlsh::ShellDevelopmentSession> session;
-  std::string user, password, host, port, active_session_address, instance_address, conn_status;
+  std::string user, password, host, port, active_session_address, instance_address;
 
   if (out_cluster_name->empty())
     *out_cluster_name = _metadata_storage->get_default_cluster()->get_name();
@@ -1672,72 +1998,55 @@ std::vector<std::pair<std::string, std::string>> Dba::get_replicaset_instances_s
     password = instance_session->get_password();
   }
 
-  // Iterate on all instances from the metadata
+  // Skip the current session instance
+  std::vector<std::string> addresses;
   for (auto it = instances->begin(); it != instances->end(); ++it) {
     auto row = it->as_object<mysqlsh::Row>();
     instance_address = row->get_member("host").as_string();
-    conn_status.clear();
-    session = NULL;
-
-    // Skip the current session instance
-    if (instance_address == active_session_address) {
-      continue;
-    }
-
-    shcore::Argument_list session_args;
-    Value::Map_type_ref instance_options(new shcore::Value::Map_type);
-
-    shcore::Value::Map_type_ref connection_data = shcore::get_connection_data(instance_address);
-
-    int instance_port = connection_data->get_int("port");
-    std::string instance_host = connection_data->get_string("host");
-
-    (*instance_options)["host"] = shcore::Value(instance_host);
-    (*instance_options)["port"] = shcore::Value(instance_port);
-    // We assume the root password is the same on all instances
-    (*instance_options)["password"] = shcore::Value(password);
-    (*instance_options)["user"] = shcore::Value(user);
-    session_args.push_back(shcore::Value(instance_options));
+    if (instance_address != active_session_address)
+      addresses.push_back(instance_address);
+  }
 
-    try {
-      log_info("Opening a new session to the instance to determine its status: %s",
-                instance_address.c_str());
-      session = mysqlsh::connect_session(session_args, mysqlsh::SessionType::Classic);
-      session->close(shcore::Argument_list());
-    } catch (std::exception &e) {
-      conn_status = e.what();
-      log_warning("Could not open connection to %s: %s.", instance_address.c_str(), e.what());
+  // The instances are probed concurrently, so the unreachable ones wait for
+  // their connect timeout at the same time
+  std::vector<InstanceProbe> probes = probe_instances(addresses, [user, password](const std::string &address) {
+    log_info("Opening a new session to the instance to determine its state: %s", address.c_str());
+    return read_instance_state(address, user, password);
+  });
+
+  int verbose = _provisioning_interface->get_verbose();
+  for (auto &probe : probes) {
+    if (!probe.error.empty())
+      log_warning("Could not open connection to %s: %s.", probe.address.c_str(), probe.error.c_str());
+
+    std::string message = "Probed instance '" + probe.address + "' in " +
+                          std::to_string(probe.elapsed.count()) + " ms";
+    log_info("%s", message.c_str());
+
+    // The slow members are visible in verbose mode
+    if (verbose) {
+      message += probe.error.empty() ? "\n" : " (" + probe.error + ")\n";
+      _shell_core->get_delegate()->print(_shell_core->get_delegate()->user_data, message.c_str());
     }
-
-    // Add the <instance, connection_status> pair to the list
-    instances_status.emplace_back(instance_address, conn_status);
   }
 
-  return instances_status;
+  return probes;
 }
 
 /*
  * validate_instances_status_reboot_cluster:
  *
  * This function is an auxiliary function to be used for the reboot_cluster operation.
- * It verifies the status of all the instances of the cluster referent to the arguments list.
+ * It verifies the status of all the instances of the cluster, as probed by
+ * get_replicaset_instances_state().
  * Firstly, it verifies the status of the current session instance to determine if it belongs
  * to a GR group or is already managed by the InnoDB Cluster.cluster_name
  * If not, does the same validation for the remaining reachable instances of the cluster.
  */
-void Dba::validate_instances_status_reboot_cluster(const shcore::Argument_list &args) {
-  std::string cluster_name, user, password, port, host, active_session_address;
-  shcore::Value::Map_type_ref options;
-  std::shared_ptr<mysqlsh::ShellDevelopmentSession> session;
+void Dba::validate_instances_status_reboot_cluster(const std::vector<InstanceProbe> &instances_state) {
+  std::string port, host, active_session_address;
   mysqlsh::mysql::ClassicSession *classic_current;
 
-  if (args.size() == 1)
-    cluster_name = args.string_at(0);
-  if (args.size() > 1) {
-    cluster_name = args.string_at(0);
-    options = args.map_at(1);
-  }
-
   // get the current session information
   auto instance_session(_metadata_storage->get_dba()->get_active_session());
   classic_current = dynamic_cast<mysqlsh::mysql::ClassicSession*>(instance_session.get());
@@ -1749,32 +2058,6 @@ void Dba::validate_instances_status_reboot_cluster(const shcore::Argument_list &
   host = current_session_options->get_string("host");
   active_session_address = host + ":" + port;
 
-  if (options) {
-    shcore::Argument_map opt_map(*options);
-
-    opt_map.ensure_keys({}, mysqlsh::dba::Dba::_reboot_cluster_opts, "the options");
-
-    // Check if the password is specified on the options and if not prompt it
-    if (opt_map.has_key("password"))
-      password = opt_map.string_at("password");
-    else if (opt_map.has_key("dbPassword"))
-      password = opt_map.string_at("dbPassword");
-    else
-      password = instance_session->get_password();
-
-    // check if the user is specified on the options and it not prompt it
-    if (opt_map.has_key("user"))
-      user = opt_map.string_at("user");
-    else if (opt_map.has_key("dbUser"))
-      user = opt_map.string_at("dbUser");
-    else
-      user = instance_session->get_user();
-
-  } else {
-    user = instance_session->get_user();
-    password = instance_session->get_password();
-  }
-
   GRInstanceType type = get_gr_instance_type(classic_current->connection());
 
   switch (type) {
@@ -1795,48 +2078,19 @@ void Dba::validate_instances_status_reboot_cluster(const shcore::Argument_list &
   }
 
   // Verify all the remaining online instances for their status
-  std::vector<std::pair<std::string, std::string>> instances_status =
-          get_replicaset_instances_status(&cluster_name, options);
+  for (auto &probe : instances_state) {
+    std::string instance_address = probe.address;
 
-  for (auto &value : instances_status) {
-    mysqlsh::mysql::ClassicSession *classic;
-
-    std::string instance_address = value.first;
-    std::string instance_status = value.second;
-
-    // if the status is not empty it means the connection failed
+    // if the error is not empty it means the connection failed
     // so we skip this instance
-    if (!instance_status.empty())
+    if (!probe.error.empty())
       continue;
 
-    shcore::Argument_list session_args;
-    Value::Map_type_ref instance_options(new shcore::Value::Map_type);
-
-    shcore::Value::Map_type_ref connection_data = shcore::get_connection_data(instance_address);
-
-    int instance_port = connection_data->get_int("port");
-    std::string instance_host = connection_data->get_string("host");
-
-    (*instance_options)["host"] = shcore::Value(instance_host);
-    (*instance_options)["port"] = shcore::Value(instance_port);
-    // We assume the root password is the same on all instances
-    (*instance_options)["password"] = shcore::Value(password);
-    (*instance_options)["user"] = shcore::Value(user);
-    session_args.push_back(shcore::Value(instance_options));
-
-    try {
-      log_info("Opening a new session to the instance: %s",
-                instance_address.c_str());
-      session = mysqlsh::connect_session(session_args, mysqlsh::SessionType::Classic);
-      classic = dynamic_cast<mysqlsh::mysql::ClassicSession*>(session.get());
-    } catch (std::exception &e) {
-      throw Exception::runtime_error("Could not open connection to " + instance_address + "");
-    }
+    auto state = probe.value.as_map();
+    if (state->has_key("error"))
+      throw Exception::runtime_error(state->get_string("error"));
 
-    GRInstanceType type = get_gr_instance_type(classic->connection());
-
-    // Close the session
-    session->close(shcore::Argument_list());
+    GRInstanceType type = static_cast<GRInstanceType>(state->get_int("type"));
 
     switch (type) {
       case GRInstanceType::InnoDBCluster:
@@ -1863,11 +2117,12 @@ void Dba::validate_instances_status_reboot_cluster(const shcore::Argument_list &
  * This function is an auxiliary function to be used for the reboot_cluster operation.
  * It verifies which of the online instances of the cluster has the GTID superset.
  * If the current session instance doesn't have the GTID superset, it errors out with that information
- * and includes on the error message the instance with the GTID superset
+ * and includes on the error message the instance with the GTID superset.
+ * The GTID_EXECUTED of the other instances is the one they were probed with, see
+ * get_replicaset_instances_state()
  */
-void Dba::validate_instances_gtid_reboot_cluster(std::string *out_cluster_name,
-                                                 const shcore::Value::Map_type_ref &options,
-                                                 const std::shared_ptr<ShellDevelopmentSession> &instance_session) {
+void Dba::validate_instances_gtid_reboot_cluster(const std::shared_ptr<ShellDevelopmentSession> &instance_session,
+                                                 const std::vector<InstanceProbe> &instances_state) {
   /* GTID verification is done by verifying which instance has the GTID superset.the
    * In order to do so, a union of the global gtid executed and the received transaction
    * set must be done using:
@@ -1889,8 +2144,7 @@ void Dba::validate_instances_gtid_reboot_cluster(std::string *out_cluster_name,
 
   std::pair<std::string, std::string> most_updated_instance;
   mysqlsh::mysql::ClassicSession *classic_current;
-  std::shared_ptr<mysqlsh::ShellDevelopmentSession> session;
-  std::string host, port, active_session_address, user, password;
+  std::string host, port, active_session_address;
 
   // get the current session information
   classic_current = dynamic_cast<mysqlsh::mysql::ClassicSession*>(instance_session.get());
@@ -1902,32 +2156,6 @@ void Dba::validate_instances_gtid_reboot_cluster(std::string *out_cluster_name,
   host = current_session_options->get_string("host");
   active_session_address = host + ":" + port;
 
-  if (options) {
-    shcore::Argument_map opt_map(*options);
-
-    if (opt_map.has_key("password"))
-      password = opt_map.string_at("password");
-    else if (opt_map.has_key("dbPassword"))
-      password = opt_map.string_at("dbPassword");
-    else
-      password = instance_session->get_password();
-
-    if (opt_map.has_key("user"))
-      user = opt_map.string_at("user");
-    else if (opt_map.has_key("dbUser"))
-      user = opt_map.string_at("dbUser");
-    else
-      user = instance_session->get_user();
-
-  } else {
-    user = instance_session->get_user();
-    password = instance_session->get_password();
-  }
-
-  // Get the cluster instances and their status
-  std::vector<std::pair<std::string, std::string>> instances_status =
-        get_replicaset_instances_status(out_cluster_name, options);
-
   // Get @@GLOBAL.GTID_EXECUTED
   std::string gtid_executed_current;
   get_server_variable(classic_current->connection(), "GLOBAL.GTID_EXECUTED", gtid_executed_current);
@@ -1944,56 +2172,22 @@ void Dba::validate_instances_gtid_reboot_cluster(std::string *out_cluster_name,
   // Update most_updated_instance with the current session instance value
   most_updated_instance = std::make_pair(active_session_address, gtid_executed_current);
 
-  for (auto &value : instances_status) {
-    mysqlsh::mysql::ClassicSession *classic;
-    std::string instance_address = value.first;
-    std::string instance_status = value.second;
-
-    // if the status is not empty it means the connection failed
+  for (auto &probe : instances_state) {
+    // if the error is not empty it means the connection failed
     // so we skip this instance
-    if (!instance_status.empty())
+    if (!probe.error.empty())
       continue;
 
-    shcore::Argument_list session_args;
-    Value::Map_type_ref instance_options(new shcore::Value::Map_type);
-
-    shcore::Value::Map_type_ref connection_data = shcore::get_connection_data(instance_address);
-
-    int instance_port = connection_data->get_int("port");
-    std::string instance_host = connection_data->get_string("host");
-
-    (*instance_options)["host"] = shcore::Value(instance_host);
-    (*instance_options)["port"] = shcore::Value(instance_port);
-    // We assume the root password is the same on all instances
-    (*instance_options)["password"] = shcore::Value(password);
-    (*instance_options)["user"] = shcore::Value(user);
-    session_args.push_back(shcore::Value(instance_options));
-
-    // Connect to the instance to obtain the GLOBAL.GTID_EXECUTED
-    try {
-      log_info("Opening a new session to the instance for gtid validations %s",
-                instance_address.c_str());
-      session = mysqlsh::connect_session(session_args, mysqlsh::SessionType::Classic);
-      classic = dynamic_cast<mysqlsh::mysql::ClassicSession*>(session.get());
-    } catch (std::exception &e) {
-      throw Exception::runtime_error("Could not open a connection to " +
-                                      instance_address + ": " + e.what() +
-                                      ".");
-    }
-
-    std::string gtid_executed;
-
-    // Get @@GLOBAL.GTID_EXECUTED
-    get_server_variable(classic->connection(), "GLOBAL.GTID_EXECUTED", gtid_executed);
-
-    // Close the session
-    session->close(shcore::Argument_list());
+    auto state = probe.value.as_map();
+    if (state->has_key("error"))
+      throw Exception::runtime_error(state->get_string("error"));
 
-    std::string msg = "The instance: '" + instance_address + "' GLOBAL.GTID_EXECUTED is: " + gtid_executed;
+    std::string gtid_executed = state->get_string("gtidExecuted");
+    std::string msg = "The instance: '" + probe.address + "' GLOBAL.GTID_EXECUTED is: " + gtid_executed;
     log_info("%s", msg.c_str());
 
     // Add to the pair vector of gtids
-    gtids.emplace_back(instance_address, gtid_executed);
+    gtids.emplace_back(probe.address, gtid_executed);
   }
 
   // Calculate the most up-to-date instance
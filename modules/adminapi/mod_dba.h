@@ -65,6 +65,9 @@ public:
   shcore::Value delete_sandbox_instance(const shcore::Argument_list &args);
   shcore::Value kill_sandbox_instance(const shcore::Argument_list &args);
   shcore::Value start_sandbox_instance(const shcore::Argument_list &args);
+  shcore::Value deploy_sandbox_instances(const shcore::Argument_list &args);
+  shcore::Value start_sandbox_instances(const shcore::Argument_list &args);
+  shcore::Value stop_sandbox_instances(const shcore::Argument_list &args);
   shcore::Value configure_local_instance(const shcore::Argument_list &args);
 
   shcore::Value clone_instance(const shcore::Argument_list &args);
@@ -76,16 +79,19 @@ public:
   shcore::Value drop_metadata_schema(const shcore::Argument_list &args);
 
   shcore::Value reboot_cluster_from_complete_outage(const shcore::Argument_list &args);
+  // Same, with the instances already probed by
+  // get_replicaset_instances_state() so they are not probed again
+  shcore::Value reboot_probed_cluster(const shcore::Argument_list &args,
+                                      const std::vector<InstanceProbe> *probed_state);
 
   shcore::IShell_core* get_owner() { return _shell_core; }
 
-  std::vector<std::pair<std::string, std::string>> get_replicaset_instances_status(std::string *out_cluster_name,
+  std::vector<InstanceProbe> get_replicaset_instances_state(std::string *out_cluster_name,
           const shcore::Value::Map_type_ref &options);
 
-  void validate_instances_status_reboot_cluster(const shcore::Argument_list &args);
-  void validate_instances_gtid_reboot_cluster(std::string *out_cluster_name,
-                                              const shcore::Value::Map_type_ref &options,
-                                              const std::shared_ptr<ShellDevelopmentSession> &instance_session);
+  void validate_instances_status_reboot_cluster(const std::vector<InstanceProbe> &instances_state);
+  void validate_instances_gtid_reboot_cluster(const std::shared_ptr<ShellDevelopmentSession> &instance_session,
+                                              const std::vector<InstanceProbe> &instances_state);
 
 #if DOXYGEN_JS
   Integer verbose;
@@ -98,6 +104,9 @@ public:
   Undefined resetSession(Session session);
   Undefined startSandboxInstance(Integer port, Dictionary options);
   Undefined stopSandboxInstance(Integer port, Dictionary options);
+  List deploySandboxInstances(List ports, Dictionary options);
+  List startSandboxInstances(List ports, Dictionary options);
+  List stopSandboxInstances(List ports, Dictionary options);
   Undefined checkInstanceConfiguration(InstanceDef instance, Dictionary options);
   Instance configureLocalInstance(InstanceDef instance, Dictionary options);
   Undefined rebootClusterFromCompleteOutage(String clusterName, Dictionary options);
@@ -113,6 +122,9 @@ public:
   None reset_session(Session session);
   None start_sandbox_instance(int port, dict options);
   None stop_sandbox_instance(int port, dict options);
+  list deploy_sandbox_instances(list ports, dict options);
+  list start_sandbox_instances(list ports, dict options);
+  list stop_sandbox_instances(list ports, dict options);
   None check_instance_configuration(InstanceDef instance, dict options);
   JSON configure_local_instance(InstanceDef instance, dict options);
   None reboot_cluster_from_complete_outage(str clusterName, dict options);
@@ -131,7 +143,10 @@ private:
   uint64_t _connection_id;
   std::shared_ptr<ProvisioningInterface> _provisioning_interface;
 
-  shcore::Value exec_instance_op(const std::string &function, const shcore::Argument_list &args);
+  static shcore::Value exec_instance_op(const std::string &function, const shcore::Argument_list &args,
+                                        ProvisioningInterface &provisioning);
+  static shcore::Value deploy_instance(const shcore::Argument_list &args, ProvisioningInterface &provisioning);
+  shcore::Value exec_instances_op(const std::string &function, const shcore::Argument_list &args);
   shcore::Value::Map_type_ref _check_instance_configuration(const shcore::Argument_list &args, bool allow_update);
 
   static std::map <std::string, std::shared_ptr<mysqlsh::mysql::ClassicSession> > _session_cache;
@@ -517,7 +517,9 @@ shcore::Value Cluster::describe(const shcore::Argument_list &args) {
 
   shcore::Value ret_val;
   try {
-    if (!_metadata_storage->cluster_exists(_name))
+    // Everything the description needs is read at once
+    auto snapshot = _metadata_storage->get_cluster_snapshot(_name);
+    if (!snapshot->cluster_exists)
       throw Exception::argument_error("The cluster '" + _name + "' no longer exists.");
 
     ret_val = shcore::Value::new_map();
@@ -529,7 +531,7 @@ shcore::Value Cluster::describe(const shcore::Argument_list &args) {
     if (!_default_replica_set)
       (*description)["defaultReplicaSet"] = shcore::Value::Null();
     else
-      (*description)["defaultReplicaSet"] = _default_replica_set->get_description();
+      (*description)["defaultReplicaSet"] = _default_replica_set->get_description(*snapshot);
 
     if (warning) {
       std::string warning = "The instance description may be outdated since was generated from an instance in ";
@@ -581,7 +583,8 @@ shcore::Value Cluster::status(const shcore::Argument_list &args) {
     if (!_default_replica_set)
       (*status)["defaultReplicaSet"] = shcore::Value::Null();
     else
-      (*status)["defaultReplicaSet"] = _default_replica_set->get_status(state);
+      (*status)["defaultReplicaSet"] = _default_replica_set->get_status(state,
+          *_metadata_storage->get_cluster_snapshot(_name));
 
     if (warning) {
       std::string warning = "The instance status may be inaccurate as it was generated from an instance in ";
@@ -19,6 +19,10 @@
 #include <boost/algorithm/string.hpp>
 #include <string>
 #include <algorithm>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
 
 #include "modules/adminapi/mod_dba_common.h"
 #include "utils/utils_general.h"
@@ -585,5 +589,163 @@ void create_cluster_admin_user(std::shared_ptr<mysqlsh::mysql::ClassicSession> s
   }
 }
 
+const std::chrono::milliseconds kInstanceProbeDeadline = std::chrono::seconds(60);
+
+namespace {
+// Shared with the probing threads, which may outlive probe_instances()
+struct ProbeState {
+  std::function<shcore::Value(const std::string &address)> probe;
+  std::vector<InstanceProbe> results;
+  std::vector<bool> done;
+  size_t next;
+  size_t pending;
+  size_t running;
+  bool cancelled;
+  std::mutex mutex;
+  std::condition_variable finished;
+};
+
+void run_probes(std::shared_ptr<ProbeState> state) {
+  for (;;) {
+    size_t index;
+    std::string address;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (state->cancelled || state->next == state->results.size())
+        break;
+      index = state->next++;
+      address = state->results[index].address;
+    }
+
+    shcore::Value value;
+    std::string error;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    try {
+      value = state->probe(address);
+    } catch (std::exception &e) {
+      error = e.what();
+      if (error.empty())
+        error = "Unknown error probing instance";
+    }
+    std::chrono::milliseconds elapsed =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->results[index].value = value;
+    state->results[index].error = error;
+    state->results[index].elapsed = elapsed;
+    state->done[index] = true;
+    if (--state->pending == 0)
+      state->finished.notify_all();
+  }
+
+  // The probes use classic sessions, the client library keeps per thread data
+  mysql_thread_end();
+
+  std::lock_guard<std::mutex> lock(state->mutex);
+  state->running--;
+}
+
+// The threads of the probes still running at their deadline. They are
+// joined once they end, at the latest when the shell exits, so none runs
+// while the process is torn down
+class Lingering_probes {
+public:
+  ~Lingering_probes() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto &batch : _batches)
+      join(&batch.second);
+  }
+
+  void add(std::shared_ptr<ProbeState> state, std::vector<std::thread> *threads) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Only the threads that already ended are joined here
+    for (auto it = _batches.begin(); it != _batches.end();) {
+      bool ended;
+      {
+        std::lock_guard<std::mutex> state_lock(it->first->mutex);
+        ended = it->first->running == 0;
+      }
+      if (ended) {
+        join(&it->second);
+        it = _batches.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    _batches.push_back(std::make_pair(state, std::move(*threads)));
+  }
+
+private:
+  static void join(std::vector<std::thread> *threads) {
+    for (auto &thread : *threads)
+      thread.join();
+  }
+
+  std::mutex _mutex;
+  std::list<std::pair<std::shared_ptr<ProbeState>, std::vector<std::thread>>> _batches;
+};
+
+Lingering_probes lingering_probes;
+
+std::string describe_deadline(std::chrono::milliseconds deadline) {
+  if (deadline.count() % 1000 == 0)
+    return std::to_string(deadline.count() / 1000) + " seconds";
+  return std::to_string(deadline.count()) + " ms";
+}
+}
+
+std::vector<InstanceProbe> probe_instances(const std::vector<std::string> &addresses,
+    const std::function<shcore::Value(const std::string &address)> &probe, size_t max_threads,
+    std::chrono::milliseconds deadline) {
+  std::shared_ptr<ProbeState> state(new ProbeState());
+  state->probe = probe;
+  state->next = 0;
+  state->pending = addresses.size();
+  state->cancelled = false;
+  state->done.resize(addresses.size(), false);
+  for (auto &address : addresses) {
+    InstanceProbe result;
+    result.address = address;
+    result.elapsed = std::chrono::milliseconds(0);
+    state->results.push_back(result);
+  }
+
+  size_t count = std::min(std::max(max_threads, static_cast<size_t>(1)), addresses.size());
+  state->running = count;
+  std::vector<std::thread> threads;
+  for (size_t index = 0; index < count; index++)
+    threads.push_back(std::thread(run_probes, state));
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  bool all_done = state->finished.wait_for(lock, deadline, [&state]() { return state->pending == 0; });
+
+  std::vector<InstanceProbe> results(state->results);
+  for (size_t index = 0; index < results.size(); index++) {
+    if (!state->done[index]) {
+      results[index].error = "Timeout probing the instance after " + describe_deadline(deadline);
+      results[index].elapsed = deadline;
+      log_warning("%s: %s", results[index].address.c_str(), results[index].error.c_str());
+    }
+  }
+
+  // Nothing else is started after the deadline
+  state->cancelled = true;
+  lock.unlock();
+
+  // The threads have nothing left to probe and end right away, unless some
+  // probe is still running
+  if (all_done) {
+    for (auto &thread : threads)
+      thread.join();
+  } else {
+    lingering_probes.add(state, &threads);
+  }
+
+  return results;
+}
+
 } // dba
 } // mysqlsh
@@ -20,6 +20,9 @@
 #ifndef _MODULES_ADMINAPI_MOD_DBA_COMMON_
 #define _MODULES_ADMINAPI_MOD_DBA_COMMON_
 
+#include <chrono>
+#include <functional>
+
 #include "shellcore/types.h"
 #include "shellcore/lang_base.h"
 #include "modules/mod_mysql_session.h"
@@ -122,6 +125,27 @@ bool validate_cluster_admin_user_privileges(std::shared_ptr<mysqlsh::mysql::Clas
     const std::string &admin_user, const std::string &admin_host);
 void create_cluster_admin_user(std::shared_ptr<mysqlsh::mysql::ClassicSession> session,
     const std::string &username, const std::string &password);
+
+// The outcome of probing an instance: what the probe returned or, if it
+// failed, its error, and how long the probe took
+struct InstanceProbe {
+  std::string address;
+  shcore::Value value;
+  std::string error;
+  std::chrono::milliseconds elapsed;
+};
+
+extern const std::chrono::milliseconds kInstanceProbeDeadline;
+
+// Runs probe on every instance concurrently, with up to max_threads at once,
+// so unreachable instances do not add up their connect timeouts. Probes still
+// running when the deadline expires are reported as failed and are left to
+// finish on their own, so probe must not refer to the caller's locals: their
+// threads are joined once they end, at the latest when the shell exits.
+// The results are in the order of the addresses
+std::vector<InstanceProbe> probe_instances(const std::vector<std::string> &addresses,
+    const std::function<shcore::Value(const std::string &address)> &probe, size_t max_threads = 8,
+    std::chrono::milliseconds deadline = kInstanceProbeDeadline);
 }
 }
 #endif
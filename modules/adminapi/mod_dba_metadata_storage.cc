@@ -26,8 +26,11 @@
 #include "modules/mysql_connection.h"
 #include "mysqlx_connection.h" // for error codes
 
+#include "shellcore/shell_core_options.h"
 #include "utils/utils_file.h"
 #include "utils/utils_general.h"
+#include <boost/algorithm/string/predicate.hpp>
+#include <cctype>
 #include <random>
 
 #define PASSWORD_LENGTH 16
@@ -39,6 +42,16 @@ using namespace mysqlsh;
 using namespace mysqlsh::dba;
 using namespace shcore;
 
+// Whether sql can't change the metadata
+static bool is_read_statement(const std::string &sql) {
+  size_t start = 0;
+  while (start < sql.size() && std::isspace(static_cast<unsigned char>(sql[start])))
+    start++;
+
+  std::string statement = sql.substr(start, 6);
+  return boost::istarts_with(statement, "select") || boost::istarts_with(statement, "show");
+}
+
 MetadataStorage::MetadataStorage(Dba* dba) :
 _dba(dba) {}
 
@@ -59,6 +72,9 @@ std::shared_ptr<mysql::ClassicResult> MetadataStorage::execute_sql(const std::st
   int retry_count = kMaxReadOnlyRetries;
   while (retry_count > 0) {
     try {
+      if (!_snapshots.empty() && !is_read_statement(sql))
+        invalidate_snapshots();
+
       ret_val = session->execute_sql(sql, shcore::Argument_list());
 
       // If reached here it means there were no errors
@@ -86,6 +102,130 @@ std::shared_ptr<mysql::ClassicResult> MetadataStorage::execute_sql(const std::st
   return ret_val.as_object<mysql::ClassicResult>();
 }
 
+// 1 or 0 from the value of group_replication_single_primary_mode
+static shcore::Value single_primary_value(const shcore::Value &mode) {
+  return shcore::Value(mode.as_string() == "ON" || mode.as_string() == "1" ? 1 : 0);
+}
+
+std::shared_ptr<ClusterSnapshot> MetadataStorage::get_cluster_snapshot(const std::string &cluster_name) const {
+  auto session = _dba->get_active_session();
+  if (!session)
+    throw Exception::metadata_error("The Metadata is inaccessible");
+
+  std::string key = session->uri() + "|" + cluster_name;
+  int64_t ttl = shcore::Shell_core_options::get()->get_int(SHCORE_METADATA_CACHE_TTL, 0);
+  auto now = std::chrono::steady_clock::now();
+
+  // Only the metadata rows are reused, the group state is read again so a
+  // member leaving the group is seen right away
+  if (ttl > 0) {
+    auto cached = _snapshots.find(key);
+    if (cached != _snapshots.end() && now - cached->second->loaded < std::chrono::seconds(ttl)) {
+      std::shared_ptr<ClusterSnapshot> snapshot(new ClusterSnapshot(*cached->second));
+      load_group_state(snapshot.get());
+      return snapshot;
+    }
+  }
+
+  // The row of the constant table is there even if the cluster does not
+  // exist or has no instances
+  shcore::sqlstring query("SELECT c.cluster_id, i.replicaset_id, i.mysql_server_uuid, i.instance_name, i.role, "
+                          "m.MEMBER_STATE, JSON_UNQUOTE(JSON_EXTRACT(i.addresses, \"$.mysqlClassic\")) AS host, "
+                          "(SELECT VARIABLE_VALUE FROM performance_schema.global_variables "
+                          "WHERE VARIABLE_NAME = 'group_replication_single_primary_mode') AS single_primary_mode, "
+                          "(SELECT VARIABLE_VALUE FROM performance_schema.global_status "
+                          "WHERE VARIABLE_NAME = 'group_replication_primary_member') AS primary_member "
+                          "FROM (SELECT 1) AS snapshot "
+                          "LEFT JOIN mysql_innodb_cluster_metadata.clusters c ON c.cluster_name = ? "
+                          "LEFT JOIN mysql_innodb_cluster_metadata.replicasets r ON r.cluster_id = c.cluster_id "
+                          "LEFT JOIN mysql_innodb_cluster_metadata.instances i ON i.replicaset_id = r.replicaset_id "
+                          "LEFT JOIN performance_schema.replication_group_members m ON i.mysql_server_uuid = m.MEMBER_ID "
+                          "ORDER BY i.instance_id", 0);
+  query << cluster_name;
+  query.done();
+
+  std::shared_ptr<ClusterSnapshot> snapshot(new ClusterSnapshot());
+  snapshot->cluster_exists = false;
+  snapshot->single_primary_mode = shcore::Value::Null();
+  snapshot->loaded = now;
+
+  auto result = execute_sql(query);
+  auto row = result->fetch_one();
+  while (row) {
+    if (row->get_value(0))
+      snapshot->cluster_exists = true;
+
+    shcore::Value mode = row->get_value(7);
+    if (mode)
+      snapshot->single_primary_mode = single_primary_value(mode);
+
+    shcore::Value primary = row->get_value(8);
+    if (primary)
+      snapshot->primary_member = primary.as_string();
+
+    if (row->get_value(2)) {
+      ClusterSnapshot::Instance instance;
+      instance.replicaset_id = row->get_value(1).as_uint();
+      instance.uuid = row->get_value(2).as_string();
+      instance.label = row->get_value(3).as_string();
+      instance.role = row->get_value(4).as_string();
+      instance.member_state = row->get_value(5);
+      instance.address = row->get_value(6).as_string();
+      snapshot->instances.push_back(instance);
+    }
+
+    row = result->fetch_one();
+  }
+
+  if (ttl > 0)
+    _snapshots[key] = std::shared_ptr<ClusterSnapshot>(new ClusterSnapshot(*snapshot));
+
+  return snapshot;
+}
+
+// Reads the group members and the group variables into a snapshot whose
+// metadata rows were reused
+void MetadataStorage::load_group_state(ClusterSnapshot *snapshot) const {
+  snapshot->single_primary_mode = shcore::Value::Null();
+  snapshot->primary_member.clear();
+  for (auto &instance : snapshot->instances)
+    instance.member_state = shcore::Value::Null();
+
+  // As for the snapshot, the row of the constant table is there even if
+  // there are no members
+  auto result = execute_sql("SELECT m.MEMBER_ID, m.MEMBER_STATE, "
+                            "(SELECT VARIABLE_VALUE FROM performance_schema.global_variables "
+                            "WHERE VARIABLE_NAME = 'group_replication_single_primary_mode') AS single_primary_mode, "
+                            "(SELECT VARIABLE_VALUE FROM performance_schema.global_status "
+                            "WHERE VARIABLE_NAME = 'group_replication_primary_member') AS primary_member "
+                            "FROM (SELECT 1) AS live "
+                            "LEFT JOIN performance_schema.replication_group_members m ON TRUE");
+  auto row = result->fetch_one();
+  while (row) {
+    shcore::Value mode = row->get_value(2);
+    if (mode)
+      snapshot->single_primary_mode = single_primary_value(mode);
+
+    shcore::Value primary = row->get_value(3);
+    if (primary)
+      snapshot->primary_member = primary.as_string();
+
+    shcore::Value member = row->get_value(0);
+    if (member) {
+      for (auto &instance : snapshot->instances) {
+        if (instance.uuid == member.as_string())
+          instance.member_state = row->get_value(1);
+      }
+    }
+
+    row = result->fetch_one();
+  }
+}
+
+void MetadataStorage::invalidate_snapshots() const {
+  _snapshots.clear();
+}
+
 void MetadataStorage::start_transaction() {
   auto session = _dba->get_active_session();
   session->start_transaction();
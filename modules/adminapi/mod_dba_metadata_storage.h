@@ -23,13 +23,37 @@
 #include "mod_dba.h"
 #include "mod_dba_cluster.h"
 #include "mod_dba_replicaset.h"
+#include <chrono>
+#include <map>
 #include <string>
+#include <vector>
 
 namespace mysqlsh {
 namespace mysql {
 class ClassicResult;
 }
 namespace dba {
+// What Cluster.status() and describe() need from the metadata and the group,
+// read with a single query instead of a round trip for each piece of it
+struct ClusterSnapshot {
+  struct Instance {
+    uint64_t replicaset_id;
+    std::string uuid;
+    std::string label;
+    std::string role;
+    std::string address;
+    shcore::Value member_state;  // Null if the instance is not on the group
+  };
+
+  bool cluster_exists;
+  // In the order they were added to the metadata
+  std::vector<Instance> instances;
+  // 1 or 0, Null if it could not be read, i.e. group replication is not loaded
+  shcore::Value single_primary_mode;
+  std::string primary_member;
+  std::chrono::steady_clock::time_point loaded;
+};
+
 #if DOXYGEN_CPP
 /**
 * Represents a Session to a Metadata Storage
@@ -78,6 +102,13 @@ public:
 
   std::shared_ptr<mysql::ClassicResult> execute_sql(const std::string &sql, bool retry = false, const std::string &log_sql = "") const;
 
+  // Loads the snapshot of a cluster. The metadata rows loaded from the same
+  // session within the last metadataCacheTtl seconds (a shell option, 0 by
+  // default) are reused, the group state is always read. Statements other
+  // than reads discard the reusable snapshots
+  std::shared_ptr<ClusterSnapshot> get_cluster_snapshot(const std::string &cluster_name) const;
+  void invalidate_snapshots() const;
+
   class Transaction {
   public:
     explicit Transaction(std::shared_ptr<MetadataStorage> md) : _md(md) {
@@ -99,6 +130,9 @@ public:
   };
 private:
   Dba* _dba;
+  mutable std::map<std::string, std::shared_ptr<ClusterSnapshot>> _snapshots;
+
+  void load_group_state(ClusterSnapshot *snapshot) const;
 
   void start_transaction();
   void commit();
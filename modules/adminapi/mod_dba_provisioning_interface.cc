@@ -17,6 +17,7 @@
  * 02110-1301  USA
  */
 
+#include <cstdlib>
 #include <string>
 #include <vector>
 #include <system_error>
@@ -29,6 +30,9 @@
 
 static const char *kRequiredMySQLProvisionInterfaceVersion = "2.0";
 
+// The record the worker writes after the output of each command
+static const std::string k_exit_record = "{\"type\": \"EXIT\", \"exit_code\": ";
+
 using namespace mysqlsh;
 using namespace mysqlsh::dba;
 using namespace shcore;
@@ -36,14 +40,14 @@ using namespace shcore;
 ProvisioningInterface::ProvisioningInterface(shcore::Interpreter_delegate* deleg) :
 _verbose(0), _delegate(deleg) {}
 
-ProvisioningInterface::~ProvisioningInterface() {}
+ProvisioningInterface::~ProvisioningInterface() {
+  stop_worker();
+}
 
 int ProvisioningInterface::execute_mysqlprovision(const std::string &cmd, const std::vector<const char *> &args,
                                      const std::vector<std::string> &passwords,
                                      shcore::Value::Array_type_ref &errors, int verbose) {
   std::vector<const char *> args_script;
-  std::string buf;
-  char c;
   int exit_code = 0;
   std::string full_output;
 
@@ -107,121 +111,33 @@ int ProvisioningInterface::execute_mysqlprovision(const std::string &cmd, const
     _delegate->print(_delegate->user_data, header.c_str());
   }
 
-  std::string format = (*Shell_core_options::get())[SHCORE_OUTPUT_FORMAT].as_string();
-  std::string stage_action;
-
-  ngcommon::Process_launcher p(args_script[0], &args_script[0]);
-  try {
-    stage_action = "starting";
-    p.start();
+  if ((*Shell_core_options::get())[SHCORE_PROVISIONING_WORKER].as_bool()) {
+    exit_code = execute_on_worker(args_script, passwords, errors, verbose, &full_output);
+  } else {
+    std::string stage_action;
 
-    if (!passwords.empty()) {
-      stage_action = "executing";
-      for (size_t i = 0; i < passwords.size(); i++) {
-        p.write(passwords[i].c_str(), passwords[i].length());
-      }
-    }
+    ngcommon::Process_launcher p(args_script[0], &args_script[0]);
+    try {
+      stage_action = "starting";
+      p.start();
 
-    stage_action = "reading from";
-
-    bool last_closed = false;
-    bool json_started = false;
-    while (p.read(&c, 1) > 0) {
-      // Ignores the initial output (most likely prompts)
-      // Until the first { is found, indicating the start of JSON data
-      if (!json_started) {
-        if (c == '{') {
-          json_started = true;
-
-          // Prints any initial data
-          if (!buf.empty() && verbose)
-            _delegate->print(_delegate->user_data, buf.c_str());
-
-          buf.clear();
-        } else {
-          buf += c;
-          continue;
+      if (!passwords.empty()) {
+        stage_action = "executing";
+        for (size_t i = 0; i < passwords.size(); i++) {
+          p.write(passwords[i].c_str(), passwords[i].length());
         }
       }
 
-      if (c == '\n') {
-        // TODO: We may need to also filter other messages about
-        //       password retrieval
-
-        if (last_closed) {
-          shcore::Value raw_data;
-          try {
-            raw_data = shcore::Value::parse(buf);
-          } catch (shcore::Exception &e) {
-            std::string error = e.what();
-            error += ": ";
-            error += buf;
-
-            // Prints the bad formatted buffer, instead of trowing an exception and aborting
-            // This is because despite the problam parsing the MP output
-            // The work may have been completed there.
-            _delegate->print(_delegate->user_data, buf.c_str());
-            //throw shcore::Exception::parser_error(error);
-
-            log_error("DBA: mysqlprovision: %s", error.c_str());
-          }
-
-          if (raw_data && raw_data.type == shcore::Map) {
-            auto data = raw_data.as_map();
-
-            std::string type = data->get_string("type");
-            std::string info;
-
-            if (type == "WARNING" || type == "ERROR") {
-              if (!errors)
-                errors.reset(new shcore::Value::Array_type());
-
-              errors->push_back(raw_data);
-              info = type + ": ";
-            } else if (type == "DEBUG") {
-              info = type + ": ";
-            }
-
-            info += data->get_string("msg") + "\n";
-
-            if (verbose && info.find("Enter the password for") == std::string::npos) {
-              if (format.find("json") == std::string::npos)
-                _delegate->print(_delegate->user_data, info.c_str());
-              else
-                _delegate->print_value(_delegate->user_data, raw_data, "mysqlprovision");
-            }
-          }
-
-          log_debug("DBA: mysqlprovision: %s", buf.c_str());
-
-          full_output.append(buf);
-          buf = "";
-        } else
-          buf += c;
-      } else if (c == '\r') {
-        buf += c;
-      } else {
-        buf += c;
-
-        last_closed = c == '}';
-      }
+      stage_action = "reading from";
+      read_output(p, errors, verbose, &full_output, nullptr);
+      stage_action = "terminating";
+    } catch (const std::system_error &e) {
+      log_warning("DBA: %s while %s mysqlprovision", e.what(), stage_action.c_str());
     }
 
-    if (!buf.empty()) {
-      if (verbose)
-        _delegate->print(_delegate->user_data, buf.c_str());
-
-      log_debug("DBA: mysqlprovision: %s", buf.c_str());
-
-      full_output.append(buf);
-    }
-    stage_action = "terminating";
-  } catch (const std::system_error &e) {
-    log_warning("DBA: %s while %s mysqlprovision", e.what(), stage_action.c_str());
+    exit_code = p.wait();
   }
 
-  exit_code = p.wait();
-
   if (verbose) {
     std::string footer(78, '=');
     footer.append("\n");
@@ -261,6 +177,192 @@ int ProvisioningInterface::execute_mysqlprovision(const std::string &cmd, const
 }
 
 
+/*
+ * Reads the output of mysqlprovision, handling the log records as they come.
+ * When exit_code is given the output is read from the worker, up to the
+ * record with the exit code of the command; returns false if the output
+ * ended before it, which means the worker died.
+ */
+bool ProvisioningInterface::read_output(ngcommon::Process_launcher &p, shcore::Value::Array_type_ref &errors,
+                                        int verbose, std::string *full_output, int *exit_code) {
+  std::string format = (*Shell_core_options::get())[SHCORE_OUTPUT_FORMAT].as_string();
+  bool found_exit = false;
+
+  // The output is split in records as it is read, in blocks
+  ngcommon::Json_record_splitter splitter;
+  std::string output, record;
+  while (!found_exit && p.read_available(&output) > 0) {
+    splitter.append(output.data(), output.size());
+    output.clear();
+
+    // Prints the output before the JSON data, most likely prompts
+    std::string preamble;
+    if (splitter.take_preamble(&preamble)) {
+      if (verbose)
+        _delegate->print(_delegate->user_data, preamble.c_str());
+
+      full_output->append(preamble);
+    }
+
+    // TODO: We may need to also filter other messages about
+    //       password retrieval
+    while (splitter.next_record(&record)) {
+      // The worker ends the output of each command with its exit code
+      if (exit_code && record.compare(0, k_exit_record.size(), k_exit_record) == 0) {
+        *exit_code = std::atoi(record.c_str() + k_exit_record.size());
+        found_exit = true;
+        break;
+      }
+
+      shcore::Value raw_data;
+      try {
+        raw_data = shcore::Value::parse(record);
+      } catch (shcore::Exception &e) {
+        std::string error = e.what();
+        error += ": ";
+        error += record;
+
+        // Prints the bad formatted buffer, instead of trowing an exception and aborting
+        // This is because despite the problam parsing the MP output
+        // The work may have been completed there.
+        _delegate->print(_delegate->user_data, record.c_str());
+        //throw shcore::Exception::parser_error(error);
+
+        log_error("DBA: mysqlprovision: %s", error.c_str());
+      }
+
+      if (raw_data && raw_data.type == shcore::Map) {
+        auto data = raw_data.as_map();
+
+        std::string type = data->get_string("type");
+        std::string info;
+
+        if (type == "WARNING" || type == "ERROR") {
+          if (!errors)
+            errors.reset(new shcore::Value::Array_type());
+
+          errors->push_back(raw_data);
+          info = type + ": ";
+        } else if (type == "DEBUG") {
+          info = type + ": ";
+        }
+
+        info += data->get_string("msg") + "\n";
+
+        if (verbose && info.find("Enter the password for") == std::string::npos) {
+          if (format.find("json") == std::string::npos)
+            _delegate->print(_delegate->user_data, info.c_str());
+          else
+            _delegate->print_value(_delegate->user_data, raw_data, "mysqlprovision");
+        }
+      }
+
+      log_debug("DBA: mysqlprovision: %s", record.c_str());
+
+      full_output->append(record);
+    }
+  }
+
+  const std::string &buf = splitter.remaining();
+  if (!buf.empty()) {
+    if (verbose)
+      _delegate->print(_delegate->user_data, buf.c_str());
+
+    log_debug("DBA: mysqlprovision: %s", buf.c_str());
+
+    full_output->append(buf);
+  }
+
+  return found_exit;
+}
+
+int ProvisioningInterface::execute_on_worker(const std::vector<const char *> &args,
+                                             const std::vector<std::string> &passwords,
+                                             shcore::Value::Array_type_ref &errors, int verbose,
+                                             std::string *full_output) {
+  // The request holds the command line, without the program name, and the
+  // input of the command: the passwords
+  shcore::Value::Array_type_ref command_line(new shcore::Value::Array_type());
+  for (size_t index = 1; index < args.size() && args[index]; index++)
+    command_line->push_back(shcore::Value(args[index]));
+
+  std::string input;
+  for (auto &password : passwords)
+    input.append(password);
+
+  shcore::Value::Map_type_ref request(new shcore::Value::Map_type());
+  (*request)["args"] = shcore::Value(command_line);
+  (*request)["input"] = shcore::Value(input);
+
+  // A worker that died since the last command is replaced
+  std::string line = shcore::Value(request).json() + "\n";
+  if (!send_to_worker(line)) {
+    stop_worker();
+    if (!send_to_worker(line)) {
+      int exit_code = _worker ? _worker->wait() : 1;
+      stop_worker();
+      return exit_code;
+    }
+  }
+
+  int exit_code = 0;
+  try {
+    if (!read_output(*_worker, errors, verbose, full_output, &exit_code)) {
+      exit_code = _worker->wait();
+      log_warning("DBA: mysqlprovision worker exited with code %d", exit_code);
+      stop_worker();
+    }
+  } catch (const std::system_error &e) {
+    log_warning("DBA: %s while reading from mysqlprovision worker", e.what());
+    stop_worker();
+    exit_code = 1;
+  }
+
+  return exit_code;
+}
+
+bool ProvisioningInterface::send_to_worker(const std::string &request) {
+  try {
+    if (!_worker) {
+      _worker_args = {_local_mysqlprovision_path.c_str(), "--worker", NULL};
+      std::unique_ptr<ngcommon::Process_launcher> worker(
+          new ngcommon::Process_launcher(_worker_args[0], &_worker_args[0]));
+      worker->start();
+      _worker = std::move(worker);
+      log_info("DBA: mysqlprovision: Started worker process %llu",
+               static_cast<unsigned long long>(_worker->get_pid()));
+    }
+
+    // Nothing is written once the worker is gone
+    size_t written = 0;
+    while (written < request.size()) {
+      int count = _worker->write(request.data() + written, request.size() - written);
+      if (count <= 0)
+        return false;
+
+      written += count;
+    }
+  } catch (const std::system_error &e) {
+    log_warning("DBA: %s while sending a command to mysqlprovision worker", e.what());
+    return false;
+  }
+
+  return true;
+}
+
+// The worker ends when its stdin is closed, so it is never signaled: it may
+// already be reaped by wait() and its process id reused
+void ProvisioningInterface::stop_worker() {
+  if (_worker) {
+    try {
+      _worker->finish();
+    } catch (const std::system_error &e) {
+      log_warning("DBA: %s while stopping mysqlprovision worker", e.what());
+    }
+    _worker.reset();
+  }
+}
+
 void ProvisioningInterface::set_ssl_args(const std::string &prefix,
                                          const shcore::Value::Map_type_ref &instance_ssl,
                                          std::vector<const char *> &args){
@@ -20,6 +20,7 @@
 #ifndef MODULES_ADMINAPI_MOD_DBA_PROVISIONING_INTERFACE_H_
 #define MODULES_ADMINAPI_MOD_DBA_PROVISIONING_INTERFACE_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -28,6 +29,10 @@
 #include "shellcore/shell_core_options.h"
 #include "shellcore/lang_base.h"
 
+namespace ngcommon {
+class Process_launcher;
+}
+
 namespace mysqlsh {
 namespace dba {
 #if DOXYGEN_CPP
@@ -89,9 +94,20 @@ private:
   shcore::Interpreter_delegate *_delegate;
   std::string _local_mysqlprovision_path;
 
+  // The mysqlprovision process running the commands when the
+  // provisioningWorker option is enabled, started on first use
+  std::unique_ptr<ngcommon::Process_launcher> _worker;
+  std::vector<const char *> _worker_args;
+
   int execute_mysqlprovision(const std::string &cmd, const std::vector<const char *> &args,
                 const std::vector<std::string> &passwords,
                 shcore::Value::Array_type_ref &errors, int verbose);
+  int execute_on_worker(const std::vector<const char *> &args, const std::vector<std::string> &passwords,
+                        shcore::Value::Array_type_ref &errors, int verbose, std::string *full_output);
+  bool send_to_worker(const std::string &request);
+  void stop_worker();
+  bool read_output(ngcommon::Process_launcher &p, shcore::Value::Array_type_ref &errors, int verbose,
+                   std::string *full_output, int *exit_code);
   int exec_sandbox_op(const std::string &op, int port, int portx, const std::string &sandbox_dir,
                      const std::string &password,
                      const std::vector<std::string> &extra_args,
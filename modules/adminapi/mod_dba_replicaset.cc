@@ -40,6 +40,7 @@
 #include "logger/logger.h"
 #include "utils/utils_sqlstring.h"
 
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 #include <iomanip>
@@ -86,14 +87,14 @@ std::string &ReplicaSet::append_descr(std::string &s_out, int UNUSED(indent), in
 }
 
 static void append_member_status(const shcore::Value::Map_type_ref& node,
-                                 std::shared_ptr<mysqlsh::Row> member_row,
+                                 const ClusterSnapshot::Instance &instance,
                                  bool read_write,
                                  bool active_session_instance) {
-  (*node)["address"] = member_row->get_member(4);
+  (*node)["address"] = shcore::Value(instance.address);
 
-  auto status = member_row->get_member(3);
+  auto status = instance.member_state;
   (*node)["status"] = status ? status : shcore::Value("(MISSING)");
-  (*node)["role"] = member_row->get_member(2);
+  (*node)["role"] = shcore::Value(instance.role);
   (*node)["mode"] = shcore::Value(read_write ? "R/W" : "R/O");
 }
 
@@ -155,6 +156,10 @@ void ReplicaSet::verify_topology_type_change() const {
   get_server_variable(classic->connection(),
                       "group_replication_single_primary_mode", gr_primary_mode);
 
+  verify_topology_type_change(gr_primary_mode);
+}
+
+void ReplicaSet::verify_topology_type_change(int gr_primary_mode) const {
   // Check if the topology type matches the real settings used by the
   // cluster instance, otherwise an error is issued.
   // NOTE: The GR primary mode is guaranteed (by GR) to be the same for all
@@ -1144,7 +1149,12 @@ shcore::Value::Map_type_ref ReplicaSet::_rescan(const shcore::Argument_list &arg
   // Set the ReplicaSet name on the result map
   (*ret_val)["name"] = shcore::Value(_name);
 
-  std::vector<NewInstanceInfo> newly_discovered_instances_list = get_newly_discovered_instances();
+  // The group and metadata members are read once for both lists
+  std::vector<std::string> instances_gr_array = get_instances_gr();
+  std::vector<std::string> instances_md_array = get_instances_md();
+
+  std::vector<NewInstanceInfo> newly_discovered_instances_list =
+      get_newly_discovered_instances(instances_gr_array, instances_md_array);
 
   // Creates the newlyDiscoveredInstances map
   shcore::Value::Array_type_ref newly_discovered_instances(new shcore::Value::Array_type());
@@ -1164,7 +1174,8 @@ shcore::Value::Map_type_ref ReplicaSet::_rescan(const shcore::Argument_list &arg
 
   shcore::Value unavailable_instances_result;
 
-  std::vector<MissingInstanceInfo> unavailable_instances_list = get_unavailable_instances();
+  std::vector<MissingInstanceInfo> unavailable_instances_list =
+      get_unavailable_instances(instances_gr_array, instances_md_array);
 
   // Creates the unavailableInstances array
   shcore::Value::Array_type_ref unavailable_instances(new shcore::Value::Array_type());
@@ -1397,6 +1408,9 @@ std::vector<std::string> ReplicaSet::get_instances_gr() {
     instances_gr_array.push_back(row->get_member(0).as_string());
   }
 
+  // Sorted, to be compared with the metadata ones
+  std::sort(instances_gr_array.begin(), instances_gr_array.end());
+
   return instances_gr_array;
 }
 
@@ -1434,16 +1448,18 @@ std::vector<std::string> ReplicaSet::get_instances_md() {
     instances_md_array.push_back(row->get_member(0).as_string());
   }
 
+  // Sorted, to be compared with the group ones
+  std::sort(instances_md_array.begin(), instances_md_array.end());
+
   return instances_md_array;
 }
 
 std::vector<ReplicaSet::NewInstanceInfo> ReplicaSet::get_newly_discovered_instances() {
-  std::vector<std::string> instances_gr_array, instances_md_array;
-  std::string query;
-
-  instances_gr_array = get_instances_gr();
-  instances_md_array = get_instances_md();
+  return get_newly_discovered_instances(get_instances_gr(), get_instances_md());
+}
 
+std::vector<ReplicaSet::NewInstanceInfo> ReplicaSet::get_newly_discovered_instances(
+    const std::vector<std::string> &instances_gr_array, const std::vector<std::string> &instances_md_array) {
   // Check the differences between the two lists
   std::vector<std::string> new_members;
 
@@ -1453,32 +1469,42 @@ std::vector<ReplicaSet::NewInstanceInfo> ReplicaSet::get_newly_discovered_instan
                       instances_md_array.end(), std::inserter(new_members, new_members.begin()));
 
   std::vector<NewInstanceInfo> ret;
-  for (auto i : new_members) {
-    shcore::sqlstring query("SELECT MEMBER_ID, MEMBER_HOST, MEMBER_PORT " \
-                            "FROM performance_schema.replication_group_members " \
-                            "WHERE MEMBER_ID = ?", 0);
+  if (new_members.empty())
+    return ret;
+
+  // All the members are fetched at once instead of a query for each of them
+  std::string placeholders("?");
+  for (size_t index = 1; index < new_members.size(); index++)
+    placeholders.append(", ?");
+
+  shcore::sqlstring query(("SELECT MEMBER_ID, MEMBER_HOST, MEMBER_PORT " \
+                           "FROM performance_schema.replication_group_members " \
+                           "WHERE MEMBER_ID IN (" + placeholders + ") ORDER BY MEMBER_ID").c_str(), 0);
+  for (auto i : new_members)
     query << i;
-    query.done();
-
-    auto result = _metadata_storage->execute_sql(query);
-    auto row = result->fetch_one();
+  query.done();
 
+  auto result = _metadata_storage->execute_sql(query);
+  auto row = result->fetch_one();
+  while (row) {
     NewInstanceInfo info;
     info.member_id = row->get_value(0).as_string();
     info.host = row->get_value(1).as_string();
     info.port = row->get_value(2).as_int();
     ret.push_back(info);
+
+    row = result->fetch_one();
   }
 
   return ret;
 }
 
 std::vector<ReplicaSet::MissingInstanceInfo> ReplicaSet::get_unavailable_instances() {
-  std::vector<std::string> instances_gr_array, instances_md_array;
-
-  instances_gr_array = get_instances_gr();
-  instances_md_array = get_instances_md();
+  return get_unavailable_instances(get_instances_gr(), get_instances_md());
+}
 
+std::vector<ReplicaSet::MissingInstanceInfo> ReplicaSet::get_unavailable_instances(
+    const std::vector<std::string> &instances_gr_array, const std::vector<std::string> &instances_md_array) {
   // Check the differences between the two lists
   std::vector<std::string> removed_members;
 
@@ -1488,21 +1514,32 @@ std::vector<ReplicaSet::MissingInstanceInfo> ReplicaSet::get_unavailable_instanc
                       instances_gr_array.end(), std::inserter(removed_members, removed_members.begin()));
 
   std::vector<MissingInstanceInfo> ret;
-  for (auto i : removed_members) {
-    shcore::sqlstring query("SELECT mysql_server_uuid, instance_name, " \
-                            "JSON_UNQUOTE(JSON_EXTRACT(addresses, \"$.mysqlClassic\")) AS host " \
-                            "FROM mysql_innodb_cluster_metadata.instances " \
-                            "WHERE mysql_server_uuid = ?", 0);
+  if (removed_members.empty())
+    return ret;
+
+  // All the members are fetched at once instead of a query for each of them
+  std::string placeholders("?");
+  for (size_t index = 1; index < removed_members.size(); index++)
+    placeholders.append(", ?");
+
+  shcore::sqlstring query(("SELECT mysql_server_uuid, instance_name, " \
+                           "JSON_UNQUOTE(JSON_EXTRACT(addresses, \"$.mysqlClassic\")) AS host " \
+                           "FROM mysql_innodb_cluster_metadata.instances " \
+                           "WHERE mysql_server_uuid IN (" + placeholders + ") ORDER BY mysql_server_uuid").c_str(), 0);
+  for (auto i : removed_members)
     query << i;
-    query.done();
+  query.done();
 
-    auto result = _metadata_storage->execute_sql(query);
-    auto row = result->fetch_one();
+  auto result = _metadata_storage->execute_sql(query);
+  auto row = result->fetch_one();
+  while (row) {
     MissingInstanceInfo info;
     info.id = row->get_value(0).as_string();
     info.label = row->get_value(1).as_string();
     info.host = row->get_value(2).as_string();
     ret.push_back(info);
+
+    row = result->fetch_one();
   }
 
   return ret;
@@ -1703,37 +1740,25 @@ ReplicationGroupState ReplicaSet::check_preconditions(const std::string& functio
   return check_function_preconditions(class_name(), function_name, get_function_name(function_name), _metadata_storage);
 }
 
-shcore::Value ReplicaSet::get_description() const {
+shcore::Value ReplicaSet::get_description(const ClusterSnapshot &snapshot) const {
   shcore::Value ret_val = shcore::Value::new_map();
   auto description = ret_val.as_map();
 
-  shcore::sqlstring query("SELECT mysql_server_uuid, instance_name, role, " \
-                          "JSON_UNQUOTE(JSON_EXTRACT(addresses, \"$.mysqlClassic\")) AS host "
-                          "FROM mysql_innodb_cluster_metadata.instances "
-                          "WHERE replicaset_id = ?", 0);
-  query << _id;
-  query.done();
-
-  auto result = _metadata_storage->execute_sql(query);
-
-  auto raw_instances = result->call("fetchAll", shcore::Argument_list());
-
-  // First we identify the master instance
-  auto instances = raw_instances.as_array();
-
   (*description)["name"] = shcore::Value(_name);
   (*description)["instances"] = shcore::Value::new_array();
 
   auto instance_list = description->get_array("instances");
 
-  for (auto value : *instances.get()) {
-    auto row = value.as_object<mysqlsh::Row>();
+  for (auto &member : snapshot.instances) {
+    if (member.replicaset_id != _id)
+      continue;
+
     auto instance = shcore::Value::new_map();
     auto instance_obj = instance.as_map();
 
-    (*instance_obj)["label"] = row->get_member(1);
-    (*instance_obj)["host"] = row->get_member(3);
-    (*instance_obj)["role"] = row->get_member(2);
+    (*instance_obj)["label"] = shcore::Value(member.label);
+    (*instance_obj)["host"] = shcore::Value(member.address);
+    (*instance_obj)["role"] = shcore::Value(member.role);
 
     instance_list->push_back(instance);
   }
@@ -1741,48 +1766,40 @@ shcore::Value ReplicaSet::get_description() const {
   return ret_val;
 }
 
-shcore::Value ReplicaSet::get_status(const mysqlsh::dba::ReplicationGroupState &state) const {
+shcore::Value ReplicaSet::get_status(const mysqlsh::dba::ReplicationGroupState &state,
+                                     const ClusterSnapshot &snapshot) const {
   shcore::Value ret_val = shcore::Value::new_map();
   auto status = ret_val.as_map();
 
   // First, check if the topology type matchs the current state in order to
   // retrieve the status correctly, otherwise issue an error.
-  this->verify_topology_type_change();
+  if (snapshot.single_primary_mode)
+    this->verify_topology_type_change(static_cast<int>(snapshot.single_primary_mode.as_int()));
+  else
+    this->verify_topology_type_change();
 
   bool single_primary_mode = _topology_type == kTopologyPrimaryMaster;
 
   // Identifies the master node
   std::string master_uuid;
-  if (single_primary_mode) {
-    auto instance_session(_metadata_storage->get_dba()->get_active_session());
-    auto classic = dynamic_cast<mysqlsh::mysql::ClassicSession*>(instance_session.get());
-    get_status_variable(classic->connection(), "group_replication_primary_member", master_uuid, false);
-  }
-
-  shcore::sqlstring query("SELECT mysql_server_uuid, instance_name, role, MEMBER_STATE, "
-                          "JSON_UNQUOTE(JSON_EXTRACT(addresses, \"$.mysqlClassic\")) as host "
-                          "FROM mysql_innodb_cluster_metadata.instances "
-                          "LEFT JOIN performance_schema.replication_group_members "
-                          "ON `mysql_server_uuid`=`MEMBER_ID` WHERE replicaset_id = ?", 0);
-  query << _id;
-  query.done();
-
-  auto result = _metadata_storage->execute_sql(query);
-
-  auto raw_instances = result->call("fetchAll", shcore::Argument_list());
+  if (single_primary_mode)
+    master_uuid = snapshot.primary_member;
 
-  auto instances = raw_instances.as_array();
+  std::vector<const ClusterSnapshot::Instance*> instances;
+  for (auto &instance : snapshot.instances) {
+    if (instance.replicaset_id == _id)
+      instances.push_back(&instance);
+  }
 
-  std::shared_ptr<mysqlsh::Row> master;
+  const ClusterSnapshot::Instance *master = nullptr;
   int online_count = 0, total_count = 0;
 
-  for (auto value : *instances.get()) {
+  for (auto instance : instances) {
     total_count++;
-    auto row = value.as_object<mysqlsh::Row>();
-    if (row->get_member(0).as_string() == master_uuid)
-      master = row;
+    if (instance->uuid == master_uuid)
+      master = instance;
 
-    auto status = row->get_member(3);
+    auto status = instance->member_state;
     if (status && status.as_string() == "ONLINE")
       online_count++;
   }
@@ -1848,31 +1865,28 @@ shcore::Value ReplicaSet::get_status(const mysqlsh::dba::ReplicationGroupState &
 
   // In single primary mode we need to add the "primary" field
   if (single_primary_mode && master)
-    (*status)["primary"] = master->get_member(4);
+    (*status)["primary"] = shcore::Value(master->address);
 
   // Creates the topology node
   (*status)["topology"] = shcore::Value::new_map();
   auto instance_owner_node = status->get_map("topology");
 
   // Inserts the instances
-  for (auto value : *instances.get()) {
-    // Gets each row
-    auto row = value.as_object<mysqlsh::Row>();
-
-    auto instance_label = row->get_member(1).as_string();
+  for (auto instance : instances) {
+    auto instance_label = instance->label;
     (*instance_owner_node)[instance_label] = shcore::Value::new_map();
     auto instance_node = instance_owner_node->get_map(instance_label);
 
     // check if it is the active session instance
     bool active_session_instance = false;
 
-    if (active_session_address == row->get_member(4).as_string())
+    if (active_session_address == instance->address)
       active_session_instance = true;
 
-    if (row == master && single_primary_mode)
-      append_member_status(instance_node, row, true, active_session_instance);
+    if (instance == master && single_primary_mode)
+      append_member_status(instance_node, *instance, true, active_session_instance);
     else
-      append_member_status(instance_node, row, single_primary_mode ? false : true,
+      append_member_status(instance_node, *instance, single_primary_mode ? false : true,
                            active_session_instance);
 
     (*instance_node)["readReplicas"] = shcore::Value::new_map();
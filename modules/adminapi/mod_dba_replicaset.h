@@ -40,6 +40,7 @@ class ClassicSession;
 namespace dba {
 class MetadataStorage;
 class Cluster;
+struct ClusterSnapshot;
 
 #if DOXYGEN_CPP
 /**
@@ -123,7 +124,7 @@ public:
   shcore::Value rescan(const shcore::Argument_list &args);
   shcore::Value force_quorum_using_partition_of(const shcore::Argument_list &args);
   shcore::Value force_quorum_using_partition_of_(const shcore::Argument_list &args);
-  shcore::Value get_status(const mysqlsh::dba::ReplicationGroupState &state) const;
+  shcore::Value get_status(const mysqlsh::dba::ReplicationGroupState &state, const ClusterSnapshot &snapshot) const;
 
   void remove_instances_from_gr(const shcore::Value::Array_type_ref &instances);
   ReplicationGroupState check_preconditions(const std::string& function_name) const;
@@ -144,10 +145,15 @@ private:
     std::string host;
   };
   std::vector<NewInstanceInfo> get_newly_discovered_instances();
+  std::vector<NewInstanceInfo> get_newly_discovered_instances(const std::vector<std::string> &instances_gr_array,
+                                                              const std::vector<std::string> &instances_md_array);
   std::vector<MissingInstanceInfo> get_unavailable_instances();
+  std::vector<MissingInstanceInfo> get_unavailable_instances(const std::vector<std::string> &instances_gr_array,
+                                                             const std::vector<std::string> &instances_md_array);
 
-  shcore::Value get_description() const;
+  shcore::Value get_description(const ClusterSnapshot &snapshot) const;
   void verify_topology_type_change() const;
+  void verify_topology_type_change(int gr_primary_mode) const;
 
 protected:
   uint64_t _id;
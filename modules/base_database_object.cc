@@ -256,10 +256,14 @@ shcore::Value DatabaseObject::find_in_cache(const std::string& name, Cache targe
 }
 
 bool DatabaseObject::is_base_member(const std::string &prop) const {
-  auto style = naming_style;
-  auto method_index = std::find_if(_funcs.begin(), _funcs.end(), [prop, style](const FunctionEntry &f) { return f.second->name(style) == prop; });
+  if (find_function(prop, naming_style))
+    return true;
 
-  auto prop_index = std::find_if(_properties.begin(), _properties.begin() + (_base_property_count - 1), [prop, style](std::shared_ptr<Cpp_property_name> p) { return p->name(style) == prop; });
+  // The properties added after the base ones are the schema objects
+  auto property = find_property(prop, naming_style);
+  if (!property)
+    return false;
 
-  return (method_index != _funcs.end() || prop_index != _properties.begin() + (_base_property_count - 1));
+  auto end = _properties.begin() + (_base_property_count - 1);
+  return std::find(_properties.begin(), end, *property) != end;
 }
@@ -260,20 +260,29 @@ bool ShellBaseResult::operator == (const Object_bridge &other) const {
 
 Column::Column(const std::string& schema, const std::string& table_name, const std::string& table_label, const std::string& column_name, const std::string& column_label,
        shcore::Value type, uint64_t length, bool numeric, uint64_t fractional, bool is_signed, const std::string &collation, const std::string &charset, bool padded) :
-        _schema(schema), _table_name(table_name), _table_label(table_label), _column_name(column_name), _column_label(column_label), _collation(collation), _charset(charset),
+        shcore::Cpp_object_bridge(class_members()), _schema(schema), _table_name(table_name), _table_label(table_label), _column_name(column_name), _column_label(column_label), _collation(collation), _charset(charset),
        _length(length), _type(type), _fractional(fractional), _signed(is_signed), _padded(padded), _numeric(numeric) {
-  add_property("schemaName", "getSchemaName");
-  add_property("tableName", "getTableName");
-  add_property("tableLabel", "getTableLabel");
-  add_property("columnName", "getColumnName");
-  add_property("columnLabel", "getColumnLabel");
-  add_property("type", "getType");
-  add_property("length", "getLength");
-  add_property("fractionalDigits", "getFractionalDigits");
-  add_property("numberSigned", "isNumberSigned");
-  add_property("collationName", "getCollationName");
-  add_property("characterSetName", "getCharacterSetName");
-  add_property("padded", "isPadded");
+}
+
+const shcore::Cpp_member_registry &Column::class_members() {
+  static shcore::Cpp_member_registry members = []() {
+    shcore::Cpp_member_registry ret_val;
+    ret_val.add_property("schemaName", "getSchemaName");
+    ret_val.add_property("tableName", "getTableName");
+    ret_val.add_property("tableLabel", "getTableLabel");
+    ret_val.add_property("columnName", "getColumnName");
+    ret_val.add_property("columnLabel", "getColumnLabel");
+    ret_val.add_property("type", "getType");
+    ret_val.add_property("length", "getLength");
+    ret_val.add_property("fractionalDigits", "getFractionalDigits");
+    ret_val.add_property("numberSigned", "isNumberSigned");
+    ret_val.add_property("collationName", "getCollationName");
+    ret_val.add_property("characterSetName", "getCharacterSetName");
+    ret_val.add_property("padded", "isPadded");
+    return ret_val;
+  }();
+
+  return members;
 }
 
 bool Column::operator == (const Object_bridge &other) const {
@@ -332,10 +341,84 @@ shcore::Value Column::get_member(const std::string &prop) const {
   return ret_val;
 }
 
-Row::Row() {
-  add_property("length", "getLength");
-  add_method("getField", std::bind(&Row::get_field, this, _1), "field", shcore::String, NULL);
-  add_method("getLength", std::bind(&Row::get_member_method, this, _1, "getLength", "length"), NULL);
+// Members of the Row class, fields with these names are only available
+// through getField
+static bool is_row_member(const std::string &name) {
+  return name == "length" || name == "getField" || name == "getLength" || name == "help";
+}
+
+void Row_definition::add_field(const std::string &name) {
+  size_t index = _names.size();
+  _names.push_back(name);
+
+  // On duplicate names only the first field is available by name
+  if (_index.find(name) != _index.end())
+    return;
+
+  _index[name] = index;
+
+  // Fields would be available as properties (row.property) if they are
+  // valid identifiers and not base members like length and getField
+  if (shcore::is_valid_identifier(name) && !is_row_member(name)) {
+    std::string py_name = get_member_name(name, shcore::LowerCaseUnderscores);
+
+    _property_names[shcore::LowerCamelCase].push_back(name);
+    _property_names[shcore::LowerCaseUnderscores].push_back(py_name);
+
+    _property_index[shcore::LowerCamelCase].insert(std::make_pair(name, index));
+    _property_index[shcore::LowerCaseUnderscores].insert(std::make_pair(py_name, index));
+  }
+}
+
+int Row_definition::index_of(const std::string &name) const {
+  auto iter = _index.find(name);
+
+  return iter == _index.end() ? -1 : static_cast<int>(iter->second);
+}
+
+int Row_definition::property_index(const std::string &name, shcore::NamingStyle style) const {
+  if (style != shcore::LowerCamelCase && style != shcore::LowerCaseUnderscores)
+    return -1;
+
+  auto iter = _property_index[style].find(name);
+
+  return iter == _property_index[style].end() ? -1 : static_cast<int>(iter->second);
+}
+
+void Row_definition::append_properties(std::vector<std::string> &members, shcore::NamingStyle style) const {
+  if (style == shcore::LowerCamelCase || style == shcore::LowerCaseUnderscores)
+    members.insert(members.end(), _property_names[style].begin(), _property_names[style].end());
+}
+
+Row::Row(std::shared_ptr<Row_definition> definition_)
+  : shcore::Cpp_object_bridge(class_members()), definition(definition_) {
+  if (!definition)
+    definition.reset(new Row_definition());
+}
+
+const shcore::Cpp_member_registry &Row::class_members() {
+  static shcore::Cpp_member_registry members = []() {
+    shcore::Cpp_member_registry ret_val;
+    ret_val.add_property("length", "getLength");
+    ret_val.add_method("getField", shcore::Cpp_member_registry::method(&Row::get_field), "field", shcore::String, NULL);
+    return ret_val;
+  }();
+
+  return members;
+}
+
+Row::Row(std::shared_ptr<Row_definition> definition_, std::shared_ptr<Row_source> source)
+  : Row(definition_) {
+  _source = source;
+  value_array.resize(definition->size());
+}
+
+const shcore::Value &Row::field_value(size_t index) const {
+  shcore::Value &value(value_array[index]);
+  if (_source && value.type == shcore::Undefined)
+    value = _source->get_value(index);
+
+  return value;
 }
 
 std::string &Row::append_descr(std::string &s_out, int indent, int UNUSED(quote_strings)) const {
@@ -350,7 +433,7 @@ std::string &Row::append_descr(std::string &s_out, int indent, int UNUSED(quote_
     if (indent >= 0)
       s_out.append((indent + 1) * 4, ' ');
 
-    value_array[index].append_descr(s_out, indent < 0 ? indent : indent + 1, '"');
+    field_value(index).append_descr(s_out, indent < 0 ? indent : indent + 1, '"');
   }
 
   s_out += nl;
@@ -366,7 +449,7 @@ void Row::append_json(shcore::JSON_dumper& dumper) const {
   dumper.start_object();
 
   for (size_t index = 0; index < value_array.size(); index++)
-    dumper.append_value(names[index], value_array[index]);
+    dumper.append_value(definition->name(index), field_value(index));
 
   dumper.end_object();
 }
@@ -401,9 +484,9 @@ shcore::Value Row::get_field(const shcore::Argument_list &args) {
 }
 
 shcore::Value Row::get_field_(const std::string &field) {
-  auto iter = values.find(field);
-  if (iter != values.end())
-    return iter->second;
+  int index = definition->index_of(field);
+  if (index != -1)
+    return get_member(index);
   else
     throw shcore::Exception::argument_error("Row.getField: Field " + field + " does not exist");
 }
@@ -434,14 +517,43 @@ shcore::Value Row::get_member(const std::string &prop) const {
   if (prop == "length")
     return shcore::Value((int)value_array.size());
   else {
-    std::map<std::string, shcore::Value>::const_iterator it;
-    if ((it = values.find(prop)) != values.end())
-      return it->second;
+    int index = definition->index_of(prop);
+    if (index != -1)
+      return get_member(index);
   }
 
   return shcore::Cpp_object_bridge::get_member(prop);
 }
 
+std::vector<std::string> Row::get_members() const {
+  std::vector<std::string> members(shcore::Cpp_object_bridge::get_members());
+
+  definition->append_properties(members, naming_style);
+
+  return members;
+}
+
+bool Row::has_member(const std::string &prop) const {
+  return shcore::Cpp_object_bridge::has_member(prop) ||
+         definition->property_index(prop, shcore::LowerCamelCase) != -1;
+}
+
+shcore::Value Row::get_member_advanced(const std::string &prop, const shcore::NamingStyle &style) {
+  if (shcore::Cpp_object_bridge::has_member_advanced(prop, style))
+    return shcore::Cpp_object_bridge::get_member_advanced(prop, style);
+
+  int index = definition->property_index(prop, style);
+  if (index == -1)
+    throw shcore::Exception::attrib_error("Invalid object member " + prop);
+
+  return get_member(index);
+}
+
+bool Row::has_member_advanced(const std::string &prop, const shcore::NamingStyle &style) {
+  return shcore::Cpp_object_bridge::has_member_advanced(prop, style) ||
+         definition->property_index(prop, style) != -1;
+}
+
 #if DOXYGEN_CPP
 /**
  * Returns the value of a field on the Row based on the field position.
@@ -449,25 +561,14 @@ shcore::Value Row::get_member(const std::string &prop) const {
 #endif
 shcore::Value Row::get_member(size_t index) const {
   if (index < value_array.size())
-    return value_array[index];
+    return field_value(index);
   else
     return shcore::Value();
 }
 
 void Row::add_item(const std::string &key, shcore::Value value) {
-  // All the values are available through index
+  // All the values are available through index, the names
+  // are resolved through the definition
   value_array.push_back(value);
-  names.push_back(key);
-
-  // Values would be available as properties if they are valid identifier
-  // and not base members like lenght and getField
-  // O on this case the values would be available as
-  // row.property
-  if (shcore::is_valid_identifier(key) && !has_member(key))
-    add_property(key);
-
-  // Values would be retrievable with getMember if the name
-  // is an existing member as long as the name is not duplicate
-  if (values.find(key) == values.end())
-    values[key] = value;
+  definition->add_field(key);
 }
@@ -31,6 +31,9 @@ namespace mysqlsh {
 // This is the Shell Common Base Class for all the resultset classes
 class ShellBaseResult : public shcore::Cpp_object_bridge {
 public:
+  ShellBaseResult() {}
+  ShellBaseResult(const shcore::Cpp_member_registry &members) : shcore::Cpp_object_bridge(members) {}
+
   virtual bool operator == (const Object_bridge &other) const;
 
   // Doing nothing by default to avoid impacting the classic result
@@ -229,6 +232,9 @@ public:
   bool is_padded() { return _padded; }
 
 private:
+  // Shared by all the columns
+  static const shcore::Cpp_member_registry &class_members();
+
   std::string _schema;
   std::string _table_name;
   std::string _table_label;
@@ -244,6 +250,52 @@ private:
   bool _numeric;
 };
 
+/**
+ * Holds the field names of a result.
+ *
+ * A single instance is shared by all the rows read from the same result so
+ * the rows only hold their values.
+ */
+class SHCORE_PUBLIC Row_definition {
+public:
+  void add_field(const std::string &name);
+
+  size_t size() const { return _names.size(); }
+  const std::string &name(size_t index) const { return _names[index]; }
+
+  // Returns the index of the first field with the given name or -1
+  int index_of(const std::string &name) const;
+
+  // Same as index_of but only considers the fields exposed as row
+  // properties, using the names on the given naming style
+  int property_index(const std::string &name, shcore::NamingStyle style) const;
+
+  // Names of the fields exposed as row properties on the given naming style
+  void append_properties(std::vector<std::string> &members, shcore::NamingStyle style) const;
+
+private:
+  std::vector<std::string> _names;
+  std::unordered_map<std::string, size_t> _index;
+
+  // Fields exposed as properties, on each naming style
+  std::vector<std::string> _property_names[2];
+  std::unordered_map<std::string, size_t> _property_index[2];
+};
+
+/**
+ * Decodes the fields of a record on demand.
+ *
+ * Rows created with a source hold the record as it was read and only turn a
+ * field into a Value the first time it is accessed: scripts usually touch a
+ * few columns of wide results.
+ */
+class SHCORE_PUBLIC Row_source {
+public:
+  virtual ~Row_source() {}
+
+  virtual shcore::Value get_value(size_t index) const = 0;
+};
+
 /**
  * Represents the a Row in a Result.
  */
@@ -282,12 +334,19 @@ public:
   int get_length();
   Value get_field(str fieldName);
 #endif
-  Row();
+  Row(std::shared_ptr<Row_definition> definition = std::shared_ptr<Row_definition>());
+
+  // A row with a field for each one on the definition, decoded by the source
+  // when first accessed
+  Row(std::shared_ptr<Row_definition> definition, std::shared_ptr<Row_source> source);
+
   virtual std::string class_name() const { return "Row"; }
 
-  std::map<std::string, shcore::Value> values;
-  std::vector<std::string> names;
-  shcore::Value::Array_type value_array;
+  // Field names are kept in the definition, shared by the rows of a result
+  std::shared_ptr<Row_definition> definition;
+
+  // Fields not decoded yet are Undefined
+  mutable shcore::Value::Array_type value_array;
 
   virtual std::string &append_descr(std::string &s_out, int indent = -1, int quote_strings = 0) const;
   virtual std::string &append_repr(std::string &s_out) const;
@@ -298,13 +357,30 @@ public:
 
   virtual bool operator == (const Object_bridge &other) const;
 
+  virtual std::vector<std::string> get_members() const;
   virtual shcore::Value get_member(const std::string &prop) const;
   shcore::Value get_member(size_t index) const;
+  virtual bool has_member(const std::string &prop) const;
+
+  virtual shcore::Value get_member_advanced(const std::string &prop, const shcore::NamingStyle &style);
+  virtual bool has_member_advanced(const std::string &prop, const shcore::NamingStyle &style);
 
-  size_t get_length() { return values.size(); }
+  size_t get_length() { return value_array.size(); }
   virtual bool is_indexed() const { return true; }
 
+  // Adds a field to a row with its own definition
   void add_item(const std::string &key, shcore::Value value);
+
+  // Adds the value of the next field on the shared definition
+  void add_value(shcore::Value value) { value_array.push_back(value); }
+
+private:
+  // Shared by all the rows, the fields are resolved through the definition
+  static const shcore::Cpp_member_registry &class_members();
+
+  std::shared_ptr<Row_source> _source;
+
+  const shcore::Value &field_value(size_t index) const;
 };
 };
 
@@ -66,10 +66,11 @@ bool Dynamic_object::has_member(const std::string &prop) const {
   bool ret_val = false;
 
   // A function is considered only if it is enanbled
-  auto i = std::find_if(_funcs.begin(), _funcs.end(), [this, prop](const FunctionEntry &f) { return f.second->name(naming_style) == prop; });
-  if (i != _funcs.end())
-    ret_val = _enabled_functions.find(i->first) != _enabled_functions.end() && _enabled_functions.at(i->first);
-  else
+  auto func = find_function(prop, naming_style);
+  if (func) {
+    auto enabled = _enabled_functions.find(func->base_name);
+    ret_val = enabled != _enabled_functions.end() && enabled->second;
+  } else
     ret_val = Cpp_object_bridge::has_member(prop);
 
   return ret_val;
@@ -32,6 +32,22 @@ using namespace mysqlsh;
 using namespace shcore;
 using namespace mysqlsh::mysql;
 
+namespace {
+// Decodes the fields from a copy of the MYSQL_ROW data only when they are
+// accessed
+class Row_data : public mysqlsh::Row_source {
+public:
+  explicit Row_data(const mysql::Row &row) : _row(row) {}
+
+  virtual shcore::Value get_value(size_t index) const {
+    return _row.get_value(static_cast<int>(index));
+  }
+
+private:
+  mutable mysql::Row _row;
+};
+}
+
 // Documentation of the ClassicResult class
 REGISTER_HELP(CLASSICRESULT_BRIEF, "Allows browsing through the result information "\
 "after performing an operation on the database through the MySQL Protocol.");
@@ -39,21 +55,30 @@ REGISTER_HELP(CLASSICRESULT_DETAIL, "This class allows access to the result set
 "the classic MySQL data model to be retrieved from Dev API queries.");
 
 ClassicResult::ClassicResult(std::shared_ptr<Result> result)
-  : _result(result) {
-  add_property("columns", "getColumns");
-  add_property("columnCount", "getColumnCount");
-  add_property("columnNames", "getColumnNames");
-  add_property("affectedRowCount", "getAffectedRowCount");
-  add_property("warningCount", "getWarningCount");
-  add_property("warnings", "getWarnings");
-  add_property("executionTime", "getExecutionTime");
-  add_property("autoIncrementValue", "getAutoIncrementValue");
-  add_property("info", "getInfo");
-
-  add_method("fetchOne", std::bind((shcore::Value(ClassicResult::*)(const shcore::Argument_list &)const)&ClassicResult::fetch_one, this, _1), "nothing", shcore::String, NULL);
-  add_method("fetchAll", std::bind((shcore::Value(ClassicResult::*)(const shcore::Argument_list &)const)&ClassicResult::fetch_all, this, _1), "nothing", shcore::String, NULL);
-  add_method("nextDataSet", std::bind(&ClassicResult::next_data_set, this, _1), "nothing", shcore::String, NULL);
-  add_method("hasData", std::bind(&ClassicResult::has_data, this, _1), "nothing", shcore::String, NULL);
+  : ShellBaseResult(class_members()), _result(result) {
+}
+
+const shcore::Cpp_member_registry &ClassicResult::class_members() {
+  static shcore::Cpp_member_registry members = []() {
+    shcore::Cpp_member_registry ret_val;
+    ret_val.add_property("columns", "getColumns");
+    ret_val.add_property("columnCount", "getColumnCount");
+    ret_val.add_property("columnNames", "getColumnNames");
+    ret_val.add_property("affectedRowCount", "getAffectedRowCount");
+    ret_val.add_property("warningCount", "getWarningCount");
+    ret_val.add_property("warnings", "getWarnings");
+    ret_val.add_property("executionTime", "getExecutionTime");
+    ret_val.add_property("autoIncrementValue", "getAutoIncrementValue");
+    ret_val.add_property("info", "getInfo");
+
+    ret_val.add_method("fetchOne", shcore::Cpp_member_registry::method(&ClassicResult::fetch_one), "nothing", shcore::String, NULL);
+    ret_val.add_method("fetchAll", shcore::Cpp_member_registry::method(&ClassicResult::fetch_all), "nothing", shcore::String, NULL);
+    ret_val.add_method("nextDataSet", shcore::Cpp_member_registry::method(&ClassicResult::next_data_set), "nothing", shcore::String, NULL);
+    ret_val.add_method("hasData", shcore::Cpp_member_registry::method(&ClassicResult::has_data), "nothing", shcore::String, NULL);
+    return ret_val;
+  }();
+
+  return members;
 }
 
 // Documentation of the hasData function
@@ -93,18 +118,27 @@ shcore::Value ClassicResult::fetch_one(const shcore::Argument_list &args) const
   auto inner_row = std::unique_ptr<Row>(_result->fetch_one());
 
   if (inner_row) {
-    mysqlsh::Row *value_row = new mysqlsh::Row();
-
-    std::vector<Field> metadata(_result->get_metadata());
-
-    for (size_t index = 0; index < metadata.size(); index++)
-      value_row->add_item(metadata[index].name(), inner_row->get_value(index));
+    // The row data is only valid until the next row is fetched, so it is
+    // copied as is and the fields are decoded when accessed
+    mysqlsh::Row *value_row = new mysqlsh::Row(get_row_definition(),
+                                               std::shared_ptr<mysqlsh::Row_source>(new Row_data(*inner_row)));
 
     return shcore::Value::wrap(value_row);
   }
   return shcore::Value::Null();
 }
 
+std::shared_ptr<mysqlsh::Row_definition> ClassicResult::get_row_definition() const {
+  if (!_row_definition) {
+    _row_definition.reset(new mysqlsh::Row_definition());
+
+    for (auto &field : _result->get_metadata())
+      _row_definition->add_field(field.name());
+  }
+
+  return _row_definition;
+}
+
 std::shared_ptr<mysql::Row> ClassicResult::fetch_one() const {
   return std::shared_ptr<Row>(_result->fetch_one());
 }
@@ -127,6 +161,9 @@ bool ClassicResult::next_data_set() {}
 shcore::Value ClassicResult::next_data_set(const shcore::Argument_list &args) {
   args.ensure_count(0, get_function_name("nextDataSet").c_str());
 
+  // The next result comes with different fields
+  _row_definition.reset();
+
   return shcore::Value(_result->next_data_set());
 }
 
@@ -359,7 +396,7 @@ shcore::Value ClassicResult::get_member(const std::string &prop) const {
   }
 
   if (prop == "columnNames") {
-    std::vector<Field> metadata(_result->get_metadata());
+    std::vector<Field> &metadata(_result->get_metadata());
 
     std::shared_ptr<shcore::Value::Array_type> array(new shcore::Value::Array_type);
 
@@ -372,7 +409,7 @@ shcore::Value ClassicResult::get_member(const std::string &prop) const {
   }
 
   if (prop == "columns") {
-    std::vector<Field> metadata(_result->get_metadata());
+    std::vector<Field> &metadata(_result->get_metadata());
 
     std::shared_ptr<shcore::Value::Array_type> array(new shcore::Value::Array_type);
 
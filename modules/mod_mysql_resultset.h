@@ -57,6 +57,10 @@ public:
 protected:
   std::shared_ptr<Result> _result;
 
+  // Field names shared by the rows of the active result
+  std::shared_ptr<Row_definition> get_row_definition() const;
+  mutable std::shared_ptr<Row_definition> _row_definition;
+
 #if DOXYGEN_JS
   Integer affectedRowCount; //!< Same as getAffectedItemCount()
   Integer columnCount; //!< Same as getColumnCount()
@@ -106,6 +110,9 @@ protected:
   list get_warnings();
   bool next_data_set();
 #endif
+
+private:
+  static const shcore::Cpp_member_registry &class_members();
 };
 }
 };
@@ -143,7 +143,6 @@ shcore::Value CollectionAdd::add(const shcore::Argument_list &args) {
           for (index = 0; index < size; index++) {
             Value element = shell_docs->at(index);
 
-            ::mysqlx::Document inner_doc;
             Value::Map_type_ref shell_doc;
 
             // Validation of the incoming parameter
@@ -167,12 +166,9 @@ shcore::Value CollectionAdd::add(const shcore::Argument_list &args) {
                 throw shcore::Exception::argument_error("Invalid data type for _id field, should be a string");
 
               // No matter how the document was received, gets passed as expression to the
-              // backend
-              inner_doc.reset(shcore::Value(shell_doc).json(), true, (*shell_doc)["_id"].as_string());
+              // backend, built directly from the document values
+              _add_statement->add(convert_document(shcore::Value(shell_doc)), (*shell_doc)["_id"].as_string());
             }
-
-            // We have a document so it gets added!
-            _add_statement->add(inner_doc);
           }
 
           // Updates the exposed functions (since a document has been added)
@@ -186,6 +182,52 @@ shcore::Value CollectionAdd::add(const shcore::Argument_list &args) {
   return Value(std::static_pointer_cast<Object_bridge>(shared_from_this()));
 }
 
+Mysqlx::Expr::Expr *CollectionAdd::convert_document(const shcore::Value &value) {
+  switch (value.type) {
+    case Undefined:
+    case Null:
+      return ::mysqlx::Expr_builder::build_literal_expr(::mysqlx::Expr_builder::build_null_scalar());
+    case Bool:
+      return ::mysqlx::Expr_builder::build_literal_expr(::mysqlx::Expr_builder::build_bool_scalar(value.as_bool()));
+    case Integer:
+      return ::mysqlx::Expr_builder::build_literal_expr(::mysqlx::Expr_builder::build_int_scalar(value.as_int()));
+    case UInteger: {
+      Mysqlx::Datatypes::Scalar *scalar = new Mysqlx::Datatypes::Scalar();
+      scalar->set_type(Mysqlx::Datatypes::Scalar::V_UINT);
+      scalar->set_v_unsigned_int(value.as_uint());
+      return ::mysqlx::Expr_builder::build_literal_expr(scalar);
+    }
+    case Float:
+      return ::mysqlx::Expr_builder::build_literal_expr(::mysqlx::Expr_builder::build_double_scalar(value.as_double()));
+    case String:
+      return ::mysqlx::Expr_builder::build_literal_expr(::mysqlx::Expr_builder::build_string_scalar(value.as_string()));
+    case Map: {
+      std::unique_ptr<Mysqlx::Expr::Expr> expr(new Mysqlx::Expr::Expr());
+      expr->set_type(Mysqlx::Expr::Expr_Type_OBJECT);
+      Mysqlx::Expr::Object *object = expr->mutable_object();
+      for (auto &field : *value.as_map()) {
+        Mysqlx::Expr::Object_ObjectField *fld = object->add_fld();
+        fld->set_key(field.first);
+        fld->set_allocated_value(convert_document(field.second));
+      }
+      return expr.release();
+    }
+    case Array: {
+      std::unique_ptr<Mysqlx::Expr::Expr> expr(new Mysqlx::Expr::Expr());
+      expr->set_type(Mysqlx::Expr::Expr_Type_ARRAY);
+      Mysqlx::Expr::Array *array = expr->mutable_array();
+      for (auto &item : *value.as_array())
+        array->mutable_value()->AddAllocated(convert_document(item));
+      return expr.release();
+    }
+    default: {
+      // Objects are sent the way they are represented in JSON
+      ::mysqlx::Expr_parser parser(value.json(), true);
+      return parser.expr();
+    }
+  }
+}
+
 std::string CollectionAdd::get_new_uuid() {
   uuid_type uuid;
   generate_uuid(uuid);
@@ -47,6 +47,10 @@ public:
   shcore::Value add(const shcore::Argument_list &args);
   virtual shcore::Value execute(const shcore::Argument_list &args);
 
+  // Builds the X Protocol expression for a document value
+  static Mysqlx::Expr::Expr *convert_document(const shcore::Value &value);
+  static std::string get_new_uuid();
+
 #if DOXYGEN_JS
   CollectionAdd add(DocDefinition document[, DocDefinition document, ...]);
   CollectionAdd add(List documents);
@@ -58,8 +62,6 @@ public:
 #endif
 
 private:
-  std::string get_new_uuid();
-
   std::unique_ptr< ::mysqlx::AddStatement> _add_statement;
 };
 }
@@ -544,12 +544,16 @@ shcore::Value CollectionFind::bind(const shcore::Argument_list &args) {
 REGISTER_HELP(COLLECTIONFIND_EXECUTE_BRIEF, "Executes the find operation with all the configured options.");
 REGISTER_HELP(COLLECTIONFIND_EXECUTE_RETURNS, "@return A DocResult object that can be used to traverse the documents returned by this operation.");
 REGISTER_HELP(COLLECTIONFIND_EXECUTE_SYNTAX, "execute()");
+REGISTER_HELP(COLLECTIONFIND_EXECUTE_DETAIL, "The operation can be executed again, after binding new values or not: "\
+"the encoded statement is reused and only the bound values are encoded again.");
 
 /**
 * $(COLLECTIONFIND_EXECUTE_BRIEF)
 *
 * $(COLLECTIONFIND_EXECUTE_RETURNS)
 *
+* $(COLLECTIONFIND_EXECUTE_DETAIL)
+*
 * #### Method Chaining
 *
 * This function can be invoked after any other function on this class.
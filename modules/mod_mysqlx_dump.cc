@@ -0,0 +1,712 @@
+/*
+ * Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+#include "mod_mysqlx_dump.h"
+#include "mod_mysqlx_import.h"
+#include "mod_mysqlx_session.h"
+#include "mysqlxtest/mysqlx.h"
+#include "utils/utils_file.h"
+#include "utils/utils_sqlstring.h"
+#include <boost/format.hpp>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <set>
+#include <thread>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+using namespace mysqlsh::mysqlx;
+
+namespace {
+// Rows are added to the dumped count in blocks, to keep the threads from
+// contending on it
+const uint64_t PROGRESS_BLOCK = 1000;
+
+std::shared_ptr< ::mysqlx::Result> execute_sql(std::shared_ptr< ::mysqlx::Session> session, const std::string &sql) {
+  std::shared_ptr< ::mysqlx::Result> result = session->executeSql(sql);
+  result->wait();
+  return result;
+}
+
+// Maps signed values into the unsigned range keeping their order
+uint64_t to_ordered(int64_t value) {
+  return static_cast<uint64_t>(value) ^ (static_cast<uint64_t>(1) << 63);
+}
+
+int64_t from_ordered(uint64_t value) {
+  return static_cast<int64_t>(value ^ (static_cast<uint64_t>(1) << 63));
+}
+}
+
+Gzip_buffer::Gzip_buffer() : _file(NULL) {
+}
+
+Gzip_buffer::~Gzip_buffer() {
+  close();
+}
+
+bool Gzip_buffer::is_available() {
+#ifdef HAVE_ZLIB
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool Gzip_buffer::open(const std::string &path, const char *mode) {
+  close();
+
+#ifdef HAVE_ZLIB
+  _file = gzopen(path.c_str(), mode);
+  if (!_file)
+    return false;
+
+  if (mode[0] == 'w')
+    setp(_buffer, _buffer + sizeof(_buffer));
+  else
+    setg(_buffer, _buffer, _buffer);
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool Gzip_buffer::close() {
+  if (!_file)
+    return true;
+
+  bool ret_val = sync() == 0;
+
+#ifdef HAVE_ZLIB
+  ret_val = gzclose(static_cast<gzFile>(_file)) == Z_OK && ret_val;
+#endif
+
+  _file = NULL;
+  setp(NULL, NULL);
+  setg(NULL, NULL, NULL);
+
+  return ret_val;
+}
+
+Gzip_buffer::int_type Gzip_buffer::overflow(int_type c) {
+#ifdef HAVE_ZLIB
+  if (!_file || !pbase())
+    return traits_type::eof();
+
+  int pending = static_cast<int>(pptr() - pbase());
+  if (pending && gzwrite(static_cast<gzFile>(_file), pbase(), pending) != pending)
+    return traits_type::eof();
+
+  setp(_buffer, _buffer + sizeof(_buffer));
+
+  if (!traits_type::eq_int_type(c, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+
+  return traits_type::not_eof(c);
+#else
+  return traits_type::eof();
+#endif
+}
+
+Gzip_buffer::int_type Gzip_buffer::underflow() {
+#ifdef HAVE_ZLIB
+  if (!_file || !eback())
+    return traits_type::eof();
+
+  if (gptr() < egptr())
+    return traits_type::to_int_type(*gptr());
+
+  int read = gzread(static_cast<gzFile>(_file), _buffer, sizeof(_buffer));
+  if (read <= 0)
+    return traits_type::eof();
+
+  setg(_buffer, _buffer, _buffer + read);
+
+  return traits_type::to_int_type(*gptr());
+#else
+  return traits_type::eof();
+#endif
+}
+
+int Gzip_buffer::sync() {
+  if (pbase() && pptr() > pbase())
+    return traits_type::eq_int_type(overflow(traits_type::eof()), traits_type::eof()) ? -1 : 0;
+
+  return 0;
+}
+
+Dumper::Dumper(const std::string &schema, const std::string &output_dir) :
+_schema(schema), _output_dir(output_dir), _chunk_size(250000), _compression(None), _consistent(true),
+_next_chunk(0), _dumped(0), _last_report(0) {
+}
+
+std::string Dumper::encode_file_name(const std::string &name) {
+  std::string ret_val;
+  for (auto c : name) {
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '-')
+      ret_val.push_back(c);
+    else
+      ret_val.append((boost::format("%%%02X") % static_cast<int>(static_cast<unsigned char>(c))).str());
+  }
+
+  return ret_val;
+}
+
+std::vector<std::pair<uint64_t, uint64_t> > Dumper::split_range(uint64_t min, uint64_t max, uint64_t chunks) {
+  std::vector<std::pair<uint64_t, uint64_t> > ret_val;
+  if (max < min)
+    return ret_val;
+
+  // The span is one less than the number of values, so it doesn't overflow
+  // when the range covers the whole 64 bits
+  uint64_t span = max - min;
+  if (chunks == 0)
+    chunks = 1;
+  if (span < chunks)
+    chunks = span + 1;
+
+  // Every range gets span / chunks values, the first ones one more until the
+  // remaining values are used up
+  uint64_t size = span / chunks;
+  uint64_t extra = span % chunks;
+  uint64_t start = min;
+  for (uint64_t index = 0; index < chunks; index++) {
+    uint64_t end = start + size - (index <= extra ? 0 : 1);
+    ret_val.push_back(std::make_pair(start, end));
+    start = end + 1;
+  }
+
+  return ret_val;
+}
+
+void Dumper::append_field(std::string *line, const char *data, size_t length) {
+  // Empty fields are quoted, so a row with a single empty value is not
+  // written as a blank line, which the reader skips
+  bool quote = length == 0 || data[0] == '"' || (length == 2 && data[0] == '\\' && data[1] == 'N');
+  for (size_t index = 0; index < length && !quote; index++)
+    quote = data[index] == ',' || data[index] == '\n' || data[index] == '\r' || data[index] == '"';
+
+  if (!quote) {
+    line->append(data, length);
+  } else {
+    line->push_back('"');
+    for (size_t index = 0; index < length; index++) {
+      if (data[index] == '"')
+        line->push_back('"');
+      line->push_back(data[index]);
+    }
+    line->push_back('"');
+  }
+}
+
+shcore::Value::Map_type_ref Dumper::run(const std::vector<std::shared_ptr<BaseSession> > &sessions) {
+  if (sessions.empty())
+    throw shcore::Exception::argument_error("At least one session is required to dump data");
+
+  if (_compression == Gzip && !Gzip_buffer::is_available())
+    throw shcore::Exception::runtime_error("Compression is not available, the shell was built without zlib");
+
+  shcore::ensure_dir_exists(_output_dir);
+  if (shcore::file_exists(_output_dir + "/" + manifest_name()))
+    throw shcore::Exception::runtime_error((boost::format("The directory '%1%' already contains a dump") % _output_dir).str());
+
+  std::vector<std::shared_ptr< ::mysqlx::Session> > session_objs;
+  for (auto session : sessions)
+    session_objs.push_back(session->session_obj());
+
+  _tables.clear();
+  _chunks.clear();
+  _error.clear();
+  _next_chunk = 0;
+  _dumped = 0;
+  _start = std::chrono::steady_clock::now();
+  _last_report = 0;
+
+  start_transactions(session_objs);
+  read_tables(session_objs[0]);
+
+  size_t active = session_objs.size();
+  std::vector<std::thread> dumpers;
+  for (auto session_obj : session_objs) {
+    dumpers.push_back(std::thread([this, session_obj, &active]() {
+      dump(session_obj);
+
+      std::lock_guard<std::mutex> lock(_mutex);
+      active--;
+      _finished.notify_all();
+    }));
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (active) {
+      _finished.wait_for(lock, std::chrono::seconds(1));
+
+      lock.unlock();
+      report_progress(false);
+      lock.lock();
+    }
+  }
+
+  for (auto &dumper : dumpers)
+    dumper.join();
+
+  report_progress(true);
+
+  if (!_error.empty())
+    throw shcore::Exception::runtime_error(_error);
+
+  // The manifest is written last, so it is only there if the dump completed
+  write_manifest();
+
+  shcore::Value::Map_type_ref result(new shcore::Value::Map_type());
+  (*result)["tables"] = shcore::Value(static_cast<uint64_t>(_tables.size()));
+  (*result)["chunks"] = shcore::Value(static_cast<uint64_t>(_chunks.size()));
+  (*result)["rows"] = shcore::Value(static_cast<uint64_t>(_dumped));
+  (*result)["seconds"] = shcore::Value(elapsed());
+
+  return result;
+}
+
+// Every session starts a transaction with a consistent snapshot. To get the
+// same snapshot on all of them the tables are locked until they have started
+void Dumper::start_transactions(const std::vector<std::shared_ptr< ::mysqlx::Session> > &sessions) {
+  if (_consistent) {
+    try {
+      execute_sql(sessions[0], "FLUSH TABLES WITH READ LOCK");
+    } catch (std::exception &e) {
+      throw shcore::Exception::runtime_error((boost::format("Unable to lock the tables for a consistent dump: %1%. "
+                                                            "Set the consistent option to false to dump without it") % e.what()).str());
+    }
+  }
+
+  try {
+    for (auto session : sessions) {
+      execute_sql(session, "SET SESSION TRANSACTION ISOLATION LEVEL REPEATABLE READ");
+      execute_sql(session, "START TRANSACTION WITH CONSISTENT SNAPSHOT");
+    }
+  } catch (...) {
+    if (_consistent)
+      execute_sql(sessions[0], "UNLOCK TABLES");
+    throw;
+  }
+
+  if (_consistent)
+    execute_sql(sessions[0], "UNLOCK TABLES");
+}
+
+void Dumper::read_tables(std::shared_ptr< ::mysqlx::Session> session) {
+  // Fails if the schema does not exist
+  execute_sql(session, shcore::sqlstring("SHOW CREATE SCHEMA !", 0) << _schema)->flush();
+
+  std::vector<std::pair<std::string, uint64_t> > tables;
+  std::shared_ptr< ::mysqlx::Result> result = execute_sql(session, shcore::sqlstring(
+    "SELECT TABLE_NAME, TABLE_ROWS FROM information_schema.tables "
+    "WHERE TABLE_SCHEMA = ? AND TABLE_TYPE = 'BASE TABLE' ORDER BY TABLE_NAME", 0) << _schema);
+  while (std::shared_ptr< ::mysqlx::Row> row = result->next())
+    tables.push_back(std::make_pair(row->stringField(0), row->isNullField(1) ? 0 : row->uInt64Field(1)));
+
+  // Temporal, SET and JSON values are not decoded by the X Protocol client, so
+  // they are read in their text form
+  static const std::set<std::string> text_types = {"date", "datetime", "timestamp", "time", "year", "set", "json"};
+  static const std::set<std::string> key_types = {"tinyint", "smallint", "mediumint", "int", "bigint"};
+
+  for (auto &entry : tables) {
+    Table table;
+    table.name = entry.first;
+
+    std::string ddl;
+    result = execute_sql(session, shcore::sqlstring("SHOW CREATE TABLE !.!", 0) << _schema << table.name);
+    if (std::shared_ptr< ::mysqlx::Row> row = result->next())
+      ddl = row->stringField(1);
+    result->flush();
+
+    std::string ddl_path = _output_dir + "/" + encode_file_name(table.name) + ".sql";
+    std::ofstream ddl_file(ddl_path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    ddl_file << ddl << ";\n";
+    ddl_file.close();
+    if (ddl_file.fail())
+      throw shcore::Exception::runtime_error((boost::format("Unable to write file '%1%'") % ddl_path).str());
+
+    std::map<std::string, std::string> column_types;
+    result = execute_sql(session, shcore::sqlstring(
+      "SELECT COLUMN_NAME, DATA_TYPE, COLUMN_TYPE, NUMERIC_PRECISION, EXTRA FROM information_schema.columns "
+      "WHERE TABLE_SCHEMA = ? AND TABLE_NAME = ? ORDER BY ORDINAL_POSITION", 0) << _schema << table.name);
+    while (std::shared_ptr< ::mysqlx::Row> row = result->next()) {
+      std::string name = row->stringField(0);
+      std::string data_type = row->stringField(1);
+      column_types[name] = row->stringField(2);
+
+      // Generated columns can't be loaded
+      if (row->stringField(4).find("GENERATED") != std::string::npos)
+        continue;
+
+      if (!table.select.empty())
+        table.select.append(", ");
+
+      if (text_types.find(data_type) != text_types.end())
+        table.select.append(shcore::sqlstring("CAST(! AS CHAR)", 0) << name);
+      else
+        table.select.append(shcore::sqlstring("!", 0) << name);
+
+      table.columns.push_back(name);
+      table.bit_lengths.push_back(data_type == "bit" ? static_cast<size_t>((row->uInt64Field(3) + 7) / 8) : 0);
+    }
+
+    if (table.columns.empty())
+      throw shcore::Exception::runtime_error((boost::format("Table '%1%' has no columns to dump") % table.name).str());
+
+    std::vector<std::string> key;
+    result = execute_sql(session, shcore::sqlstring(
+      "SELECT COLUMN_NAME FROM information_schema.statistics "
+      "WHERE TABLE_SCHEMA = ? AND TABLE_NAME = ? AND INDEX_NAME = 'PRIMARY'", 0) << _schema << table.name);
+    while (std::shared_ptr< ::mysqlx::Row> row = result->next())
+      key.push_back(row->stringField(0));
+
+    _tables.push_back(table);
+
+    // Only a single integer column key can be split in ranges
+    std::string key_type = key.size() == 1 ? column_types[key[0]] : "";
+    std::string key_base_type = key_type.substr(0, key_type.find('('));
+    if (key_types.find(key_base_type) != key_types.end())
+      add_chunks(session, _tables.size() - 1, key[0], key_type.find("unsigned") != std::string::npos, entry.second);
+    else
+      add_chunks(session, _tables.size() - 1, "", false, entry.second);
+  }
+}
+
+// Splits a table in chunks of about chunk size rows, based on the estimated
+// row count and the range of the key values
+void Dumper::add_chunks(std::shared_ptr< ::mysqlx::Session> session, size_t table, const std::string &key,
+                        bool key_unsigned, uint64_t rows) {
+  const std::string &name = _tables[table].name;
+  std::string file_prefix = encode_file_name(name) + "@";
+  std::string file_suffix = _compression == Gzip ? ".csv.gz" : ".csv";
+
+  uint64_t chunks = _chunk_size ? (rows + _chunk_size - 1) / _chunk_size : 1;
+  std::vector<std::pair<uint64_t, uint64_t> > ranges;
+
+  if (!key.empty() && chunks > 1) {
+    std::shared_ptr< ::mysqlx::Result> result = execute_sql(session, shcore::sqlstring("SELECT MIN(!), MAX(!) FROM !.!", 0) <<
+                                                            key << key << _schema << name);
+    std::shared_ptr< ::mysqlx::Row> row = result->next();
+    if (row && !row->isNullField(0)) {
+      if (key_unsigned)
+        ranges = split_range(row->uInt64Field(0), row->uInt64Field(1), chunks);
+      else
+        ranges = split_range(to_ordered(row->sInt64Field(0)), to_ordered(row->sInt64Field(1)), chunks);
+    }
+    result->flush();
+  }
+
+  if (ranges.size() < 2) {
+    Chunk chunk = {table, "", file_prefix + "0" + file_suffix, 0};
+    _chunks.push_back(chunk);
+    return;
+  }
+
+  for (size_t index = 0; index < ranges.size(); index++) {
+    Chunk chunk = {table, "", file_prefix + std::to_string(index) + file_suffix, 0};
+    if (key_unsigned)
+      chunk.where = shcore::sqlstring("! BETWEEN ? AND ?", 0) << key << ranges[index].first << ranges[index].second;
+    else
+      chunk.where = shcore::sqlstring("! BETWEEN ? AND ?", 0) << key << from_ordered(ranges[index].first) <<
+                    from_ordered(ranges[index].second);
+
+    _chunks.push_back(chunk);
+  }
+}
+
+void Dumper::dump(std::shared_ptr< ::mysqlx::Session> session) {
+  size_t index;
+  while ((index = _next_chunk++) < _chunks.size()) {
+    try {
+      dump_chunk(session, &_chunks[index]);
+    } catch (std::exception &e) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_error.empty())
+        _error = (boost::format("Error dumping table '%1%' into '%2%': %3%") % _tables[_chunks[index].table].name %
+                  _chunks[index].file % e.what()).str();
+
+      // Stops the other threads
+      _next_chunk = _chunks.size();
+      return;
+    }
+  }
+}
+
+void Dumper::dump_chunk(std::shared_ptr< ::mysqlx::Session> session, Chunk *chunk) {
+  const Table &table = _tables[chunk->table];
+  std::string path = _output_dir + "/" + chunk->file;
+
+  Gzip_buffer gzip;
+  std::ofstream file;
+  std::streambuf *buffer;
+  if (_compression == Gzip) {
+    if (!gzip.open(path, "wb"))
+      throw shcore::Exception::runtime_error((boost::format("Unable to open file '%1%'") % path).str());
+    buffer = &gzip;
+  } else {
+    file.open(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (file.fail())
+      throw shcore::Exception::runtime_error((boost::format("Unable to open file '%1%'") % path).str());
+    buffer = file.rdbuf();
+  }
+  std::ostream stream(buffer);
+
+  std::string line;
+  for (auto &column : table.columns) {
+    if (!line.empty())
+      line.push_back(',');
+    append_field(&line, column.data(), column.size());
+  }
+  line.push_back('\n');
+  stream.write(line.data(), line.size());
+
+  std::string query = "SELECT " + table.select + (shcore::sqlstring(" FROM !.!", 0) << _schema << table.name).str();
+  if (!chunk->where.empty())
+    query.append(" WHERE ").append(chunk->where);
+
+  std::shared_ptr< ::mysqlx::Result> result = execute_sql(session, query);
+  std::shared_ptr<std::vector< ::mysqlx::ColumnMetadata> > metadata = result->columnMetadata();
+
+  char number[32];
+  uint64_t pending = 0;
+  while (std::shared_ptr< ::mysqlx::Row> row = result->next()) {
+    line.clear();
+    for (int index = 0; index < row->numFields(); index++) {
+      if (index)
+        line.push_back(',');
+
+      if (row->isNullField(index)) {
+        line.append("\\N");
+        continue;
+      }
+
+      switch (metadata->at(index).type) {
+        case ::mysqlx::SINT:
+          line.append(std::to_string(row->sInt64Field(index)));
+          break;
+        case ::mysqlx::UINT:
+          line.append(std::to_string(row->uInt64Field(index)));
+          break;
+        case ::mysqlx::DOUBLE:
+          line.append(number, snprintf(number, sizeof(number), "%.17g", row->doubleField(index)));
+          break;
+        case ::mysqlx::FLOAT:
+          line.append(number, snprintf(number, sizeof(number), "%.9g", row->floatField(index)));
+          break;
+        case ::mysqlx::DECIMAL:
+          line.append(row->decimalField(index));
+          break;
+        case ::mysqlx::ENUM: {
+          std::string value = row->enumField(index);
+          append_field(&line, value.data(), value.size());
+          break;
+        }
+        case ::mysqlx::BIT: {
+          // Written as the big endian bytes of the column, as a b'' literal
+          // would be stored
+          uint64_t value = row->bitField(index);
+          size_t length = table.bit_lengths[index] ? table.bit_lengths[index] : sizeof(value);
+          std::string bytes(length, '\0');
+          for (size_t byte = length; byte > 0; byte--, value >>= 8)
+            bytes[byte - 1] = static_cast<char>(value & 0xFF);
+          append_field(&line, bytes.data(), bytes.size());
+          break;
+        }
+        case ::mysqlx::BYTES: {
+          size_t length;
+          const char *value = row->stringField(index, length);
+          append_field(&line, value, length);
+          break;
+        }
+        default:
+          throw shcore::Exception::runtime_error((boost::format("Unsupported data type on column '%1%'") %
+                                                  metadata->at(index).name).str());
+      }
+    }
+    line.push_back('\n');
+    stream.write(line.data(), line.size());
+
+    chunk->rows++;
+    if (++pending == PROGRESS_BLOCK) {
+      _dumped += pending;
+      pending = 0;
+    }
+  }
+  _dumped += pending;
+
+  stream.flush();
+  bool failed = stream.fail();
+  if (_compression == Gzip)
+    failed = !gzip.close() || failed;
+  else
+    file.close();
+
+  if (failed || file.fail())
+    throw shcore::Exception::runtime_error((boost::format("Error writing file '%1%'") % path).str());
+}
+
+void Dumper::write_manifest() {
+  shcore::Value::Array_type_ref tables(new shcore::Value::Array_type());
+  for (size_t index = 0; index < _tables.size(); index++) {
+    shcore::Value::Array_type_ref columns(new shcore::Value::Array_type());
+    for (auto &column : _tables[index].columns)
+      columns->push_back(shcore::Value(column));
+
+    shcore::Value::Array_type_ref chunks(new shcore::Value::Array_type());
+    for (auto &chunk : _chunks) {
+      if (chunk.table != index)
+        continue;
+
+      shcore::Value::Map_type_ref chunk_data(new shcore::Value::Map_type());
+      (*chunk_data)["file"] = shcore::Value(chunk.file);
+      (*chunk_data)["rows"] = shcore::Value(chunk.rows);
+      chunks->push_back(shcore::Value(chunk_data));
+    }
+
+    shcore::Value::Map_type_ref table(new shcore::Value::Map_type());
+    (*table)["name"] = shcore::Value(_tables[index].name);
+    (*table)["ddl"] = shcore::Value(encode_file_name(_tables[index].name) + ".sql");
+    (*table)["columns"] = shcore::Value(columns);
+    (*table)["chunks"] = shcore::Value(chunks);
+    tables->push_back(shcore::Value(table));
+  }
+
+  shcore::Value::Map_type_ref manifest(new shcore::Value::Map_type());
+  (*manifest)["schema"] = shcore::Value(_schema);
+  (*manifest)["compression"] = shcore::Value(_compression == Gzip ? "gzip" : "none");
+  (*manifest)["consistent"] = shcore::Value(_consistent);
+  (*manifest)["tables"] = shcore::Value(tables);
+
+  std::string path = _output_dir + "/" + manifest_name();
+  std::ofstream file(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  file << shcore::Value(manifest).json(true) << "\n";
+  file.close();
+  if (file.fail())
+    throw shcore::Exception::runtime_error((boost::format("Unable to write file '%1%'") % path).str());
+}
+
+void Dumper::report_progress(bool force) {
+  double seconds = elapsed();
+  if (!_progress || (!force && seconds - _last_report < 1))
+    return;
+
+  _last_report = seconds;
+  _progress(_dumped, seconds);
+}
+
+double Dumper::elapsed() const {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+}
+
+Dump_loader::Dump_loader(const std::string &input_dir) : _input_dir(input_dir), _batch_size(1000) {
+}
+
+shcore::Value::Map_type_ref Dump_loader::run(const std::vector<std::shared_ptr<BaseSession> > &sessions) {
+  if (sessions.empty())
+    throw shcore::Exception::argument_error("At least one session is required to load data");
+
+  std::string data;
+  std::string manifest_path = _input_dir + "/" + Dumper::manifest_name();
+  if (!shcore::load_text_file(manifest_path, data))
+    throw shcore::Exception::runtime_error((boost::format("Unable to read the dump manifest '%1%'") % manifest_path).str());
+
+  shcore::Value manifest = shcore::Value::parse(data);
+  if (manifest.type != shcore::Map || !manifest.as_map()->has_key("tables"))
+    throw shcore::Exception::runtime_error((boost::format("Invalid dump manifest '%1%'") % manifest_path).str());
+
+  shcore::Value::Map_type_ref manifest_data = manifest.as_map();
+  std::string schema = _schema.empty() ? manifest_data->get_string("schema") : _schema;
+  bool compressed = manifest_data->get_string("compression") == "gzip";
+  if (compressed && !Gzip_buffer::is_available())
+    throw shcore::Exception::runtime_error("The dump is compressed and the shell was built without zlib");
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  // The tables are not loaded in dependency order and the dumped data is
+  // known to be valid
+  std::shared_ptr< ::mysqlx::Session> ddl_session = sessions[0]->session_obj();
+  for (auto session : sessions) {
+    execute_sql(session->session_obj(), "SET FOREIGN_KEY_CHECKS = 0");
+    execute_sql(session->session_obj(), "SET UNIQUE_CHECKS = 0");
+  }
+
+  execute_sql(ddl_session, shcore::sqlstring("CREATE SCHEMA IF NOT EXISTS !", 0) << schema);
+  execute_sql(ddl_session, shcore::sqlstring("USE !", 0) << schema);
+
+  shcore::Value::Array_type_ref tables = manifest_data->get_array("tables");
+  for (auto &table : *tables) {
+    std::string ddl;
+    std::string ddl_path = _input_dir + "/" + table.as_map()->get_string("ddl");
+    if (!shcore::load_text_file(ddl_path, ddl))
+      throw shcore::Exception::runtime_error((boost::format("Unable to read file '%1%'") % ddl_path).str());
+
+    ddl.erase(ddl.find_last_not_of(" \t\r\n;") + 1);
+    execute_sql(ddl_session, ddl);
+  }
+
+  uint64_t loaded = 0;
+  for (auto &table : *tables) {
+    shcore::Value::Map_type_ref table_data = table.as_map();
+    for (auto &chunk : *table_data->get_array("chunks")) {
+      std::string path = _input_dir + "/" + chunk.as_map()->get_string("file");
+
+      Gzip_buffer gzip;
+      std::ifstream file;
+      std::streambuf *buffer;
+      if (compressed) {
+        if (!gzip.open(path, "rb"))
+          throw shcore::Exception::runtime_error((boost::format("Unable to open file '%1%'") % path).str());
+        buffer = &gzip;
+      } else {
+        file.open(path.c_str(), std::ios::in | std::ios::binary);
+        if (file.fail())
+          throw shcore::Exception::runtime_error((boost::format("Unable to open file '%1%'") % path).str());
+        buffer = file.rdbuf();
+      }
+      std::istream stream(buffer);
+
+      Importer importer(Importer::Csv, path, schema, table_data->get_string("name"));
+      importer.set_batch_size(_batch_size);
+      importer.set_binary(true);
+      if (_progress) {
+        importer.set_progress([this, loaded, start](uint64_t records, double) {
+          _progress(loaded + records, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        });
+      }
+
+      loaded += (*importer.run(stream, sessions))["records"].as_uint();
+    }
+  }
+
+  shcore::Value::Map_type_ref result(new shcore::Value::Map_type());
+  (*result)["tables"] = shcore::Value(static_cast<uint64_t>(tables->size()));
+  (*result)["rows"] = shcore::Value(loaded);
+  (*result)["seconds"] = shcore::Value(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+  return result;
+}
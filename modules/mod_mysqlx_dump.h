@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+// Parallel dump and load of a schema through several X Protocol sessions
+
+#ifndef _MOD_MYSQLX_DUMP_H_
+#define _MOD_MYSQLX_DUMP_H_
+
+#include "shellcore/types.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mysqlx {
+class Session;
+}
+
+namespace mysqlsh {
+namespace mysqlx {
+class BaseSession;
+
+/**
+ * File stream buffer reading or writing gzip compressed data.
+ *
+ * Only available when the shell is built with zlib, check is_available()
+ * before using it.
+ */
+class SHCORE_PUBLIC Gzip_buffer : public std::streambuf {
+public:
+  Gzip_buffer();
+  virtual ~Gzip_buffer();
+
+  static bool is_available();
+
+  // Mode is "rb" or "wb", returns false if the file can't be opened
+  bool open(const std::string &path, const char *mode);
+  bool close();
+
+protected:
+  virtual int_type overflow(int_type c);
+  virtual int_type underflow();
+  virtual int sync();
+
+private:
+  void *_file;
+  char _buffer[64 * 1024];
+};
+
+/**
+ * Dumps the tables of a schema into a directory.
+ *
+ * For every table the directory gets a file with its DDL and one or more CSV
+ * files with its data. Tables with a single integer column primary key are
+ * split in ranges of that key holding about chunk size rows each, so large
+ * tables are also read in parallel. A manifest named @.json lists the tables
+ * and their data files.
+ *
+ * One thread is started per session. When consistent, all the sessions start
+ * their transaction with a consistent snapshot while the tables are locked, so
+ * every chunk is read from the same point in time.
+ */
+class SHCORE_PUBLIC Dumper {
+public:
+  enum Compression { None, Gzip };
+
+  Dumper(const std::string &schema, const std::string &output_dir);
+
+  void set_chunk_size(uint64_t rows) { _chunk_size = rows; }
+  void set_compression(Compression compression) { _compression = compression; }
+  void set_consistent(bool consistent) { _consistent = consistent; }
+
+  // Called on the calling thread while the dump runs, at most once per second
+  void set_progress(std::function<void(uint64_t rows, double seconds)> callback) { _progress = callback; }
+
+  // Dumps the schema, returns a dictionary with the number of tables, chunks
+  // and rows dumped and the elapsed time
+  shcore::Value::Map_type_ref run(const std::vector<std::shared_ptr<BaseSession> > &sessions);
+
+  // Name of the manifest file on the output directory
+  static const char *manifest_name() { return "@.json"; }
+
+  // Escapes the characters not allowed on file names as %XX
+  static std::string encode_file_name(const std::string &name);
+
+  // Splits [min, max] in at most chunks consecutive ranges of the same size
+  static std::vector<std::pair<uint64_t, uint64_t> > split_range(uint64_t min, uint64_t max, uint64_t chunks);
+
+  // Appends a CSV field, quoting it when needed so Csv_reader reads it back
+  static void append_field(std::string *line, const char *data, size_t length);
+
+private:
+  struct Table {
+    std::string name;
+    std::string select;
+    std::vector<std::string> columns;
+    std::vector<size_t> bit_lengths;
+  };
+
+  struct Chunk {
+    size_t table;
+    std::string where;
+    std::string file;
+    uint64_t rows;
+  };
+
+  std::string _schema;
+  std::string _output_dir;
+  uint64_t _chunk_size;
+  Compression _compression;
+  bool _consistent;
+  std::function<void(uint64_t, double)> _progress;
+
+  std::vector<Table> _tables;
+  std::vector<Chunk> _chunks;
+
+  std::mutex _mutex;
+  std::condition_variable _finished;
+  std::atomic<size_t> _next_chunk;
+  std::atomic<uint64_t> _dumped;
+  std::string _error;
+
+  std::chrono::steady_clock::time_point _start;
+  double _last_report;
+
+  void start_transactions(const std::vector<std::shared_ptr< ::mysqlx::Session> > &sessions);
+  void read_tables(std::shared_ptr< ::mysqlx::Session> session);
+  void add_chunks(std::shared_ptr< ::mysqlx::Session> session, size_t table, const std::string &key,
+                  bool key_unsigned, uint64_t rows);
+  void dump(std::shared_ptr< ::mysqlx::Session> session);
+  void dump_chunk(std::shared_ptr< ::mysqlx::Session> session, Chunk *chunk);
+  void write_manifest();
+  void report_progress(bool force);
+  double elapsed() const;
+};
+
+/**
+ * Loads a directory created by Dumper into a schema.
+ *
+ * The tables are created first, then the data files are loaded one after the
+ * other, each of them in parallel through all the sessions.
+ */
+class SHCORE_PUBLIC Dump_loader {
+public:
+  Dump_loader(const std::string &input_dir);
+
+  // The schema to load into, by default the one that was dumped
+  void set_schema(const std::string &schema) { _schema = schema; }
+  void set_batch_size(size_t size) { _batch_size = size; }
+  void set_progress(std::function<void(uint64_t rows, double seconds)> callback) { _progress = callback; }
+
+  // Loads the dump, returns a dictionary with the number of tables and rows
+  // loaded and the elapsed time
+  shcore::Value::Map_type_ref run(const std::vector<std::shared_ptr<BaseSession> > &sessions);
+
+private:
+  std::string _input_dir;
+  std::string _schema;
+  size_t _batch_size;
+  std::function<void(uint64_t, double)> _progress;
+};
+}
+}
+
+#endif
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+#include "mod_mysqlx_import.h"
+#include "mod_mysqlx_collection_add.h"
+#include "mod_mysqlx_session.h"
+#include "mysqlxtest/mysqlx_crud.h"
+#include <boost/format.hpp>
+#include <fstream>
+#include <thread>
+
+using namespace mysqlsh::mysqlx;
+
+Csv_reader::Csv_reader(std::istream &stream, char separator) :
+_stream(stream), _separator(separator), _records(0) {
+}
+
+bool Csv_reader::next(std::vector<shcore::Value> *record) {
+  typedef std::istream::traits_type traits;
+  std::streambuf *buffer = _stream.rdbuf();
+
+  // Blank lines are skipped, a quoted empty field is not blank
+  bool blank;
+  do {
+    record->clear();
+    blank = true;
+
+    int c = buffer->sbumpc();
+    if (c == traits::eof())
+      return false;
+
+    std::string field;
+    bool quoted = false;
+    bool in_quotes = false;
+    for (;; c = buffer->sbumpc()) {
+      if (in_quotes) {
+        if (c == traits::eof())
+          throw shcore::Exception::runtime_error((boost::format("Unterminated quoted field on record %1%") % (_records + 1)).str());
+
+        if (c != '"')
+          field.push_back(static_cast<char>(c));
+        else if (buffer->sgetc() == '"')
+          field.push_back(static_cast<char>(buffer->sbumpc()));
+        else
+          in_quotes = false;
+      } else if (c == _separator || c == '\n' || c == traits::eof()) {
+        if (!quoted && field == "\\N")
+          record->push_back(shcore::Value::Null());
+        else
+          record->push_back(shcore::Value(std::move(field)));
+
+        field.clear();
+        quoted = false;
+
+        if (c != _separator)
+          break;
+
+        blank = false;
+      } else if (c == '"' && field.empty() && !quoted) {
+        quoted = in_quotes = true;
+        blank = false;
+      } else if (c != '\r' || buffer->sgetc() != '\n') {
+        field.push_back(static_cast<char>(c));
+        blank = false;
+      }
+    }
+  } while (blank);
+
+  _records++;
+
+  return true;
+}
+
+Importer::Importer(Format format, const std::string &path, const std::string &schema, const std::string &target) :
+_format(format), _path(path), _schema(schema), _target(target), _batch_size(1000), _separator(','), _header(true),
+_binary(false), _max_queued(0), _done(false), _loaded(0), _last_report(0) {
+}
+
+shcore::Value::Map_type_ref Importer::run(const std::vector<std::shared_ptr<BaseSession> > &sessions) {
+  std::ifstream stream(_path.c_str(), std::ios::in | std::ios::binary);
+  if (stream.fail())
+    throw shcore::Exception::runtime_error((boost::format("Unable to open file '%1%'") % _path).str());
+
+  return run(stream, sessions);
+}
+
+shcore::Value::Map_type_ref Importer::run(std::istream &stream, const std::vector<std::shared_ptr<BaseSession> > &sessions) {
+  if (sessions.empty())
+    throw shcore::Exception::argument_error("At least one session is required to import data");
+
+  _queue.clear();
+  _max_queued = 2 * sessions.size();
+  _done = false;
+  _error.clear();
+  _columns.clear();
+  _loaded = 0;
+  _start = std::chrono::steady_clock::now();
+  _last_report = 0;
+
+  size_t active = sessions.size();
+  std::vector<std::thread> loaders;
+  for (auto session : sessions) {
+    std::shared_ptr< ::mysqlx::Session> session_obj(session->session_obj());
+    loaders.push_back(std::thread([this, session_obj, &active]() {
+      load(session_obj);
+
+      std::lock_guard<std::mutex> lock(_mutex);
+      active--;
+      _queue_changed.notify_all();
+    }));
+  }
+
+  try {
+    read_chunks(stream);
+  } catch (std::exception &e) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_error.empty())
+      _error = e.what();
+  }
+
+  // Waits for the loaders to complete the queued chunks
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done = true;
+    _queue_changed.notify_all();
+
+    while (active) {
+      _queue_changed.wait_for(lock, std::chrono::seconds(1));
+
+      lock.unlock();
+      report_progress(false);
+      lock.lock();
+    }
+  }
+
+  for (auto &loader : loaders)
+    loader.join();
+
+  report_progress(true);
+
+  if (!_error.empty())
+    throw shcore::Exception::runtime_error(_error);
+
+  shcore::Value::Map_type_ref result(new shcore::Value::Map_type());
+  (*result)["records"] = shcore::Value(static_cast<uint64_t>(_loaded));
+  (*result)["seconds"] = shcore::Value(elapsed());
+
+  return result;
+}
+
+void Importer::read_chunks(std::istream &stream) {
+  std::shared_ptr<Chunk> chunk;
+  uint64_t record = 0;
+
+  if (_format == Json) {
+    std::string line;
+    while (std::getline(stream, line)) {
+      if (line.find_first_not_of(" \t\r") == std::string::npos)
+        continue;
+
+      if (!chunk) {
+        chunk.reset(new Chunk());
+        chunk->first_record = record + 1;
+        chunk->documents.reserve(_batch_size);
+      }
+
+      chunk->documents.push_back(std::move(line));
+      record++;
+
+      if (chunk->size() == _batch_size) {
+        if (!push(chunk))
+          return;
+        chunk.reset();
+      }
+    }
+  } else {
+    Csv_reader reader(stream, _separator);
+    std::vector<shcore::Value> row;
+
+    if (_header && reader.next(&row)) {
+      for (auto &column : row) {
+        if (column.type != shcore::String)
+          throw shcore::Exception::runtime_error("Invalid column name on the CSV header");
+        _columns.push_back(column.as_string());
+      }
+    }
+
+    while (reader.next(&row)) {
+      if (!chunk) {
+        chunk.reset(new Chunk());
+        chunk->first_record = record + 1;
+        chunk->rows.reserve(_batch_size);
+      }
+
+      chunk->rows.push_back(std::move(row));
+      row = std::vector<shcore::Value>();
+      record++;
+
+      if (chunk->size() == _batch_size) {
+        if (!push(chunk))
+          return;
+        chunk.reset();
+      }
+    }
+  }
+
+  if (chunk)
+    push(chunk);
+}
+
+// Queues a chunk for the loaders, waiting while the queue is full.
+// Returns false if the import failed
+bool Importer::push(std::shared_ptr<Chunk> chunk) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (_queue.size() >= _max_queued && _error.empty()) {
+    _queue_changed.wait_for(lock, std::chrono::seconds(1));
+
+    lock.unlock();
+    report_progress(false);
+    lock.lock();
+  }
+
+  if (!_error.empty())
+    return false;
+
+  _queue.push_back(chunk);
+  _queue_changed.notify_all();
+
+  return true;
+}
+
+// Returns the next chunk to load, or NULL once the import is done or failed
+std::shared_ptr<Importer::Chunk> Importer::pop() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _queue_changed.wait(lock, [this]() { return !_queue.empty() || _done || !_error.empty(); });
+
+  std::shared_ptr<Chunk> chunk;
+  if (_error.empty() && !_queue.empty()) {
+    chunk = _queue.front();
+    _queue.pop_front();
+    _queue_changed.notify_all();
+  }
+
+  return chunk;
+}
+
+void Importer::load(std::shared_ptr< ::mysqlx::Session> session) {
+  std::shared_ptr<Chunk> chunk;
+  while ((chunk = pop())) {
+    try {
+      if (_format == Json)
+        load_documents(session, *chunk);
+      else
+        load_rows(session, *chunk);
+
+      _loaded += chunk->size();
+    } catch (std::exception &e) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_error.empty())
+        _error = (boost::format("Error loading records %1% to %2%: %3%") % chunk->first_record %
+                  (chunk->first_record + chunk->size() - 1) % e.what()).str();
+
+      _queue_changed.notify_all();
+      return;
+    }
+  }
+}
+
+void Importer::load_documents(std::shared_ptr< ::mysqlx::Session> session, const Chunk &chunk) {
+  ::mysqlx::AddStatement statement(session->getSchema(_schema)->getCollection(_target));
+
+  for (size_t index = 0; index < chunk.documents.size(); index++) {
+    shcore::Value document = shcore::Value::parse(chunk.documents[index]);
+    if (document.type != shcore::Map)
+      throw shcore::Exception::runtime_error((boost::format("Record %1% is not a JSON document") %
+                                              (chunk.first_record + index)).str());
+
+    shcore::Value::Map_type_ref map(document.as_map());
+    if (!map->has_key("_id"))
+      (*map)["_id"] = shcore::Value(CollectionAdd::get_new_uuid());
+    else if ((*map)["_id"].type != shcore::String)
+      throw shcore::Exception::runtime_error((boost::format("Invalid data type for _id field on record %1%, should be a string") %
+                                              (chunk.first_record + index)).str());
+
+    statement.add(CollectionAdd::convert_document(document), (*map)["_id"].as_string());
+  }
+
+  statement.execute();
+}
+
+void Importer::load_rows(std::shared_ptr< ::mysqlx::Session> session, const Chunk &chunk) {
+  ::mysqlx::InsertStatement statement(session->getSchema(_schema)->getTable(_target)->insert());
+  ::mysqlx::Insert_Values &values = _columns.empty() ? statement : statement.insert(_columns);
+
+  std::vector< ::mysqlx::TableValue> fields;
+  for (auto &row : chunk.rows) {
+    fields.clear();
+    for (auto &field : row) {
+      if (field.type == shcore::Null)
+        fields.push_back(::mysqlx::TableValue());
+      else
+        fields.push_back(::mysqlx::TableValue(field.as_string(),
+                                              _binary ? ::mysqlx::TableValue::TOctets : ::mysqlx::TableValue::TString));
+    }
+
+    values.values(fields);
+  }
+
+  values.execute();
+}
+
+void Importer::report_progress(bool force) {
+  double seconds = elapsed();
+  if (!_progress || (!force && seconds - _last_report < 1))
+    return;
+
+  _last_report = seconds;
+  _progress(_loaded, seconds);
+}
+
+double Importer::elapsed() const {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+// Bulk loading of data files through several X Protocol sessions
+
+#ifndef _MOD_MYSQLX_IMPORT_H_
+#define _MOD_MYSQLX_IMPORT_H_
+
+#include "shellcore/types.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mysqlx {
+class Session;
+}
+
+namespace mysqlsh {
+namespace mysqlx {
+class BaseSession;
+
+/**
+ * Reads the records of a CSV stream.
+ *
+ * Fields may be enclosed in double quotes, in which case they can contain the
+ * separator, new lines and "" for a quote. An unquoted \N is read as NULL.
+ */
+class SHCORE_PUBLIC Csv_reader {
+public:
+  Csv_reader(std::istream &stream, char separator = ',');
+
+  // Returns false when there are no more records
+  bool next(std::vector<shcore::Value> *record);
+
+  // Number of records read so far
+  uint64_t records() const { return _records; }
+
+private:
+  std::istream &_stream;
+  char _separator;
+  uint64_t _records;
+};
+
+/**
+ * Loads a file into a collection (newline delimited JSON documents) or a table
+ * (CSV rows).
+ *
+ * The file is read in chunks of batch size records which are inserted in
+ * parallel, each loader thread using its own session. At most two chunks per
+ * thread are kept in memory, so the file size does not matter.
+ */
+class SHCORE_PUBLIC Importer {
+public:
+  enum Format { Json, Csv };
+
+  Importer(Format format, const std::string &path, const std::string &schema, const std::string &target);
+
+  void set_batch_size(size_t size) { _batch_size = size; }
+  void set_separator(char separator) { _separator = separator; }
+  void set_header(bool header) { _header = header; }
+
+  // Sends the CSV fields as binary strings, so they are stored byte by byte
+  // whatever the connection character set is
+  void set_binary(bool binary) { _binary = binary; }
+
+  // Called on the calling thread while the import runs, at most once per second
+  void set_progress(std::function<void(uint64_t records, double seconds)> callback) { _progress = callback; }
+
+  // Imports the file, one loader thread is started per session. Returns a
+  // dictionary with the number of records loaded and the elapsed time
+  shcore::Value::Map_type_ref run(const std::vector<std::shared_ptr<BaseSession> > &sessions);
+
+  // Same as above but reading the records from the given stream instead of
+  // the file
+  shcore::Value::Map_type_ref run(std::istream &stream, const std::vector<std::shared_ptr<BaseSession> > &sessions);
+
+private:
+  struct Chunk {
+    uint64_t first_record;
+    std::vector<std::string> documents;
+    std::vector<std::vector<shcore::Value> > rows;
+
+    size_t size() const { return documents.size() + rows.size(); }
+  };
+
+  Format _format;
+  std::string _path;
+  std::string _schema;
+  std::string _target;
+  size_t _batch_size;
+  char _separator;
+  bool _header;
+  bool _binary;
+  std::function<void(uint64_t, double)> _progress;
+
+  std::vector<std::string> _columns;
+
+  std::mutex _mutex;
+  std::condition_variable _queue_changed;
+  std::deque<std::shared_ptr<Chunk> > _queue;
+  size_t _max_queued;
+  bool _done;
+  std::string _error;
+  std::atomic<uint64_t> _loaded;
+
+  std::chrono::steady_clock::time_point _start;
+  double _last_report;
+
+  void read_chunks(std::istream &stream);
+  bool push(std::shared_ptr<Chunk> chunk);
+  std::shared_ptr<Chunk> pop();
+  void load(std::shared_ptr< ::mysqlx::Session> session);
+  void load_documents(std::shared_ptr< ::mysqlx::Session> session, const Chunk &chunk);
+  void load_rows(std::shared_ptr< ::mysqlx::Session> session, const Chunk &chunk);
+  void report_progress(bool force);
+  double elapsed() const;
+};
+}
+}
+
+#endif
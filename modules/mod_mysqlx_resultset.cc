@@ -37,10 +37,23 @@ using namespace mysqlsh::mysqlx;
 REGISTER_HELP(BASERESULT_BRIEF, "Base class for the different types of results returned by the server.");
 
 BaseResult::BaseResult(std::shared_ptr< ::mysqlx::Result> result) :
-_result(result), _execution_time(0) {
-  add_property("executionTime", "getExecutionTime");
-  add_property("warningCount", "getWarningCount");
-  add_property("warnings", "getWarnings");
+BaseResult(result, class_members()) {
+}
+
+BaseResult::BaseResult(std::shared_ptr< ::mysqlx::Result> result, const shcore::Cpp_member_registry &members) :
+ShellBaseResult(members), _result(result), _execution_time(0) {
+}
+
+const shcore::Cpp_member_registry &BaseResult::class_members() {
+  static shcore::Cpp_member_registry members = []() {
+    shcore::Cpp_member_registry ret_val;
+    ret_val.add_property("executionTime", "getExecutionTime");
+    ret_val.add_property("warningCount", "getWarningCount");
+    ret_val.add_property("warnings", "getWarnings");
+    return ret_val;
+  }();
+
+  return members;
 }
 
 // Documentation of getWarnings function
@@ -184,11 +197,20 @@ REGISTER_HELP(RESULT_DETAIL4, "@li Transaction handling functions");
 REGISTER_HELP(RESULT_DETAIL5, "@li Transaction handling functions");
 
 Result::Result(std::shared_ptr< ::mysqlx::Result> result) :
-BaseResult(result) {
-  add_property("affectedItemCount", "getAffectedItemCount");
-  add_property("autoIncrementValue", "getAutoIncrementValue");
-  add_property("lastDocumentId", "getLastDocumentId");
-  add_property("lastDocumentIds", "getLastDocumentIds");
+BaseResult(result, class_members()) {
+}
+
+const shcore::Cpp_member_registry &Result::class_members() {
+  static shcore::Cpp_member_registry members = []() {
+    shcore::Cpp_member_registry ret_val(BaseResult::class_members());
+    ret_val.add_property("affectedItemCount", "getAffectedItemCount");
+    ret_val.add_property("autoIncrementValue", "getAutoIncrementValue");
+    ret_val.add_property("lastDocumentId", "getLastDocumentId");
+    ret_val.add_property("lastDocumentIds", "getLastDocumentIds");
+    return ret_val;
+  }();
+
+  return members;
 }
 
 shcore::Value Result::get_member(const std::string &prop) const {
@@ -319,9 +341,18 @@ void Result::append_json(shcore::JSON_dumper& dumper) const {
 REGISTER_HELP(DOCRESULT_BRIEF, "Allows traversing the DbDoc objects returned by a Collection.find operation.");
 
 DocResult::DocResult(std::shared_ptr< ::mysqlx::Result> result) :
-BaseResult(result) {
-  add_method("fetchOne", std::bind(&DocResult::fetch_one, this, _1), "nothing", shcore::String, NULL);
-  add_method("fetchAll", std::bind(&DocResult::fetch_all, this, _1), "nothing", shcore::String, NULL);
+BaseResult(result, class_members()) {
+}
+
+const shcore::Cpp_member_registry &DocResult::class_members() {
+  static shcore::Cpp_member_registry members = []() {
+    shcore::Cpp_member_registry ret_val(BaseResult::class_members());
+    ret_val.add_method("fetchOne", shcore::Cpp_member_registry::method(&DocResult::fetch_one), "nothing", shcore::String, NULL);
+    ret_val.add_method("fetchAll", shcore::Cpp_member_registry::method(&DocResult::fetch_all), "nothing", shcore::String, NULL);
+    return ret_val;
+  }();
+
+  return members;
 }
 
 // Documentation of fetchOne function
@@ -346,8 +377,12 @@ shcore::Value DocResult::fetch_one(const shcore::Argument_list &args) const {
   try {
     if (_result->columnMetadata() && _result->columnMetadata()->size()) {
       std::shared_ptr< ::mysqlx::Row> r(_result->next());
-      if (r.get())
-        ret_val = Value::parse(r->stringField(0));
+      if (r.get()) {
+        // Parsed from the row buffer, without copying the document first
+        size_t length;
+        const char *document = r->stringField(0, length);
+        ret_val = Value::parse(document, length);
+      }
     }
   }
   CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("fetchOne"));
@@ -442,13 +477,26 @@ void DocResult::append_json(shcore::JSON_dumper& dumper) const {
 REGISTER_HELP(ROWRESULT_BRIEF, "Allows traversing the Row objects returned by a Table.select operation.");
 
 RowResult::RowResult(std::shared_ptr< ::mysqlx::Result> result) :
-BaseResult(result) {
-  add_property("columnCount", "getColumnCount");
-  add_property("columns", "getColumns");
-  add_property("columnNames", "getColumnNames");
+RowResult(result, class_members()) {
+}
+
+RowResult::RowResult(std::shared_ptr< ::mysqlx::Result> result, const shcore::Cpp_member_registry &members) :
+BaseResult(result, members) {
+}
+
+const shcore::Cpp_member_registry &RowResult::class_members() {
+  static shcore::Cpp_member_registry members = []() {
+    shcore::Cpp_member_registry ret_val(BaseResult::class_members());
+    ret_val.add_property("columnCount", "getColumnCount");
+    ret_val.add_property("columns", "getColumns");
+    ret_val.add_property("columnNames", "getColumnNames");
+
+    ret_val.add_method("fetchOne", shcore::Cpp_member_registry::method(&RowResult::fetch_one), "nothing", shcore::String, NULL);
+    ret_val.add_method("fetchAll", shcore::Cpp_member_registry::method(&RowResult::fetch_all), "nothing", shcore::String, NULL);
+    return ret_val;
+  }();
 
-  add_method("fetchOne", std::bind(&RowResult::fetch_one, this, _1), "nothing", shcore::String, NULL);
-  add_method("fetchAll", std::bind(&RowResult::fetch_all, this, _1), "nothing", shcore::String, NULL);
+  return members;
 }
 
 shcore::Value RowResult::get_member(const std::string &prop) const {
@@ -669,6 +717,70 @@ shcore::Value::Array_type_ref RowResult::get_columns() const {
   return _columns;
 }
 
+namespace {
+// Decodes the fields from the protobuf row only when they are accessed
+class Row_data : public mysqlsh::Row_source {
+public:
+  Row_data(std::shared_ptr<std::vector< ::mysqlx::ColumnMetadata> > metadata, std::shared_ptr< ::mysqlx::Row> row)
+    : _metadata(metadata), _row(row) {}
+
+  virtual Value get_value(size_t index) const {
+    Value ret_val;
+    int field = static_cast<int>(index);
+
+    if (_row->isNullField(field))
+      return Value::Null();
+
+    switch ((*_metadata)[index].type) {
+      case ::mysqlx::SINT:
+        ret_val = Value(_row->sInt64Field(field));
+        break;
+      case ::mysqlx::UINT:
+        ret_val = Value(_row->uInt64Field(field));
+        break;
+      case ::mysqlx::DOUBLE:
+        ret_val = Value(_row->doubleField(field));
+        break;
+      case ::mysqlx::FLOAT:
+        ret_val = Value(_row->floatField(field));
+        break;
+      case ::mysqlx::BYTES:
+        ret_val = Value(_row->stringField(field));
+        break;
+      case ::mysqlx::DECIMAL:
+        ret_val = Value(_row->decimalField(field));
+        break;
+      case ::mysqlx::TIME:
+        ret_val = Value(_row->timeField(field).to_string());
+        break;
+      case ::mysqlx::DATETIME:
+      {
+        ::mysqlx::DateTime date = _row->dateTimeField(field);
+        std::shared_ptr<shcore::Date> shell_date(new shcore::Date(date.year(), date.month(), date.day(), date.hour(), date.minutes(), date.seconds()));
+        ret_val = Value(std::static_pointer_cast<Object_bridge>(shell_date));
+        break;
+      }
+      case ::mysqlx::ENUM:
+        ret_val = Value(_row->enumField(field));
+        break;
+      case ::mysqlx::BIT:
+        ret_val = Value(_row->bitField(field));
+        break;
+        //TODO: Fix the handling of SET
+      case ::mysqlx::SET:
+        //ret_val = Value(_row->setField(field));
+        break;
+    }
+
+    return ret_val;
+  }
+
+private:
+  std::shared_ptr<std::vector< ::mysqlx::ColumnMetadata> > _metadata;
+  std::shared_ptr< ::mysqlx::Row> _row;
+};
+}
+
 // Documentation of fetchOne function
 REGISTER_HELP(ROWRESULT_FETCHONE_BRIEF, "Retrieves the next Row on the RowResult.");
 REGISTER_HELP(ROWRESULT_FETCHONE_RETURN, "@return A Row object representing the next record on the result.");
@@ -692,57 +804,9 @@ shcore::Value RowResult::fetch_one(const shcore::Argument_list &args) const {
     if (metadata->size() > 0) {
       std::shared_ptr< ::mysqlx::Row>row = _result->next();
       if (row) {
-        mysqlsh::Row *value_row = new mysqlsh::Row();
-
-        for (int index = 0; index < int(metadata->size()); index++) {
-          Value field_value;
-
-          if (row->isNullField(index))
-            field_value = Value::Null();
-          else {
-            switch (metadata->at(index).type) {
-              case ::mysqlx::SINT:
-                field_value = Value(row->sInt64Field(index));
-                break;
-              case ::mysqlx::UINT:
-                field_value = Value(row->uInt64Field(index));
-                break;
-              case ::mysqlx::DOUBLE:
-                field_value = Value(row->doubleField(index));
-                break;
-              case ::mysqlx::FLOAT:
-                field_value = Value(row->floatField(index));
-                break;
-              case ::mysqlx::BYTES:
-                field_value = Value(row->stringField(index));
-                break;
-              case ::mysqlx::DECIMAL:
-                field_value = Value(row->decimalField(index));
-                break;
-              case ::mysqlx::TIME:
-                field_value = Value(row->timeField(index).to_string());
-                break;
-              case ::mysqlx::DATETIME:
-              {
-                ::mysqlx::DateTime date = row->dateTimeField(index);
-                std::shared_ptr<shcore::Date> shell_date(new shcore::Date(date.year(), date.month(), date.day(), date.hour(), date.minutes(), date.seconds()));
-                field_value = Value(std::static_pointer_cast<Object_bridge>(shell_date));
-                break;
-              }
-              case ::mysqlx::ENUM:
-                field_value = Value(row->enumField(index));
-                break;
-              case ::mysqlx::BIT:
-                field_value = Value(row->bitField(index));
-                break;
-                //TODO: Fix the handling of SET
-              case ::mysqlx::SET:
-                //field_value = Value(row->setField(int(index)));
-                break;
-            }
-          }
-          value_row->add_item(metadata->at(index).name, field_value);
-        }
+        // The fields are decoded when accessed
+        mysqlsh::Row *value_row = new mysqlsh::Row(get_row_definition(metadata),
+                                                   std::shared_ptr<mysqlsh::Row_source>(new Row_data(metadata, row)));
 
         ret_val = shcore::Value::wrap(value_row);
       }
@@ -753,6 +817,20 @@ shcore::Value RowResult::fetch_one(const shcore::Argument_list &args) const {
   return ret_val;
 }
 
+std::shared_ptr<mysqlsh::Row_definition> RowResult::get_row_definition(std::shared_ptr<std::vector< ::mysqlx::ColumnMetadata> > metadata) const {
+  // A new metadata is read for every result on the statement
+  if (metadata != _row_metadata) {
+    _row_definition.reset(new mysqlsh::Row_definition());
+
+    for (const auto &column : *metadata)
+      _row_definition->add_field(column.name);
+
+    _row_metadata = metadata;
+  }
+
+  return _row_definition;
+}
+
 // Documentation of fetchAll function
 REGISTER_HELP(ROWRESULT_FETCHALL_BRIEF, "Returns a list of DbDoc objects which contains an element for every unread document.");
 REGISTER_HELP(ROWRESULT_FETCHALL_RETURN, "@return A List of DbDoc objects.");
@@ -800,11 +878,20 @@ void RowResult::append_json(shcore::JSON_dumper& dumper) const {
 REGISTER_HELP(SQLRESULT_BRIEF, "Allows browsing through the result information after performing an operation on the database done through NodeSession.sql");
 
 SqlResult::SqlResult(std::shared_ptr< ::mysqlx::Result> result) :
-RowResult(result) {
-  add_method("hasData", std::bind(&SqlResult::has_data, this, _1), "nothing", shcore::String, NULL);
-  add_method("nextDataSet", std::bind(&SqlResult::next_data_set, this, _1), "nothing", shcore::String, NULL);
-  add_property("autoIncrementValue", "getAutoIncrementValue");
-  add_property("affectedRowCount", "getAffectedRowCount");
+RowResult(result, class_members()) {
+}
+
+const shcore::Cpp_member_registry &SqlResult::class_members() {
+  static shcore::Cpp_member_registry members = []() {
+    shcore::Cpp_member_registry ret_val(RowResult::class_members());
+    ret_val.add_method("hasData", shcore::Cpp_member_registry::method(&SqlResult::has_data), "nothing", shcore::String, NULL);
+    ret_val.add_method("nextDataSet", shcore::Cpp_member_registry::method(&SqlResult::next_data_set), "nothing", shcore::String, NULL);
+    ret_val.add_property("autoIncrementValue", "getAutoIncrementValue");
+    ret_val.add_property("affectedRowCount", "getAffectedRowCount");
+    return ret_val;
+  }();
+
+  return members;
 }
 
 // Documentation of hasData function
@@ -27,6 +27,7 @@
 
 namespace mysqlx {
 class Result;
+struct ColumnMetadata;
 }
 
 namespace mysqlsh {
@@ -72,6 +73,10 @@ public:
 #endif
 
 protected:
+  // For the derived classes, which extend the members of the base class
+  BaseResult(std::shared_ptr< ::mysqlx::Result> result, const shcore::Cpp_member_registry &members);
+  static const shcore::Cpp_member_registry &class_members();
+
   std::shared_ptr< ::mysqlx::Result> _result;
   unsigned long _execution_time;
 };
@@ -122,6 +127,9 @@ public:
   int get_auto_increment_value();
   str get_last_document_id();
 #endif
+
+private:
+  static const shcore::Cpp_member_registry &class_members();
 };
 
 /**
@@ -150,6 +158,8 @@ public:
 #endif
 
 private:
+  static const shcore::Cpp_member_registry &class_members();
+
   mutable shcore::Value _metadata;
 };
 
@@ -199,8 +209,17 @@ public:
   list get_columns();
 #endif
 
+protected:
+  RowResult(std::shared_ptr< ::mysqlx::Result> result, const shcore::Cpp_member_registry &members);
+  static const shcore::Cpp_member_registry &class_members();
+
 private:
   mutable shcore::Value::Array_type_ref _columns;
+
+  // Field names shared by the rows of the active result
+  std::shared_ptr<Row_definition> get_row_definition(std::shared_ptr<std::vector< ::mysqlx::ColumnMetadata> > metadata) const;
+  mutable std::shared_ptr<Row_definition> _row_definition;
+  mutable std::shared_ptr<std::vector< ::mysqlx::ColumnMetadata> > _row_metadata;
 };
 
 /**
@@ -244,6 +263,9 @@ public:
   bool has_data();
   bool next_data_set();
 #endif
+
+private:
+  static const shcore::Cpp_member_registry &class_members();
 };
 }
 };
@@ -405,6 +405,54 @@ std::shared_ptr< ::mysqlx::Result> BaseSession::execute_sql(const std::string &s
   return result;
 }
 
+std::shared_ptr< ::mysqlx::Result> BaseSession::send_sql(const std::string &sql, bool stop_on_error) const {
+  std::shared_ptr< ::mysqlx::Result> result;
+  try {
+    result = _session.send_sql(sql, stop_on_error);
+  } catch (const ::mysqlx::Error &e) {
+    if (e.error() == 2006 || e.error() == 5166 || e.error() == 2013) {
+      std::shared_ptr<BaseSession> myself = std::dynamic_pointer_cast<BaseSession>(_get_shared_this());
+      ShellNotifications::get()->notify("SN_SESSION_CONNECTION_LOST", std::dynamic_pointer_cast<Cpp_object_bridge>(myself));
+    }
+
+    // Rethrows the exception for normal flow
+    throw;
+  }
+
+  return result;
+}
+
+// Waits for the result of a statement sent with send_sql, the execution time
+// is the time spent waiting for it as the statement runs while others are sent
+shcore::Value BaseSession::get_sql_result(std::shared_ptr< ::mysqlx::Result> exec_result) const {
+  MySQL_timer timer;
+  Value ret_val;
+
+  try {
+    timer.start();
+    _session.wait_result(exec_result);
+    timer.end();
+
+    SqlResult *result = new SqlResult(exec_result);
+    result->set_execution_time(timer.raw_duration());
+    ret_val = shcore::Value::wrap(result);
+  } catch (const ::mysqlx::Error &e) {
+    if (e.error() == 2006 || e.error() == 5166 || e.error() == 2013) {
+      std::shared_ptr<BaseSession> myself = std::dynamic_pointer_cast<BaseSession>(_get_shared_this());
+      ShellNotifications::get()->notify("SN_SESSION_CONNECTION_LOST", std::dynamic_pointer_cast<Cpp_object_bridge>(myself));
+    }
+
+    // Rethrows the exception for normal flow
+    throw;
+  }
+
+  return ret_val;
+}
+
+void BaseSession::read_pending_results() const {
+  _session.read_pending_results();
+}
+
 Value BaseSession::executeAdminCommand(const std::string& command, bool expect_data, const Argument_list &args) const {
   std::string function = class_name() + '.' + "executeAdminCommand";
   args.ensure_at_least(1, function.c_str());
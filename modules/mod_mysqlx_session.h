@@ -80,8 +80,8 @@ public:
   Result dropCollection(String schema, String name);
   Result dropView(String schema, String name);
   Bool isOpen();
-
-private:
+
+private:
 #elif DOXYGEN_PY
   str uri; //!< Same as get_uri()
   Schema default_schema; //!< Same as get_default_schema()
@@ -101,7 +101,7 @@ private:
   Result drop_collection(str schema, str name);
   Result drop_view(str schema, str name);
   Bool is_open();
-private:
+private:
 #endif
 
   BaseSession();
@@ -121,6 +121,13 @@ private:
   shcore::Value executeAdminCommand(const std::string& command, bool expect_data, const shcore::Argument_list &args) const;
   virtual shcore::Value execute_sql(const std::string& query, const shcore::Argument_list &args) const;
   std::shared_ptr< ::mysqlx::Result> execute_sql(const std::string &sql) const;
+
+  // Pipelined SQL execution, results must be retrieved in the order the
+  // statements were sent
+  std::shared_ptr< ::mysqlx::Result> send_sql(const std::string &sql, bool stop_on_error) const;
+  shcore::Value get_sql_result(std::shared_ptr< ::mysqlx::Result> exec_result) const;
+  void read_pending_results() const;
+
   virtual bool is_connected() const;
   virtual shcore::Value get_status(const shcore::Argument_list &args);
   virtual shcore::Value get_capability(const std::string& name);
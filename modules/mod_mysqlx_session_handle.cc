@@ -85,6 +85,31 @@ std::shared_ptr< ::mysqlx::Result> SessionHandle::execute_sql(const std::string
   return ret_val;
 }
 
+std::shared_ptr< ::mysqlx::Result> SessionHandle::send_sql(const std::string &sql, bool stop_on_error) const {
+  std::shared_ptr< ::mysqlx::Result> ret_val;
+
+  try {
+    ret_val = _session->connection()->send_sql(sql, stop_on_error);
+  }
+  CATCH_AND_TRANSLATE();
+
+  return ret_val;
+}
+
+void SessionHandle::wait_result(std::shared_ptr< ::mysqlx::Result> result) const {
+  try {
+    result->wait();
+  }
+  CATCH_AND_TRANSLATE();
+}
+
+void SessionHandle::read_pending_results() const {
+  try {
+    _session->connection()->read_pending_results();
+  }
+  CATCH_AND_TRANSLATE();
+}
+
 void SessionHandle::enable_protocol_trace(bool value) {
   _session->connection()->set_trace_protocol(value);
 }
@@ -45,6 +45,12 @@ public:
             const std::string &auth_method = "MYSQL41", const bool get_caps = false);
 
   std::shared_ptr< ::mysqlx::Result> execute_sql(const std::string &sql) const;
+
+  // Pipelined SQL execution: the result is returned without waiting for it
+  std::shared_ptr< ::mysqlx::Result> send_sql(const std::string &sql, bool stop_on_error) const;
+  void wait_result(std::shared_ptr< ::mysqlx::Result> result) const;
+  void read_pending_results() const;
+
   void enable_protocol_trace(bool value);
   void reset();
   std::shared_ptr< ::mysqlx::Result> execute_statement(const std::string &domain, const std::string& command, const shcore::Argument_list &args) const;
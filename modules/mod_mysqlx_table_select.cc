@@ -449,6 +449,9 @@ shcore::Value TableSelect::bind(const shcore::Argument_list &args) {
 * Executes the Find operation with all the configured options and returns.
 * \return RowResult A Row result object that can be used to traverse the records returned by rge select operation.
 *
+* The operation can be executed again, after binding new values or not: the encoded
+* statement is reused and only the bound values are encoded again.
+*
 * #### Method Chaining
 *
 * This function can be invoked after any other function on this class.
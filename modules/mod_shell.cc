@@ -23,6 +23,10 @@
 #include "utils/utils_help.h"
 #include "modules/adminapi/mod_dba_common.h"
 #include "modules/base_session.h"
+#include "modules/mod_mysqlx_dump.h"
+#include "modules/mod_mysqlx_import.h"
+#include "modules/mod_mysqlx_session.h"
+#include <boost/format.hpp>
 
 using namespace std::placeholders;
 
@@ -46,6 +50,10 @@ void Shell::init() {
   add_method("parseUri", std::bind(&Shell::parse_uri, this, _1), "uri", shcore::String, NULL);
   add_varargs_method("prompt", std::bind(&Shell::prompt, this, _1));
   add_varargs_method("connect", std::bind(&Shell::connect, this, _1));
+  add_varargs_method("importJson", std::bind(&Shell::import_json, this, _1));
+  add_varargs_method("importCsv", std::bind(&Shell::import_csv, this, _1));
+  add_varargs_method("dumpSchema", std::bind(&Shell::dump_schema, this, _1));
+  add_varargs_method("loadDump", std::bind(&Shell::load_dump, this, _1));
 }
 
 Shell::~Shell() {}
@@ -302,4 +310,385 @@ shcore::Value Shell::connect(const shcore::Argument_list &args) {
 
   return shcore::Value();
 }
-}
\ No newline at end of file
+
+REGISTER_HELP(SHELL_IMPORTJSON_BRIEF, "Loads a file with a JSON document per line into a collection.");
+REGISTER_HELP(SHELL_IMPORTJSON_PARAM, "@param file the path to the file to be loaded.");
+REGISTER_HELP(SHELL_IMPORTJSON_PARAM1, "@param options dictionary with the import options.");
+REGISTER_HELP(SHELL_IMPORTJSON_RETURN, "@return A dictionary with the number of records loaded and the seconds it took.");
+REGISTER_HELP(SHELL_IMPORTJSON_DETAIL, "The file is read in chunks which are added to the collection in parallel, "\
+"each loader thread using its own session opened with the connection data of the global session, "\
+"which must be an X Protocol session. Documents with no _id field get one generated.");
+REGISTER_HELP(SHELL_IMPORTJSON_DETAIL1, "The options dictionary may contain the following attributes:");
+REGISTER_HELP(SHELL_IMPORTJSON_DETAIL2, "@li collection: the target collection, mandatory.");
+REGISTER_HELP(SHELL_IMPORTJSON_DETAIL3, "@li schema: the schema of the collection, defaults to the session schema.");
+REGISTER_HELP(SHELL_IMPORTJSON_DETAIL4, "@li threads: the number of loader threads, defaults to 4.");
+REGISTER_HELP(SHELL_IMPORTJSON_DETAIL5, "@li batchSize: the number of records inserted per statement, defaults to 1000.");
+REGISTER_HELP(SHELL_IMPORTJSON_DETAIL6, "@li showProgress: boolean value, prints the load progress every second, defaults to true.");
+REGISTER_HELP(SHELL_IMPORTJSON_DETAIL7, "Chunks are inserted independently, if a chunk fails the ones already loaded remain in the collection.");
+
+/**
+ * $(SHELL_IMPORTJSON_BRIEF)
+ *
+ * $(SHELL_IMPORTJSON_PARAM)
+ * $(SHELL_IMPORTJSON_PARAM1)
+ *
+ * $(SHELL_IMPORTJSON_RETURN)
+ *
+ * $(SHELL_IMPORTJSON_DETAIL)
+ *
+ * $(SHELL_IMPORTJSON_DETAIL1)
+ * $(SHELL_IMPORTJSON_DETAIL2)
+ * $(SHELL_IMPORTJSON_DETAIL3)
+ * $(SHELL_IMPORTJSON_DETAIL4)
+ * $(SHELL_IMPORTJSON_DETAIL5)
+ * $(SHELL_IMPORTJSON_DETAIL6)
+ *
+ * $(SHELL_IMPORTJSON_DETAIL7)
+ */
+#if DOXYGEN_JS
+Dictionary Shell::importJson(String file, Dictionary options){}
+#elif DOXYGEN_PY
+dict Shell::import_json(str file, dict options){}
+#endif
+shcore::Value Shell::import_json(const shcore::Argument_list &args) {
+  args.ensure_count(2, get_function_name("importJson").c_str());
+
+  shcore::Value ret_val;
+  try {
+    ret_val = import_file(args, true);
+  }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("importJson"));
+
+  return ret_val;
+}
+
+REGISTER_HELP(SHELL_IMPORTCSV_BRIEF, "Loads a CSV file into a table.");
+REGISTER_HELP(SHELL_IMPORTCSV_PARAM, "@param file the path to the file to be loaded.");
+REGISTER_HELP(SHELL_IMPORTCSV_PARAM1, "@param options dictionary with the import options.");
+REGISTER_HELP(SHELL_IMPORTCSV_RETURN, "@return A dictionary with the number of records loaded and the seconds it took.");
+REGISTER_HELP(SHELL_IMPORTCSV_DETAIL, "The file is read in chunks which are inserted into the table in parallel, "\
+"each loader thread using its own session opened with the connection data of the global session, "\
+"which must be an X Protocol session. Fields may be enclosed in double quotes, an unquoted \\N is loaded as NULL.");
+REGISTER_HELP(SHELL_IMPORTCSV_DETAIL1, "The options dictionary may contain the following attributes:");
+REGISTER_HELP(SHELL_IMPORTCSV_DETAIL2, "@li table: the target table, mandatory.");
+REGISTER_HELP(SHELL_IMPORTCSV_DETAIL3, "@li schema: the schema of the table, defaults to the session schema.");
+REGISTER_HELP(SHELL_IMPORTCSV_DETAIL4, "@li fieldsTerminatedBy: the field separator, defaults to a comma.");
+REGISTER_HELP(SHELL_IMPORTCSV_DETAIL5, "@li header: boolean value, if true the first record holds the column names, defaults to true.");
+REGISTER_HELP(SHELL_IMPORTCSV_DETAIL6, "@li threads: the number of loader threads, defaults to 4.");
+REGISTER_HELP(SHELL_IMPORTCSV_DETAIL7, "@li batchSize: the number of records inserted per statement, defaults to 1000.");
+REGISTER_HELP(SHELL_IMPORTCSV_DETAIL8, "@li showProgress: boolean value, prints the load progress every second, defaults to true.");
+REGISTER_HELP(SHELL_IMPORTCSV_DETAIL9, "Chunks are inserted independently, if a chunk fails the ones already loaded remain in the table.");
+
+/**
+ * $(SHELL_IMPORTCSV_BRIEF)
+ *
+ * $(SHELL_IMPORTCSV_PARAM)
+ * $(SHELL_IMPORTCSV_PARAM1)
+ *
+ * $(SHELL_IMPORTCSV_RETURN)
+ *
+ * $(SHELL_IMPORTCSV_DETAIL)
+ *
+ * $(SHELL_IMPORTCSV_DETAIL1)
+ * $(SHELL_IMPORTCSV_DETAIL2)
+ * $(SHELL_IMPORTCSV_DETAIL3)
+ * $(SHELL_IMPORTCSV_DETAIL4)
+ * $(SHELL_IMPORTCSV_DETAIL5)
+ * $(SHELL_IMPORTCSV_DETAIL6)
+ * $(SHELL_IMPORTCSV_DETAIL7)
+ * $(SHELL_IMPORTCSV_DETAIL8)
+ *
+ * $(SHELL_IMPORTCSV_DETAIL9)
+ */
+#if DOXYGEN_JS
+Dictionary Shell::importCsv(String file, Dictionary options){}
+#elif DOXYGEN_PY
+dict Shell::import_csv(str file, dict options){}
+#endif
+shcore::Value Shell::import_csv(const shcore::Argument_list &args) {
+  args.ensure_count(2, get_function_name("importCsv").c_str());
+
+  shcore::Value ret_val;
+  try {
+    ret_val = import_file(args, false);
+  }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("importCsv"));
+
+  return ret_val;
+}
+
+shcore::Value Shell::import_file(const shcore::Argument_list &args, bool json) {
+  std::string path = args.string_at(0);
+  shcore::Argument_map options(*args.map_at(1));
+  std::string target_key = json ? "collection" : "table";
+
+  if (json)
+    options.ensure_keys({"collection"}, {"schema", "threads", "batchSize", "showProgress"}, "import options");
+  else
+    options.ensure_keys({"table"}, {"schema", "threads", "batchSize", "showProgress", "fieldsTerminatedBy", "header"}, "import options");
+
+  auto global_session = get_x_global_session("import data");
+
+  std::string schema = options.has_key("schema") ? options.string_at("schema") : global_session->get_default_schema();
+  if (schema.empty())
+    throw shcore::Exception::argument_error("No schema specified and the global session has no default schema");
+
+  int64_t threads = options.has_key("threads") ? options.int_at("threads") : 4;
+  int64_t batch_size = options.has_key("batchSize") ? options.int_at("batchSize") : 1000;
+  if (threads < 1)
+    throw shcore::Exception::argument_error("The threads option must be a positive integer");
+  if (batch_size < 1)
+    throw shcore::Exception::argument_error("The batchSize option must be a positive integer");
+
+  mysqlx::Importer importer(json ? mysqlx::Importer::Json : mysqlx::Importer::Csv, path, schema,
+                            options.string_at(target_key));
+  importer.set_batch_size(static_cast<size_t>(batch_size));
+
+  if (options.has_key("fieldsTerminatedBy")) {
+    std::string separator = options.string_at("fieldsTerminatedBy");
+    if (separator.size() != 1)
+      throw shcore::Exception::argument_error("The fieldsTerminatedBy option must be a single character");
+    importer.set_separator(separator[0]);
+  }
+
+  if (options.has_key("header"))
+    importer.set_header(options.bool_at("header"));
+
+  if (!options.has_key("showProgress") || options.bool_at("showProgress")) {
+    importer.set_progress([this](uint64_t records, double seconds) {
+      _shell_core->print((boost::format("%1% records loaded, %2% records/s\n") % records %
+                          static_cast<uint64_t>(seconds > 0 ? records / seconds : 0)).str());
+    });
+  }
+
+  auto sessions = open_sessions(threads);
+  shcore::Value::Map_type_ref result;
+  try {
+    result = importer.run(sessions);
+  } catch (...) {
+    close_sessions(sessions);
+    throw;
+  }
+
+  close_sessions(sessions);
+
+  return shcore::Value(result);
+}
+
+REGISTER_HELP(SHELL_DUMPSCHEMA_BRIEF, "Dumps the tables of a schema into a directory.");
+REGISTER_HELP(SHELL_DUMPSCHEMA_PARAM, "@param schema the name of the schema to be dumped.");
+REGISTER_HELP(SHELL_DUMPSCHEMA_PARAM1, "@param outputDir the directory where the dump is created.");
+REGISTER_HELP(SHELL_DUMPSCHEMA_PARAM2, "@param options optional dictionary with the dump options.");
+REGISTER_HELP(SHELL_DUMPSCHEMA_RETURN, "@return A dictionary with the number of tables, chunks and rows dumped and the seconds it took.");
+REGISTER_HELP(SHELL_DUMPSCHEMA_DETAIL, "For every table the directory gets a file with its DDL and one or more CSV files with its data, "\
+"a manifest named @.json lists them all. Tables with a single integer column primary key are split in ranges "\
+"of that key which are read in parallel, each dumper thread using its own session opened with the connection data "\
+"of the global session, which must be an X Protocol session.");
+REGISTER_HELP(SHELL_DUMPSCHEMA_DETAIL1, "The options dictionary may contain the following attributes:");
+REGISTER_HELP(SHELL_DUMPSCHEMA_DETAIL2, "@li threads: the number of dumper threads, defaults to 4.");
+REGISTER_HELP(SHELL_DUMPSCHEMA_DETAIL3, "@li chunkSize: the approximate number of rows per data file, defaults to 250000.");
+REGISTER_HELP(SHELL_DUMPSCHEMA_DETAIL4, "@li compression: \"gzip\" or \"none\", defaults to \"none\".");
+REGISTER_HELP(SHELL_DUMPSCHEMA_DETAIL5, "@li consistent: boolean value, if true all the threads read the same snapshot of the data, defaults to true.");
+REGISTER_HELP(SHELL_DUMPSCHEMA_DETAIL6, "@li showProgress: boolean value, prints the dump progress every second, defaults to true.");
+REGISTER_HELP(SHELL_DUMPSCHEMA_DETAIL7, "A consistent dump briefly runs FLUSH TABLES WITH READ LOCK while the threads start their transactions, "\
+"which requires the RELOAD privilege. Generated columns, views and routines are not dumped.");
+
+/**
+ * $(SHELL_DUMPSCHEMA_BRIEF)
+ *
+ * $(SHELL_DUMPSCHEMA_PARAM)
+ * $(SHELL_DUMPSCHEMA_PARAM1)
+ * $(SHELL_DUMPSCHEMA_PARAM2)
+ *
+ * $(SHELL_DUMPSCHEMA_RETURN)
+ *
+ * $(SHELL_DUMPSCHEMA_DETAIL)
+ *
+ * $(SHELL_DUMPSCHEMA_DETAIL1)
+ * $(SHELL_DUMPSCHEMA_DETAIL2)
+ * $(SHELL_DUMPSCHEMA_DETAIL3)
+ * $(SHELL_DUMPSCHEMA_DETAIL4)
+ * $(SHELL_DUMPSCHEMA_DETAIL5)
+ * $(SHELL_DUMPSCHEMA_DETAIL6)
+ *
+ * $(SHELL_DUMPSCHEMA_DETAIL7)
+ */
+#if DOXYGEN_JS
+Dictionary Shell::dumpSchema(String schema, String outputDir, Dictionary options){}
+#elif DOXYGEN_PY
+dict Shell::dump_schema(str schema, str outputDir, dict options){}
+#endif
+shcore::Value Shell::dump_schema(const shcore::Argument_list &args) {
+  args.ensure_count(2, 3, get_function_name("dumpSchema").c_str());
+
+  shcore::Value ret_val;
+  try {
+    shcore::Argument_map options;
+    if (args.size() == 3)
+      options = shcore::Argument_map(*args.map_at(2));
+    options.ensure_keys({}, {"threads", "chunkSize", "compression", "consistent", "showProgress"}, "dump options");
+
+    get_x_global_session("dump data");
+
+    int64_t threads = options.has_key("threads") ? options.int_at("threads") : 4;
+    int64_t chunk_size = options.has_key("chunkSize") ? options.int_at("chunkSize") : 250000;
+    if (threads < 1)
+      throw shcore::Exception::argument_error("The threads option must be a positive integer");
+    if (chunk_size < 1)
+      throw shcore::Exception::argument_error("The chunkSize option must be a positive integer");
+
+    mysqlx::Dumper dumper(args.string_at(0), args.string_at(1));
+    dumper.set_chunk_size(static_cast<uint64_t>(chunk_size));
+
+    if (options.has_key("compression")) {
+      std::string compression = options.string_at("compression");
+      if (compression == "gzip")
+        dumper.set_compression(mysqlx::Dumper::Gzip);
+      else if (compression != "none")
+        throw shcore::Exception::argument_error("The compression option must be either \"gzip\" or \"none\"");
+    }
+
+    if (options.has_key("consistent"))
+      dumper.set_consistent(options.bool_at("consistent"));
+
+    if (!options.has_key("showProgress") || options.bool_at("showProgress")) {
+      dumper.set_progress([this](uint64_t rows, double seconds) {
+        _shell_core->print((boost::format("%1% rows dumped, %2% rows/s\n") % rows %
+                            static_cast<uint64_t>(seconds > 0 ? rows / seconds : 0)).str());
+      });
+    }
+
+    auto sessions = open_sessions(threads);
+    shcore::Value::Map_type_ref result;
+    try {
+      result = dumper.run(sessions);
+    } catch (...) {
+      close_sessions(sessions);
+      throw;
+    }
+
+    close_sessions(sessions);
+
+    ret_val = shcore::Value(result);
+  }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("dumpSchema"));
+
+  return ret_val;
+}
+
+REGISTER_HELP(SHELL_LOADDUMP_BRIEF, "Loads a dump created with dumpSchema.");
+REGISTER_HELP(SHELL_LOADDUMP_PARAM, "@param inputDir the directory holding the dump.");
+REGISTER_HELP(SHELL_LOADDUMP_PARAM1, "@param options optional dictionary with the load options.");
+REGISTER_HELP(SHELL_LOADDUMP_RETURN, "@return A dictionary with the number of tables and rows loaded and the seconds it took.");
+REGISTER_HELP(SHELL_LOADDUMP_DETAIL, "The schema and its tables are created, then every data file is loaded in parallel, "\
+"each loader thread using its own session opened with the connection data of the global session, "\
+"which must be an X Protocol session. Foreign key and unique checks are disabled on the loader sessions.");
+REGISTER_HELP(SHELL_LOADDUMP_DETAIL1, "The options dictionary may contain the following attributes:");
+REGISTER_HELP(SHELL_LOADDUMP_DETAIL2, "@li schema: the schema to load the tables into, defaults to the dumped schema.");
+REGISTER_HELP(SHELL_LOADDUMP_DETAIL3, "@li threads: the number of loader threads, defaults to 4.");
+REGISTER_HELP(SHELL_LOADDUMP_DETAIL4, "@li batchSize: the number of rows inserted per statement, defaults to 1000.");
+REGISTER_HELP(SHELL_LOADDUMP_DETAIL5, "@li showProgress: boolean value, prints the load progress every second, defaults to true.");
+
+/**
+ * $(SHELL_LOADDUMP_BRIEF)
+ *
+ * $(SHELL_LOADDUMP_PARAM)
+ * $(SHELL_LOADDUMP_PARAM1)
+ *
+ * $(SHELL_LOADDUMP_RETURN)
+ *
+ * $(SHELL_LOADDUMP_DETAIL)
+ *
+ * $(SHELL_LOADDUMP_DETAIL1)
+ * $(SHELL_LOADDUMP_DETAIL2)
+ * $(SHELL_LOADDUMP_DETAIL3)
+ * $(SHELL_LOADDUMP_DETAIL4)
+ * $(SHELL_LOADDUMP_DETAIL5)
+ */
+#if DOXYGEN_JS
+Dictionary Shell::loadDump(String inputDir, Dictionary options){}
+#elif DOXYGEN_PY
+dict Shell::load_dump(str inputDir, dict options){}
+#endif
+shcore::Value Shell::load_dump(const shcore::Argument_list &args) {
+  args.ensure_count(1, 2, get_function_name("loadDump").c_str());
+
+  shcore::Value ret_val;
+  try {
+    shcore::Argument_map options;
+    if (args.size() == 2)
+      options = shcore::Argument_map(*args.map_at(1));
+    options.ensure_keys({}, {"schema", "threads", "batchSize", "showProgress"}, "load options");
+
+    get_x_global_session("load data");
+
+    int64_t threads = options.has_key("threads") ? options.int_at("threads") : 4;
+    int64_t batch_size = options.has_key("batchSize") ? options.int_at("batchSize") : 1000;
+    if (threads < 1)
+      throw shcore::Exception::argument_error("The threads option must be a positive integer");
+    if (batch_size < 1)
+      throw shcore::Exception::argument_error("The batchSize option must be a positive integer");
+
+    mysqlx::Dump_loader loader(args.string_at(0));
+    loader.set_batch_size(static_cast<size_t>(batch_size));
+
+    if (options.has_key("schema"))
+      loader.set_schema(options.string_at("schema"));
+
+    if (!options.has_key("showProgress") || options.bool_at("showProgress")) {
+      loader.set_progress([this](uint64_t rows, double seconds) {
+        _shell_core->print((boost::format("%1% rows loaded, %2% rows/s\n") % rows %
+                            static_cast<uint64_t>(seconds > 0 ? rows / seconds : 0)).str());
+      });
+    }
+
+    auto sessions = open_sessions(threads);
+    shcore::Value::Map_type_ref result;
+    try {
+      result = loader.run(sessions);
+    } catch (...) {
+      close_sessions(sessions);
+      throw;
+    }
+
+    close_sessions(sessions);
+
+    ret_val = shcore::Value(result);
+  }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("loadDump"));
+
+  return ret_val;
+}
+
+std::shared_ptr<ShellDevelopmentSession> Shell::get_x_global_session(const std::string &action) {
+  auto global_session = _shell_core->get_dev_session();
+  if (!std::dynamic_pointer_cast<mysqlx::BaseSession>(global_session))
+    throw shcore::Exception::runtime_error("An X Protocol global session is required to " + action);
+
+  return global_session;
+}
+
+// Opens count sessions with the connection data of the global session, which
+// the caller must have verified
+std::vector<std::shared_ptr<mysqlx::BaseSession> > Shell::open_sessions(int64_t count) {
+  auto global_session = _shell_core->get_dev_session();
+
+  std::vector<std::shared_ptr<mysqlx::BaseSession> > sessions;
+  try {
+    for (int64_t index = 0; index < count; index++) {
+      auto session = connect_session(global_session->uri(), global_session->get_password(), SessionType::Node);
+      sessions.push_back(std::dynamic_pointer_cast<mysqlx::BaseSession>(session));
+    }
+  } catch (...) {
+    close_sessions(sessions);
+    throw;
+  }
+
+  return sessions;
+}
+
+void Shell::close_sessions(const std::vector<std::shared_ptr<mysqlx::BaseSession> > &sessions) {
+  for (auto session : sessions)
+    session->close(shcore::Argument_list());
+}
+}
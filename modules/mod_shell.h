@@ -19,12 +19,17 @@
 
 #include "shellcore/types_cpp.h"
 #include "shellcore/ishell_core.h"
+#include <vector>
 
 
 #ifndef _MODULES_MOD_SHELL_H_
 #define _MODULES_MOD_SHELL_H_
 
 namespace mysqlsh {
+namespace mysqlx {
+class BaseSession;
+}
+
 /**
   * $(SHELL_BRIEF)
   */
@@ -42,6 +47,10 @@ namespace mysqlsh {
     shcore::Value parse_uri(const shcore::Argument_list &args);
     shcore::Value prompt(const shcore::Argument_list &args);
     shcore::Value connect(const shcore::Argument_list &args);
+    shcore::Value import_json(const shcore::Argument_list &args);
+    shcore::Value import_csv(const shcore::Argument_list &args);
+    shcore::Value dump_schema(const shcore::Argument_list &args);
+    shcore::Value load_dump(const shcore::Argument_list &args);
 
     #if DOXYGEN_JS
     Dictionary options;
@@ -49,16 +58,28 @@ namespace mysqlsh {
     Dictionary parseUri(String uri);
     String prompt(String message, Dictionary options);
     Undefined connect(ConnectionData connectionData, String password);
+    Dictionary importJson(String file, Dictionary options);
+    Dictionary importCsv(String file, Dictionary options);
+    Dictionary dumpSchema(String schema, String outputDir, Dictionary options);
+    Dictionary loadDump(String inputDir, Dictionary options);
     #elif DOXYGEN_PY
     dict options;
     Callback custom_prompt;
     dict parse_uri(str uri);
     str prompt(str message, dict options);
     None connect(ConnectionData connectionData, str password);
+    dict import_json(str file, dict options);
+    dict import_csv(str file, dict options);
+    dict dump_schema(str schema, str outputDir, dict options);
+    dict load_dump(str inputDir, dict options);
     #endif
 
   protected:
     void init();
+    shcore::Value import_file(const shcore::Argument_list &args, bool json);
+    std::shared_ptr<ShellDevelopmentSession> get_x_global_session(const std::string &action);
+    std::vector<std::shared_ptr<mysqlx::BaseSession> > open_sessions(int64_t count);
+    void close_sessions(const std::vector<std::shared_ptr<mysqlx::BaseSession> > &sessions);
 
     shcore::Value _custom_prompt[2];
 
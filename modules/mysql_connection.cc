@@ -25,7 +25,8 @@
 #include "shellcore/obj_date.h"
 
 #include <boost/format.hpp>
-#include <boost/lexical_cast.hpp>
+#include <limits>
+#include <sstream>
 
 using namespace mysqlsh::mysql;
 
@@ -38,6 +39,7 @@ using namespace mysqlsh::mysql;
 
 Result::Result(std::shared_ptr<Connection> owner, my_ulonglong affected_rows_, unsigned int warning_count_, uint64_t last_insert_id, const char *info_)
   : _connection(owner), _affected_rows(affected_rows_), _last_insert_id(last_insert_id), _warning_count(warning_count_), _fetched_row_count(0), _execution_time(0), _has_resultset(false) {
+  _decoders.reset(new std::vector<Row::Decoder>());
   if (info_)
     _info.assign(info_);
 }
@@ -47,6 +49,9 @@ int Result::fetch_metadata() {
 
   _metadata.clear();
 
+  // Rows still alive keep the decoders of their result set
+  _decoders.reset(new std::vector<Row::Decoder>());
+
   // res could be NULL on queries not returning data
   std::shared_ptr<MYSQL_RES> res = _result.lock();
 
@@ -66,6 +71,8 @@ int Result::fetch_metadata() {
         fields[index].flags,
         fields[index].decimals,
         fields[index].charsetnr));
+
+      _decoders->push_back(Row::get_decoder(fields[index].type, fields[index].flags));
     }
   }
 
@@ -87,7 +94,7 @@ std::unique_ptr<Row> Result::fetch_one() {
         unsigned long *lengths;
         lengths = mysql_fetch_lengths(res.get());
 
-        ret_val = std::unique_ptr<Row>(new Row(mysql_row, lengths, &_metadata));
+        ret_val = std::unique_ptr<Row>(new Row(mysql_row, lengths, _decoders));
 
         // Each read row increases the count
         _fetched_row_count++;
@@ -130,67 +137,132 @@ _charset(charset_),
 _max_length(0),
 _name_length(name_.length()) {}
 
-Row::Row(MYSQL_ROW row, unsigned long *lengths, std::vector<Field>* metadata) :
-_row(row), _lengths(lengths), _metadata(metadata) {}
+Row::Row(MYSQL_ROW row, unsigned long *lengths, std::shared_ptr<const std::vector<Decoder> > decoders) :
+_row(row), _lengths(lengths), _decoders(decoders) {}
 
-shcore::Value Row::get_value(int index) {
-  if (_row[index] == NULL)
-    return shcore::Value::Null();
-  else {
-    switch ((*_metadata)[index].type()) {
-      case MYSQL_TYPE_NULL:
-        return shcore::Value::Null();
-      case MYSQL_TYPE_DECIMAL:
-      case MYSQL_TYPE_DATE:
-      case MYSQL_TYPE_NEWDATE:
-      case MYSQL_TYPE_TIME:
+Row::Row(const Row &other) : _decoders(other._decoders) {
+  size_t count = field_count();
+  size_t total = 0;
+  for (size_t index = 0; index < count; index++) {
+    if (other._row[index])
+      total += other._lengths[index];
+  }
+
+  // All the fields go on a single buffer
+  _buffer.reserve(total);
+  _field_lengths.assign(other._lengths, other._lengths + count);
+  std::vector<size_t> offsets(count);
+  for (size_t index = 0; index < count; index++) {
+    offsets[index] = _buffer.size();
+    if (other._row[index])
+      _buffer.append(other._row[index], other._lengths[index]);
+  }
+
+  _fields.resize(count);
+  for (size_t index = 0; index < count; index++)
+    _fields[index] = other._row[index] ? &_buffer[0] + offsets[index] : NULL;
+
+  _row = _fields.data();
+  _lengths = _field_lengths.data();
+}
+
+Row::Decoder Row::get_decoder(int type, int flags) {
+  switch (type) {
+    case MYSQL_TYPE_NULL:
+      return Null_decoder;
+    case MYSQL_TYPE_DECIMAL:
+    case MYSQL_TYPE_DATE:
+    case MYSQL_TYPE_NEWDATE:
+    case MYSQL_TYPE_TIME:
 #if MYSQL_MAJOR_VERSION > 5 || (MYSQL_MAJOR_VERSION == 5 && MYSQL_MINOR_VERSION >= 7)
-      case MYSQL_TYPE_TIME2:
+    case MYSQL_TYPE_TIME2:
 #endif
-      case MYSQL_TYPE_STRING:
-      case MYSQL_TYPE_VARCHAR:
-      case MYSQL_TYPE_VAR_STRING:
-      case MYSQL_TYPE_NEWDECIMAL:
-      case MYSQL_TYPE_TINY_BLOB:
-      case MYSQL_TYPE_MEDIUM_BLOB:
-      case MYSQL_TYPE_LONG_BLOB:
-      case MYSQL_TYPE_BLOB:
-      case MYSQL_TYPE_GEOMETRY:
-      case MYSQL_TYPE_JSON:
-
-        return shcore::Value(std::string(_row[index], _lengths[index]));
-
-      case MYSQL_TYPE_YEAR:
-      case MYSQL_TYPE_TINY:
-      case MYSQL_TYPE_SHORT:
-      case MYSQL_TYPE_INT24:
-      case MYSQL_TYPE_LONG:
-      case MYSQL_TYPE_LONGLONG:
-        return shcore::Value(boost::lexical_cast<int64_t>(_row[index]));
-
-      case MYSQL_TYPE_FLOAT:
-      case MYSQL_TYPE_DOUBLE:
-        return shcore::Value(boost::lexical_cast<double>(_row[index]));
-        break;
-
-      case MYSQL_TYPE_DATETIME:
-      case MYSQL_TYPE_TIMESTAMP:
+    case MYSQL_TYPE_STRING:
+    case MYSQL_TYPE_VARCHAR:
+    case MYSQL_TYPE_VAR_STRING:
+    case MYSQL_TYPE_NEWDECIMAL:
+    case MYSQL_TYPE_TINY_BLOB:
+    case MYSQL_TYPE_MEDIUM_BLOB:
+    case MYSQL_TYPE_LONG_BLOB:
+    case MYSQL_TYPE_BLOB:
+    case MYSQL_TYPE_GEOMETRY:
+    case MYSQL_TYPE_JSON:
+      return String_decoder;
+
+    case MYSQL_TYPE_YEAR:
+    case MYSQL_TYPE_TINY:
+    case MYSQL_TYPE_SHORT:
+    case MYSQL_TYPE_INT24:
+    case MYSQL_TYPE_LONG:
+    case MYSQL_TYPE_LONGLONG:
+      return (flags & UNSIGNED_FLAG) ? Unsigned_decoder : Integer_decoder;
+
+    case MYSQL_TYPE_FLOAT:
+    case MYSQL_TYPE_DOUBLE:
+      return Double_decoder;
+
+    case MYSQL_TYPE_DATETIME:
+    case MYSQL_TYPE_TIMESTAMP:
 #if MYSQL_MAJOR_VERSION > 5 || (MYSQL_MAJOR_VERSION == 5 && MYSQL_MINOR_VERSION >= 7)
-      case MYSQL_TYPE_DATETIME2:
-      case MYSQL_TYPE_TIMESTAMP2:
+    case MYSQL_TYPE_DATETIME2:
+    case MYSQL_TYPE_TIMESTAMP2:
 #endif
-        return shcore::Value(shcore::Date::unrepr(_row[index]));
-        break;
-
-      case MYSQL_TYPE_BIT:
-      case MYSQL_TYPE_ENUM:
-      case MYSQL_TYPE_SET:
-        // TODO: Read these types properly
-        break;
+      return Date_decoder;
+
+    default:
+      // TODO: Read BIT, ENUM and SET properly
+      return Unsupported_decoder;
+  }
+}
+
+shcore::Value Row::get_value(int index) {
+  const char *data = _row[index];
+  if (data == NULL)
+    return shcore::Value::Null();
+
+  size_t length = _lengths[index];
+  switch ((*_decoders)[index]) {
+    case Null_decoder:
+      return shcore::Value::Null();
+
+    case String_decoder:
+      return shcore::Value(data, length);
+
+    case Integer_decoder: {
+      int64_t value;
+      if (shcore::parse_int64(data, length, &value))
+        return shcore::Value(value);
+      break;
     }
+
+    case Unsigned_decoder: {
+      // Kept as signed integers when they fit, like they have always been
+      uint64_t value;
+      if (shcore::parse_uint64(data, length, &value)) {
+        if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+          return shcore::Value(static_cast<int64_t>(value));
+        return shcore::Value(value);
+      }
+      break;
+    }
+
+    case Double_decoder: {
+      double value;
+      if (shcore::parse_double(data, length, &value))
+        return shcore::Value(value);
+      break;
+    }
+
+    case Date_decoder:
+      return shcore::Value(shcore::Date::unrepr(data, length));
+
+    case Unsupported_decoder:
+      return shcore::Value();
   }
 
-  return shcore::Value();
+  // The server sent something that is not a number, the text is better than
+  // failing the whole fetch
+  return shcore::Value(data, length);
 }
 
 std::string Row::get_value_as_string(int index) {
@@ -85,16 +85,43 @@ private:
 
 class Row {
 public:
-  Row(MYSQL_ROW row, unsigned long *lengths, std::vector<Field>* metadata = NULL);
+  // How the text of a field is turned into a Value, chosen from the field
+  // type once per result set rather than on every row
+  enum Decoder {
+    Null_decoder,
+    String_decoder,
+    Integer_decoder,
+    Unsigned_decoder,
+    Double_decoder,
+    Date_decoder,
+    Unsupported_decoder
+  };
+
+  Row(MYSQL_ROW row, unsigned long *lengths, std::shared_ptr<const std::vector<Decoder> > decoders);
+
+  // The copy owns the field data, so it remains valid once the next row is
+  // fetched from the result
+  Row(const Row &other);
+  // The field pointers would still point into the source row buffer
+  Row &operator=(const Row &other) = delete;
   virtual ~Row() {}
 
   virtual shcore::Value get_value(int index);
   virtual std::string get_value_as_string(int index);
 
+  size_t field_count() const { return _decoders->size(); }
+
+  static Decoder get_decoder(int type, int flags);
+
 private:
   MYSQL_ROW _row;
   unsigned long *_lengths;
-  std::vector<Field> *_metadata;
+  std::shared_ptr<const std::vector<Decoder> > _decoders;
+
+  // Only used by copies
+  std::string _buffer;
+  std::vector<char*> _fields;
+  std::vector<unsigned long> _field_lengths;
 };
 
 class Connection;
@@ -130,6 +157,7 @@ public:
 private:
   std::shared_ptr<Connection> _connection;
   std::vector<Field>_metadata;
+  std::shared_ptr<std::vector<Row::Decoder> > _decoders;
 
   std::weak_ptr<MYSQL_RES> _result;
   uint64_t _affected_rows;
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+#include "expr_cache.h"
+
+#include <algorithm>
+
+using namespace mysqlx;
+
+Expr_cache::Expr_cache(size_t max_entries, size_t max_bytes)
+: _max_entries(max_entries), _max_bytes(max_bytes), _bytes(0), _hits(0), _misses(0)
+{
+}
+
+Expr_cache &Expr_cache::instance()
+{
+  static Expr_cache cache;
+  return cache;
+}
+
+Mysqlx::Expr::Expr *Expr_cache::expr(const std::string &expr_str, bool document_mode, bool allow_alias,
+                                     std::vector<std::string> *place_holders)
+{
+  std::string key;
+  key.reserve(expr_str.size() + 2);
+  key.push_back(document_mode ? 'D' : 'T');
+  key.push_back(allow_alias ? 'A' : '-');
+  key.append(expr_str);
+
+  std::unique_ptr<Mysqlx::Expr::Expr> ret_val(new Mysqlx::Expr::Expr());
+  std::vector<std::string> entry_place_holders;
+  bool found = false;
+  bool positional = false;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::unordered_map<std::string, Entry_list::iterator>::iterator index = _index.find(key);
+    if (index != _index.end())
+    {
+      _hits++;
+      found = true;
+      _entries.splice(_entries.begin(), _entries, index->second);
+      if (index->second->expr)
+      {
+        ret_val->CopyFrom(*index->second->expr);
+        entry_place_holders = index->second->place_holders;
+      }
+      else
+        positional = true;
+    }
+  }
+
+  if (!found)
+  {
+    // Parsed with its own placeholder list so the entry does not depend on
+    // the statement it was first used on. Errors are not cached
+    Expr_parser parser(expr_str, document_mode, allow_alias, &entry_place_holders);
+    ret_val.reset(parser.expr());
+
+    // The positional placeholders, a colon without a name, are named after
+    // the number of placeholders the statement had before them, so they can't
+    // be moved to another list by name. Only the key is kept for them, to
+    // parse them against the statement list every time
+    for (std::vector<std::string>::const_iterator name = entry_place_holders.begin(); name != entry_place_holders.end() && !positional; ++name)
+      positional = name->find_first_not_of("0123456789") == std::string::npos;
+
+    Entry entry;
+    entry.key = key;
+    entry.bytes = key.size();
+    if (!positional)
+    {
+      entry.expr.reset(new Mysqlx::Expr::Expr(*ret_val));
+      entry.place_holders = entry_place_holders;
+      entry.bytes += ret_val->ByteSize();
+      for (std::vector<std::string>::const_iterator name = entry_place_holders.begin(); name != entry_place_holders.end(); ++name)
+        entry.bytes += name->size();
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _misses++;
+
+    // Another thread may have added it meanwhile
+    if (_index.find(key) == _index.end() && entry.bytes <= _max_bytes && _max_entries > 0)
+    {
+      _bytes += entry.bytes;
+      _entries.push_front(Entry());
+      _entries.front().key = entry.key;
+      _entries.front().expr.swap(entry.expr);
+      _entries.front().place_holders.swap(entry.place_holders);
+      _entries.front().bytes = entry.bytes;
+      _index[key] = _entries.begin();
+
+      evict();
+    }
+  }
+
+  if (positional)
+  {
+    Expr_parser parser(expr_str, document_mode, allow_alias, place_holders);
+    return parser.expr();
+  }
+
+  // The positions of the entry refer to its own placeholder list, they are
+  // moved to the ones on the statement list, adding the missing names
+  if (place_holders && !entry_place_holders.empty())
+  {
+    std::vector<int> positions;
+    bool changed = false;
+    for (std::vector<std::string>::const_iterator name = entry_place_holders.begin(); name != entry_place_holders.end(); ++name)
+    {
+      std::vector<std::string>::const_iterator existing = std::find(place_holders->begin(), place_holders->end(), *name);
+      int position = static_cast<int>(existing - place_holders->begin());
+      if (existing == place_holders->end())
+        place_holders->push_back(*name);
+
+      changed = changed || position != static_cast<int>(positions.size());
+      positions.push_back(position);
+    }
+
+    if (changed)
+      set_positions(ret_val.get(), positions);
+  }
+
+  return ret_val.release();
+}
+
+void Expr_cache::set_limits(size_t max_entries, size_t max_bytes)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _max_entries = max_entries;
+  _max_bytes = max_bytes;
+  evict();
+}
+
+void Expr_cache::clear()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.clear();
+  _index.clear();
+  _bytes = 0;
+  _hits = 0;
+  _misses = 0;
+}
+
+Expr_cache::Stats Expr_cache::stats() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  Stats ret_val = {_hits, _misses, _index.size(), _bytes};
+  return ret_val;
+}
+
+// Drops the least recently used entries until the limits are met, the caller
+// holds the lock
+void Expr_cache::evict()
+{
+  while (!_entries.empty() && (_entries.size() > _max_entries || _bytes > _max_bytes))
+  {
+    _bytes -= _entries.back().bytes;
+    _index.erase(_entries.back().key);
+    _entries.pop_back();
+  }
+}
+
+void Expr_cache::set_positions(Mysqlx::Expr::Expr *expr, const std::vector<int> &positions)
+{
+  switch (expr->type())
+  {
+    case Mysqlx::Expr::Expr::PLACEHOLDER:
+      expr->set_position(positions[expr->position()]);
+      break;
+    case Mysqlx::Expr::Expr::FUNC_CALL:
+      for (int index = 0; index < expr->function_call().param_size(); index++)
+        set_positions(expr->mutable_function_call()->mutable_param(index), positions);
+      break;
+    case Mysqlx::Expr::Expr::OPERATOR:
+      for (int index = 0; index < expr->operator_().param_size(); index++)
+        set_positions(expr->mutable_operator_()->mutable_param(index), positions);
+      break;
+    case Mysqlx::Expr::Expr::OBJECT:
+      for (int index = 0; index < expr->object().fld_size(); index++)
+        set_positions(expr->mutable_object()->mutable_fld(index)->mutable_value(), positions);
+      break;
+    case Mysqlx::Expr::Expr::ARRAY:
+      for (int index = 0; index < expr->array().value_size(); index++)
+        set_positions(expr->mutable_array()->mutable_value(index), positions);
+      break;
+    default:
+      break;
+  }
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301  USA
+ */
+
+#ifndef _EXPR_CACHE_H_
+#define _EXPR_CACHE_H_
+
+#include "expr_parser.h"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mysqlx
+{
+  /**
+   * LRU cache of parsed expressions.
+   *
+   * Scripts tend to build the same statements over and over, so instead of
+   * tokenizing and parsing the same condition every time the parsed tree is
+   * kept and a copy of it is handed out. The cache is bounded both by number
+   * of entries and by the approximate bytes used by them, the least recently
+   * used entries are dropped first. Expressions with positional placeholders
+   * depend on the statement they are used on, so they are parsed every time.
+   */
+  class Expr_cache
+  {
+  public:
+    struct Stats
+    {
+      uint64_t hits;
+      uint64_t misses;
+      size_t entries;
+      size_t bytes;
+    };
+
+    Expr_cache(size_t max_entries = 1024, size_t max_bytes = 1024 * 1024);
+
+    // The cache used by the CRUD statements
+    static Expr_cache &instance();
+
+    // Returns a copy of the parsed expression, the caller takes its ownership.
+    // As with Expr_parser, new placeholders are added to place_holders and the
+    // placeholder positions of the expression refer to that list
+    Mysqlx::Expr::Expr *expr(const std::string &expr_str, bool document_mode = false, bool allow_alias = false,
+                             std::vector<std::string> *place_holders = NULL);
+
+    void set_limits(size_t max_entries, size_t max_bytes);
+    void clear();
+    Stats stats() const;
+
+  private:
+    struct Entry
+    {
+      std::string key;
+      std::unique_ptr<Mysqlx::Expr::Expr> expr;
+      std::vector<std::string> place_holders;
+      size_t bytes;
+    };
+
+    typedef std::list<Entry> Entry_list;
+
+    size_t _max_entries;
+    size_t _max_bytes;
+    size_t _bytes;
+    uint64_t _hits;
+    uint64_t _misses;
+
+    // Most recently used first
+    Entry_list _entries;
+    std::unordered_map<std::string, Entry_list::iterator> _index;
+    mutable std::mutex _mutex;
+
+    void evict();
+    static void set_positions(Mysqlx::Expr::Expr *expr, const std::vector<int> &positions);
+  };
+};
+
+#endif
@@ -21,6 +21,7 @@
 #define _MYSQLX_PARSER_H_
 
 #include "expr_parser.h"
+#include "expr_cache.h"
 #include "proj_parser.h"
 #include "orderby_parser.h"
 
@@ -32,8 +33,7 @@ namespace mysqlx
   {
     inline Mysqlx::Expr::Expr* parse_collection_filter(const std::string &source, std::vector<std::string>* placeholders = NULL)
     {
-      Expr_parser parser(source, true, false, placeholders);
-      return parser.expr();
+      return Expr_cache::instance().expr(source, true, false, placeholders);
     }
 
     inline void parse_document_path(const std::string& source, Mysqlx::Expr::ColumnIdentifier& colid)
@@ -50,8 +50,7 @@ namespace mysqlx
 
     inline Mysqlx::Expr::Expr* parse_table_filter(const std::string &source, std::vector<std::string>* placeholders = NULL)
     {
-      Expr_parser parser(source, false, false, placeholders);
-      return parser.expr();
+      return Expr_cache::instance().expr(source, false, false, placeholders);
     }
 
     template<typename Container>
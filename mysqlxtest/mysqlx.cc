@@ -38,8 +38,6 @@
 #include "my_config.h"
 #include "mysql.h"
 
-#include <boost/bind.hpp>
-
 #ifdef MYSQLXTEST_STANDALONE
 #include "mysqlx/auth_mysql41.h"
 #else
@@ -81,8 +79,10 @@ namespace mysqlx {
 #include <sys/socket.h>
 #endif
 #include <string>
+#include <cstring>
 #include <iostream>
 #include <limits>
+#include <algorithm>
 #include "compilerutils.h"
 #include "ngs_common/xdecimal.h"
 
@@ -94,6 +94,13 @@ namespace mysqlx {
 
 using namespace mysqlx;
 
+// Initial size of the connection read-ahead buffer, it grows as needed to
+// hold frames bigger than this
+static const std::size_t READ_BUFFER_SIZE = 64 * 1024;
+
+// Expectation condition failing the rest of the block after an error
+static const uint32_t EXPECT_NO_ERROR = 1;
+
 bool mysqlx::parse_mysql_connstring(const std::string &connstring,
                                     std::string &protocol, std::string &user, std::string &password,
                                     std::string &host, int &port, std::string &sock,
@@ -221,7 +228,8 @@ Connection::Connection(const Ssl_config &ssl_config, const std::size_t timeout,
     m_account_expired(false),
     m_deadline(m_ios), m_client_id(0),
     m_trace_packets(false), m_closed(true),
-    m_dont_wait_for_disconnect(dont_wait_for_disconnect)
+    m_dont_wait_for_disconnect(dont_wait_for_disconnect),
+    m_expect_block_open(false), m_read_buffer(READ_BUFFER_SIZE), m_read_begin(0), m_read_end(0)
 {
   if (getenv("MYSQLX_TRACE_CONNECTION"))
     m_trace_packets = true;
@@ -290,6 +298,8 @@ void Connection::connect(const std::string &host, int port, const bool cap_expir
 
   error = boost::asio::error::fault;
 
+  reset_read_buffer();
+
   while (error && endpoint_iterator != end)
   {
     m_sync_connection.close();
@@ -343,6 +353,8 @@ void Connection::authenticate(const std::string &user, const std::string &pass,
 
 void Connection::fetch_capabilities()
 {
+  read_pending_results();
+
   send(Mysqlx::Connection::CapabilitiesGet());
   int mid;
   boost::scoped_ptr<Message> message(recv_raw(mid));
@@ -377,6 +389,8 @@ void Connection::close()
 {
   if (!m_closed)
   {
+    read_pending_results();
+
     if (m_last_result)
       m_last_result->buffer();
 
@@ -424,6 +438,8 @@ std::shared_ptr<Result> Connection::recv_result()
 
 std::shared_ptr<Result> Connection::execute_sql(const std::string &sql)
 {
+  read_pending_results();
+
   {
     Mysqlx::Sql::StmtExecute exec;
     exec.set_namespace_("sql");
@@ -436,6 +452,8 @@ std::shared_ptr<Result> Connection::execute_sql(const std::string &sql)
 
 std::shared_ptr<Result> Connection::execute_stmt(const std::string &ns, const std::string &sql, const std::vector<ArgumentValue> &args)
 {
+  read_pending_results();
+
   {
     Mysqlx::Sql::StmtExecute exec;
     exec.set_namespace_(ns);
@@ -490,6 +508,8 @@ std::shared_ptr<Result> Connection::execute_stmt(const std::string &ns, const st
 
 std::shared_ptr<Result> Connection::execute_find(const Mysqlx::Crud::Find &m)
 {
+  read_pending_results();
+
   send(m);
 
   return new_result(true);
@@ -497,6 +517,8 @@ std::shared_ptr<Result> Connection::execute_find(const Mysqlx::Crud::Find &m)
 
 std::shared_ptr<Result> Connection::execute_update(const Mysqlx::Crud::Update &m)
 {
+  read_pending_results();
+
   send(m);
 
   return new_result(false);
@@ -504,6 +526,8 @@ std::shared_ptr<Result> Connection::execute_update(const Mysqlx::Crud::Update &m
 
 std::shared_ptr<Result> Connection::execute_insert(const Mysqlx::Crud::Insert &m)
 {
+  read_pending_results();
+
   send(m);
 
   return new_result(false);
@@ -511,11 +535,106 @@ std::shared_ptr<Result> Connection::execute_insert(const Mysqlx::Crud::Insert &m
 
 std::shared_ptr<Result> Connection::execute_delete(const Mysqlx::Crud::Delete &m)
 {
+  read_pending_results();
+
   send(m);
 
   return new_result(false);
 }
 
+std::shared_ptr<Result> Connection::execute_encoded(int mid, const std::string &payload)
+{
+  read_pending_results();
+
+  send(mid, payload);
+
+  return new_result(mid == Mysqlx::ClientMessages::CRUD_FIND);
+}
+
+std::shared_ptr<Result> Connection::send_sql(const std::string &sql, bool stop_on_error)
+{
+  // The result of the last statement not sent on the pipeline is read first
+  if (m_last_result)
+  {
+    m_last_result->buffer();
+    m_last_result.reset();
+  }
+
+  // Forgets the results already read
+  while (!m_pending_results.empty() &&
+         (m_pending_results.front()->m_state == Result::ReadDone ||
+          m_pending_results.front()->m_state == Result::ReadError))
+    m_pending_results.pop_front();
+
+  if (stop_on_error && !m_expect_block_open)
+  {
+    Mysqlx::Expect::Open open;
+    open.add_cond()->set_condition_key(EXPECT_NO_ERROR);
+    send(open);
+
+    // The block is open once the server replies with Ok
+    m_pending_results.push_back(std::shared_ptr<Result>(new Result(shared_from_this(), false)));
+    m_expect_block_open = true;
+  }
+
+  {
+    Mysqlx::Sql::StmtExecute exec;
+    exec.set_namespace_("sql");
+    exec.set_stmt(sql);
+    send(exec);
+  }
+
+  std::shared_ptr<Result> result(new Result(shared_from_this(), true));
+  m_pending_results.push_back(result);
+
+  return result;
+}
+
+void Connection::read_pending_results()
+{
+  read_pending_results(NULL);
+
+  if (m_expect_block_open)
+  {
+    m_expect_block_open = false;
+    send(Mysqlx::Expect::Close());
+
+    // A failed block is reported through the failing statement
+    Result close_result(shared_from_this(), false);
+    try
+    {
+      close_result.wait();
+    }
+    catch (Error &)
+    {
+    }
+  }
+}
+
+void Connection::read_pending_results(Result *until)
+{
+  // Results are buffered so their owners find them complete, an error is kept
+  // on the result until the owner reads it
+  while (!m_pending_results.empty() && m_pending_results.front().get() != until)
+  {
+    // The result stays first while it is read, so reading it does not read
+    // the results sent after it
+    std::shared_ptr<Result> result(m_pending_results.front());
+    if (result->m_state != Result::ReadDone && result->m_state != Result::ReadError)
+    {
+      try
+      {
+        result->buffer();
+      }
+      catch (Error &e)
+      {
+        result->m_pending_error.reset(new Error(e));
+      }
+    }
+    m_pending_results.pop_front();
+  }
+}
+
 void Connection::setup_capability(const std::string &name, const bool value, int& out_error, std::string &out_error_msg, bool should_throw /*= false*/)
 {
   Mysqlx::Connection::CapabilitiesSet capSet;
@@ -526,6 +645,8 @@ void Connection::setup_capability(const std::string &name, const bool value, int
   cap->mutable_value()->set_type(Mysqlx::Datatypes::Any_Type_SCALAR);
   scalar->set_type(Mysqlx::Datatypes::Scalar_Type_V_BOOL);
   scalar->set_v_bool(value);
+  read_pending_results();
+
   send(capSet);
 
   if (m_last_result)
@@ -733,6 +854,29 @@ void Connection::send(int mid, const Message &msg)
   throw_mysqlx_error(error);
 }
 
+void Connection::send(int mid, const std::string &payload)
+{
+  // Header and payload go on a single write
+  std::string packet;
+  packet.reserve(5 + payload.size());
+
+  uint8_t buf[5];
+  *(uint32_t*)buf = static_cast<uint32_t>(payload.size() + 1);
+#ifdef WORDS_BIGENDIAN
+  std::swap(buf[0], buf[3]);
+  std::swap(buf[1], buf[2]);
+#endif
+  buf[4] = mid;
+
+  packet.append(reinterpret_cast<const char*>(buf), 5);
+  packet.append(payload);
+
+  if (m_trace_packets)
+    std::cout << ">>>> SEND " << payload.size() + 1 << " " << Mysqlx::ClientMessages::Type_Name(static_cast<Mysqlx::ClientMessages::Type>(mid)) << " (encoded)\n";
+
+  send_bytes(packet);
+}
+
 void Connection::push_local_notice_handler(Local_notice_handler handler)
 {
   m_local_notice_handlers.push_back(handler);
@@ -743,7 +887,9 @@ void Connection::pop_local_notice_handler()
   m_local_notice_handlers.pop_back();
 }
 
-void Connection::dispatch_notice(Mysqlx::Notice::Frame *frame)
+// Local notices go to the registered handlers first, then to the result
+// being read (if any) and finally to the connection itself
+void Connection::dispatch_notice(Mysqlx::Notice::Frame *frame, Result *notice_target)
 {
   if (frame->scope() == Mysqlx::Notice::Frame::LOCAL)
   {
@@ -752,6 +898,9 @@ void Connection::dispatch_notice(Mysqlx::Notice::Frame *frame)
       if ((*iter)(frame->type(), frame->payload())) // handler returns true if the notice was handled
         return;
 
+    if (notice_target && notice_target->handle_notice(frame->type(), frame->payload()))
+      return;
+
     {
       if (frame->type() == 3)
       {
@@ -786,156 +935,205 @@ void Connection::dispatch_notice(Mysqlx::Notice::Frame *frame)
   }
 }
 
-Message *Connection::recv_next(int &mid)
+Message *Connection::recv_next(int &mid, Mysqlx::Resultset::Row *row_buffer)
+{
+  return recv_next(mid, row_buffer, NULL);
+}
+
+Message *Connection::recv_next(int &mid, Mysqlx::Resultset::Row *row_buffer, Result *notice_target)
 {
   for (;;)
   {
-    Message *msg = recv_raw(mid);
+    Message *msg = recv_raw(mid, row_buffer);
     if (mid != Mysqlx::ServerMessages::NOTICE)
       return msg;
 
-    dispatch_notice(static_cast<Mysqlx::Notice::Frame*>(msg));
+    dispatch_notice(static_cast<Mysqlx::Notice::Frame*>(msg), notice_target);
     delete msg;
   }
 }
 
 Message *Connection::recv_raw_with_deadline(int &mid, const std::size_t deadline_miliseconds)
 {
-  char header_buffer[5];
-  std::size_t data = sizeof(header_buffer);
-  boost::system::error_code error = m_sync_connection.read_with_timeout(header_buffer, data, deadline_miliseconds);
+  const std::size_t in_buffer = m_read_end - m_read_begin;
 
-  if (0 == data)
+  if (in_buffer < 5)
   {
-    m_closed = true;
-    return NULL;
+    // Completes the header in the read-ahead buffer, without blocking past the deadline
+    if (m_read_buffer.size() - m_read_begin < 5)
+    {
+      std::memmove(&m_read_buffer[0], &m_read_buffer[m_read_begin], in_buffer);
+      m_read_begin = 0;
+      m_read_end = in_buffer;
+    }
+
+    std::size_t data = 5 - in_buffer;
+    boost::system::error_code error = m_sync_connection.read_with_timeout(&m_read_buffer[m_read_end], data, deadline_miliseconds);
+
+    if (0 == data)
+    {
+      m_closed = true;
+      return NULL;
+    }
+
+    throw_mysqlx_error(error);
+
+    m_read_end += data;
   }
 
-  throw_mysqlx_error(error);
+  return recv_message_with_header(mid);
+}
 
-  return recv_message_with_header(mid, header_buffer, sizeof(header_buffer));
+void Connection::reset_read_buffer()
+{
+  m_read_begin = 0;
+  m_read_end = 0;
 }
 
-Message *Connection::recv_payload(const int mid, const std::size_t msglen)
+void Connection::fill_read_buffer(const std::size_t needed)
 {
-  boost::system::error_code error;
-  Message* ret_val = NULL;
-  char *mbuf = new char[msglen];
+  std::size_t in_buffer = m_read_end - m_read_begin;
 
-  error = m_sync_connection.read(mbuf, msglen);
+  if (in_buffer >= needed)
+    return;
 
-  if (!error)
+  // Moves the pending bytes to the front, growing the buffer if the frame does not fit
+  if (m_read_buffer.size() - m_read_begin < needed)
   {
-    switch (mid)
-    {
-      case Mysqlx::ServerMessages::OK:
-        ret_val = new Mysqlx::Ok();
-        break;
-      case Mysqlx::ServerMessages::ERROR:
-        ret_val = new Mysqlx::Error();
-        break;
-      case Mysqlx::ServerMessages::NOTICE:
-        ret_val = new Mysqlx::Notice::Frame();
-        break;
-      case Mysqlx::ServerMessages::CONN_CAPABILITIES:
-        ret_val = new Mysqlx::Connection::Capabilities();
-        break;
-      case Mysqlx::ServerMessages::SESS_AUTHENTICATE_CONTINUE:
-        ret_val = new Mysqlx::Session::AuthenticateContinue();
-        break;
-      case Mysqlx::ServerMessages::SESS_AUTHENTICATE_OK:
-        ret_val = new Mysqlx::Session::AuthenticateOk();
-        break;
-      case Mysqlx::ServerMessages::RESULTSET_COLUMN_META_DATA:
-        ret_val = new Mysqlx::Resultset::ColumnMetaData();
-        break;
-      case Mysqlx::ServerMessages::RESULTSET_ROW:
-        ret_val = new Mysqlx::Resultset::Row();
-        break;
-      case Mysqlx::ServerMessages::RESULTSET_FETCH_DONE:
-        ret_val = new Mysqlx::Resultset::FetchDone();
-        break;
-      case Mysqlx::ServerMessages::RESULTSET_FETCH_DONE_MORE_RESULTSETS:
-        ret_val = new Mysqlx::Resultset::FetchDoneMoreResultsets();
-        break;
-      case Mysqlx::ServerMessages::SQL_STMT_EXECUTE_OK:
-        ret_val = new Mysqlx::Sql::StmtExecuteOk();
-        break;
-    }
+    if (in_buffer)
+      std::memmove(&m_read_buffer[0], &m_read_buffer[m_read_begin], in_buffer);
 
-    if (!ret_val)
-    {
-      delete[] mbuf;
-      std::stringstream ss;
-      ss << "Unknown message received from server ";
-      ss << mid;
-      throw Error(CR_MALFORMED_PACKET, ss.str());
-    }
+    m_read_begin = 0;
+    m_read_end = in_buffer;
 
-    // Parses the received message
-    ret_val->ParseFromString(std::string(mbuf, msglen));
+    if (m_read_buffer.size() < needed)
+      m_read_buffer.resize(needed);
+  }
 
-    if (m_trace_packets)
-    {
-      std::string out;
-      google::protobuf::TextFormat::Printer p;
-      p.SetInitialIndentLevel(1);
-      p.PrintToString(*ret_val, &out);
-      std::cout << "<<<< RECEIVE " << msglen << " " << ret_val->GetDescriptor()->full_name() << " {\n" << out << "}\n";
-    }
+  // Reads as much as the socket has available on each call
+  while (in_buffer < needed)
+  {
+    std::size_t bytes_read = 0;
+    boost::system::error_code error = m_sync_connection.read_some(&m_read_buffer[m_read_end], m_read_buffer.size() - m_read_end, bytes_read);
 
-    if (!ret_val->IsInitialized())
-    {
-      delete[] mbuf;
-      delete ret_val;
-      std::string err("Message is not properly initialized: ");
-      err += ret_val->InitializationErrorString();
-      throw Error(CR_MALFORMED_PACKET, err);
-    }
+    m_read_end += bytes_read;
+    in_buffer += bytes_read;
+
+    if (error && in_buffer < needed)
+      throw_mysqlx_error(error);
   }
-  else
+}
+
+// When row_buffer is given and a row is received, the row is parsed into it
+// instead of into a new message, the caller keeps the ownership of row_buffer
+Message *Connection::recv_payload(const int mid, const std::size_t msglen, Mysqlx::Resultset::Row *row_buffer)
+{
+  Message* ret_val = NULL;
+
+  fill_read_buffer(msglen);
+
+  const char *mbuf = &m_read_buffer[m_read_begin];
+  m_read_begin += msglen;
+
+  switch (mid)
   {
-    delete[] mbuf;
-    throw_mysqlx_error(error);
+    case Mysqlx::ServerMessages::OK:
+      ret_val = new Mysqlx::Ok();
+      break;
+    case Mysqlx::ServerMessages::ERROR:
+      ret_val = new Mysqlx::Error();
+      break;
+    case Mysqlx::ServerMessages::NOTICE:
+      ret_val = new Mysqlx::Notice::Frame();
+      break;
+    case Mysqlx::ServerMessages::CONN_CAPABILITIES:
+      ret_val = new Mysqlx::Connection::Capabilities();
+      break;
+    case Mysqlx::ServerMessages::SESS_AUTHENTICATE_CONTINUE:
+      ret_val = new Mysqlx::Session::AuthenticateContinue();
+      break;
+    case Mysqlx::ServerMessages::SESS_AUTHENTICATE_OK:
+      ret_val = new Mysqlx::Session::AuthenticateOk();
+      break;
+    case Mysqlx::ServerMessages::RESULTSET_COLUMN_META_DATA:
+      ret_val = new Mysqlx::Resultset::ColumnMetaData();
+      break;
+    case Mysqlx::ServerMessages::RESULTSET_ROW:
+      if (row_buffer)
+      {
+        // Clear() keeps the field strings allocated so they get reused
+        row_buffer->Clear();
+        ret_val = row_buffer;
+      }
+      else
+        ret_val = new Mysqlx::Resultset::Row();
+      break;
+    case Mysqlx::ServerMessages::RESULTSET_FETCH_DONE:
+      ret_val = new Mysqlx::Resultset::FetchDone();
+      break;
+    case Mysqlx::ServerMessages::RESULTSET_FETCH_DONE_MORE_RESULTSETS:
+      ret_val = new Mysqlx::Resultset::FetchDoneMoreResultsets();
+      break;
+    case Mysqlx::ServerMessages::SQL_STMT_EXECUTE_OK:
+      ret_val = new Mysqlx::Sql::StmtExecuteOk();
+      break;
   }
 
-  delete[] mbuf;
+  if (!ret_val)
+  {
+    std::stringstream ss;
+    ss << "Unknown message received from server ";
+    ss << mid;
+    throw Error(CR_MALFORMED_PACKET, ss.str());
+  }
+
+  // Parses the received message straight from the read-ahead buffer
+  ret_val->ParseFromArray(mbuf, static_cast<int>(msglen));
+
+  if (m_trace_packets)
+  {
+    std::string out;
+    google::protobuf::TextFormat::Printer p;
+    p.SetInitialIndentLevel(1);
+    p.PrintToString(*ret_val, &out);
+    std::cout << "<<<< RECEIVE " << msglen << " " << ret_val->GetDescriptor()->full_name() << " {\n" << out << "}\n";
+  }
+
+  if (!ret_val->IsInitialized())
+  {
+    std::string err("Message is not properly initialized: ");
+    err += ret_val->InitializationErrorString();
+    if (ret_val != row_buffer)
+      delete ret_val;
+    throw Error(CR_MALFORMED_PACKET, err);
+  }
 
   return ret_val;
 }
 
-Message *Connection::recv_raw(int &mid)
+Message *Connection::recv_raw(int &mid, Mysqlx::Resultset::Row *row_buffer)
 {
-  char buf[5];
-
-  return recv_message_with_header(mid, buf, 0);
+  return recv_message_with_header(mid, row_buffer);
 }
 
-Message *Connection::recv_message_with_header(int &mid, char(&header_buffer)[5], const std::size_t header_offset)
+Message *Connection::recv_message_with_header(int &mid, Mysqlx::Resultset::Row *row_buffer)
 {
-  Message* ret_val = NULL;
-  boost::system::error_code error;
+  char header_buffer[5];
+
+  fill_read_buffer(sizeof(header_buffer));
 
-  error = m_sync_connection.read(header_buffer + header_offset, 5 - header_offset);
+  std::memcpy(header_buffer, &m_read_buffer[m_read_begin], sizeof(header_buffer));
+  m_read_begin += sizeof(header_buffer);
 
 #ifdef WORDS_BIGENDIAN
   std::swap(header_buffer[0], header_buffer[3]);
   std::swap(header_buffer[1], header_buffer[2]);
 #endif
 
-  if (!error)
-  {
-    uint32_t msglen = *(uint32_t*)header_buffer - 1;
-    mid = header_buffer[4];
+  uint32_t msglen = *(uint32_t*)header_buffer - 1;
+  mid = header_buffer[4];
 
-    ret_val = recv_payload(mid, msglen);
-  }
-  else
-  {
-    throw_mysqlx_error(error);
-  }
-
-  return ret_val;
+  return recv_payload(mid, msglen, row_buffer);
 }
 
 void Connection::throw_mysqlx_error(const boost::system::error_code &error)
@@ -1033,13 +1231,13 @@ void Document::reset(const std::string &doc, bool expression, const std::string
 }
 
 Result::Result(std::shared_ptr<Connection>owner, bool expect_data, bool expect_ok)
-  : current_message(NULL), m_owner(owner), m_last_insert_id(-1), m_affected_rows(-1),
+  : current_message(NULL), m_row_buffer(NULL), m_owner(owner), m_last_insert_id(-1), m_affected_rows(-1),
   m_result_index(0), m_state(expect_data ? ReadMetadataI : expect_ok ? ReadStmtOkI : ReadDone), m_buffered(false), m_buffering(false), m_has_doc_ids(false)
 {
 }
 
 Result::Result()
-  : current_message(NULL), m_state(ReadDone), m_buffered(false), m_buffering(false)
+  : current_message(NULL), m_row_buffer(NULL), m_state(ReadDone), m_buffered(false), m_buffering(false)
 {
 }
 
@@ -1050,6 +1248,7 @@ Result::~Result()
     nextDataSet();
 
   delete current_message;
+  delete m_row_buffer;
 }
 
 std::shared_ptr<std::vector<ColumnMetadata> > Result::columnMetadata()
@@ -1073,6 +1272,11 @@ bool Result::ready()
 
 void Result::wait()
 {
+  // Errors found when the result was read in advance, see
+  // Connection::read_pending_results()
+  if (m_pending_error)
+    throw *m_pending_error;
+
   if (m_state == ReadMetadataI)
     read_metadata();
   if (m_state == ReadStmtOkI)
@@ -1163,20 +1367,24 @@ int Result::get_message_id()
 
   if (owner)
   {
-    owner->push_local_notice_handler(boost::bind(&Result::handle_notice, this, _1, _2));
-
     try
     {
-      current_message = owner->recv_next(current_message_id);
+      // Results of statements pipelined before this one are read first
+      if (!owner->m_pending_results.empty())
+        owner->read_pending_results(this);
+
+      // Notices received while reading are routed to this result
+      current_message = owner->recv_next(current_message_id, m_row_buffer, this);
+
+      // The row buffer is now owned by current_message
+      if (current_message == m_row_buffer)
+        m_row_buffer = NULL;
     }
     catch (...)
     {
       m_state = ReadError;
-      owner->pop_local_notice_handler();
       throw;
     }
-
-    owner->pop_local_notice_handler();
   }
 
   // error messages that can be received in any state
@@ -1249,6 +1457,15 @@ int Result::get_message_id()
         case Mysqlx::ServerMessages::SQL_STMT_EXECUTE_OK:
           m_state = ReadDone;
           return current_message_id;
+
+        case Mysqlx::ServerMessages::OK:
+          // Reply to messages other than statements, i.e. expectations
+          if (m_state == ReadStmtOkI)
+          {
+            m_state = ReadDone;
+            return current_message_id;
+          }
+          break;
       }
       break;
     }
@@ -1296,6 +1513,14 @@ const std::vector<std::string>& Result::lastDocumentIds()
   return m_last_document_ids;
 }
 
+void Result::mergeStatus(const Result &previous)
+{
+  if (previous.m_affected_rows > 0)
+    m_affected_rows = std::max<int64_t>(m_affected_rows, 0) + previous.m_affected_rows;
+
+  m_warnings.insert(m_warnings.begin(), previous.m_warnings.begin(), previous.m_warnings.end());
+}
+
 void Result::setLastDocumentIDs(const std::vector<std::string>& document_ids)
 {
   m_has_doc_ids = true;
@@ -1400,6 +1625,16 @@ std::shared_ptr<Row> Result::read_row()
   if (m_state != ReadRows)
     throw std::logic_error("read_row() called at wrong time");
 
+  // If the row returned last time is no longer referenced by the caller, its
+  // message is handed to the connection so the next row is parsed into it
+  bool reuse_last_row = !m_buffering && m_last_row && m_last_row.use_count() == 1;
+
+  if (reuse_last_row && !m_row_buffer)
+  {
+    m_row_buffer = m_last_row->m_data;
+    m_last_row->m_data = NULL;
+  }
+
   // msgs we can get in this state:
   // RESULTSET_ROW
   // RESULTSET_FETCH_DONE
@@ -1408,11 +1643,23 @@ std::shared_ptr<Row> Result::read_row()
 
   if (mid == Mysqlx::ServerMessages::RESULTSET_ROW)
   {
-    ret_val.reset(new Row(m_columns, static_cast<Mysqlx::Resultset::Row*>(pop_message())));
+    Mysqlx::Resultset::Row *data = static_cast<Mysqlx::Resultset::Row*>(pop_message());
+
+    if (reuse_last_row)
+    {
+      delete m_last_row->m_data;
+      m_last_row->m_columns = m_columns;
+      m_last_row->m_data = data;
+      ret_val = m_last_row;
+    }
+    else
+      ret_val.reset(new Row(m_columns, data));
 
     // If caching adds it to the cache instead
     if (m_buffering)
       m_current_result->add_row(ret_val);
+    else
+      m_last_row = ret_val;
   }
 
   return ret_val;
@@ -1429,7 +1676,8 @@ void Result::read_stmt_ok()
   if (Mysqlx::ServerMessages::RESULTSET_FETCH_DONE == get_message_id())
     delete pop_message();
 
-  if (Mysqlx::ServerMessages::SQL_STMT_EXECUTE_OK != get_message_id())
+  int mid = get_message_id();
+  if (Mysqlx::ServerMessages::SQL_STMT_EXECUTE_OK != mid && Mysqlx::ServerMessages::OK != mid)
     throw std::runtime_error("Unexpected message id");
 
   boost::scoped_ptr<mysqlx::Message> msg(pop_message());
@@ -381,6 +381,9 @@ namespace mysqlx
     };
     const std::vector<Warning> &getWarnings() const { return m_warnings; }
     void setLastDocumentIDs(const std::vector<std::string>& document_ids);
+    // Accumulates the status of a previous statement sent as part of the same
+    // operation
+    void mergeStatus(const Result &previous);
   private:
     Result();
     Result(const Result &o);
@@ -398,6 +401,10 @@ namespace mysqlx
     mysqlx::Message* current_message;
     int              current_message_id;
 
+    // Row reuse for unbuffered results, see read_row()
+    Mysqlx::Resultset::Row *m_row_buffer;
+    std::shared_ptr<Row> m_last_row;
+
     friend class Connection;
     std::weak_ptr<Connection>m_owner;
     std::shared_ptr<std::vector<ColumnMetadata> > m_columns;
@@ -425,6 +432,9 @@ namespace mysqlx
     bool m_buffered;
     bool m_buffering;
     bool m_has_doc_ids;
+
+    // Error of a pipelined statement, thrown by wait()
+    std::shared_ptr<Error> m_pending_error;
   };
 };
 
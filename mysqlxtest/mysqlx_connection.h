@@ -51,6 +51,7 @@
 #include <boost/asio.hpp>
 #include <boost/function.hpp>
 #include <list>
+#include <vector>
 
 #include "mysqlx_sync_connection.h"
 #include "mysqlx_common.h"
@@ -119,10 +120,11 @@ namespace mysqlx
     void enable_tls();
 
     void send(int mid, const Message &msg);
-    Message *recv_next(int &mid);
+    void send(int mid, const std::string &payload);
+    Message *recv_next(int &mid, Mysqlx::Resultset::Row *row_buffer = NULL);
 
-    Message *recv_raw(int &mid);
-    Message *recv_payload(const int mid, const std::size_t msglen);
+    Message *recv_raw(int &mid, Mysqlx::Resultset::Row *row_buffer = NULL);
+    Message *recv_payload(const int mid, const std::size_t msglen, Mysqlx::Resultset::Row *row_buffer = NULL);
     Message *recv_raw_with_deadline(int &mid, const std::size_t deadline_miliseconds);
 
     std::shared_ptr<Result> recv_result();
@@ -136,6 +138,10 @@ namespace mysqlx
     // Overrides for SQL Messages
     void send(const Mysqlx::Sql::StmtExecute &m) { send(Mysqlx::ClientMessages::SQL_STMT_EXECUTE, m); };
 
+    // Overrides for Expectations
+    void send(const Mysqlx::Expect::Open &m) { send(Mysqlx::ClientMessages::EXPECT_OPEN, m); };
+    void send(const Mysqlx::Expect::Close &m) { send(Mysqlx::ClientMessages::EXPECT_CLOSE, m); };
+
     // Overrides for CRUD operations
     void send(const Mysqlx::Crud::Find &m) { send(Mysqlx::ClientMessages::CRUD_FIND, m); };
     void send(const Mysqlx::Crud::Insert &m) { send(Mysqlx::ClientMessages::CRUD_INSERT, m); };
@@ -157,6 +163,20 @@ namespace mysqlx
     std::shared_ptr<Result> execute_insert(const Mysqlx::Crud::Insert &m);
     std::shared_ptr<Result> execute_delete(const Mysqlx::Crud::Delete &m);
 
+    // Executes a CRUD message that is already encoded, as the statements
+    // reusing the message encoding between executions do
+    std::shared_ptr<Result> execute_encoded(int mid, const std::string &payload);
+
+    // Pipelined SQL execution: the statement is sent without waiting for the
+    // results of the ones sent before, results are read in the order the
+    // statements were sent. With stop_on_error the statements are sent on an
+    // expectation block so once one fails the following ones fail as well.
+    std::shared_ptr<Result> send_sql(const std::string &sql, bool stop_on_error);
+
+    // Reads the results of the pipelined statements not read yet and closes
+    // the expectation block, done before sending anything else
+    void read_pending_results();
+
     void fetch_capabilities();
     void setup_capability(const std::string &name, const bool value);
     void setup_capability(const std::string &name, const bool value, int& out_error, std::string &out_error_msg, bool should_throw = false);
@@ -173,11 +193,17 @@ namespace mysqlx
     bool expired_account() { return m_account_expired; }
     std::shared_ptr<Result> new_empty_result();
   private:
+    friend class Result;
+    Message *recv_next(int &mid, Mysqlx::Resultset::Row *row_buffer, Result *notice_target);
+
     void perform_close();
-    void dispatch_notice(Mysqlx::Notice::Frame *frame);
-    Message *recv_message_with_header(int &mid, char(&header_buffer)[5], const std::size_t header_offset);
+    void dispatch_notice(Mysqlx::Notice::Frame *frame, Result *notice_target = NULL);
+    Message *recv_message_with_header(int &mid, Mysqlx::Resultset::Row *row_buffer = NULL);
+    void fill_read_buffer(const std::size_t needed);
+    void reset_read_buffer();
     void throw_mysqlx_error(const boost::system::error_code &ec);
     std::shared_ptr<Result> new_result(bool expect_data);
+    void read_pending_results(Result *until);
 
   private:
     typedef boost::asio::ip::tcp tcp;
@@ -194,6 +220,15 @@ namespace mysqlx
     bool m_closed;
     const bool m_dont_wait_for_disconnect;
     std::shared_ptr<Result> m_last_result;
+
+    // Results of pipelined statements, in the order they were sent
+    std::list<std::shared_ptr<Result> > m_pending_results;
+    bool m_expect_block_open;
+
+    // Read-ahead buffer, frames are sliced from [m_read_begin, m_read_end)
+    std::vector<char> m_read_buffer;
+    std::size_t m_read_begin;
+    std::size_t m_read_end;
   };
 
   typedef std::shared_ptr<Connection> ConnectionRef;
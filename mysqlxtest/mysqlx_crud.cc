@@ -111,8 +111,15 @@ RemoveStatement Collection::remove(const std::string &searchCondition)
   return tmp;
 }
 
+Statement::Statement()
+  : m_encoded_message(new std::string()), m_args_encoded(false)
+{
+}
+
 Statement::Statement(const Statement& other) :
-m_placeholders(other.m_placeholders), m_bound_values(other.m_bound_values)
+m_placeholders(other.m_placeholders), m_bound_values(other.m_bound_values),
+m_encoded_message(other.m_encoded_message), m_encoded_args(other.m_encoded_args),
+m_args_encoded(other.m_args_encoded)
 {
 }
 
@@ -123,11 +130,8 @@ Statement::~Statement()
 void Statement::init_bound_values()
 {
   // Initializes the bound values array on the first call to bind
-  if (!m_bound_values.size())
-  {
-    for (size_t index = 0; index < m_placeholders.size(); index++)
-      m_bound_values.push_back(NULL);
-  }
+  if (m_bound_values.size() < m_placeholders.size())
+    m_bound_values.resize(m_placeholders.size());
 }
 
 void Statement::validate_bind_placeholder(const std::string& name)
@@ -138,33 +142,87 @@ void Statement::validate_bind_placeholder(const std::string& name)
     throw std::logic_error("Unable to bind value for unexisting placeholder: " + name);
 }
 
-void Statement::insert_bound_values(::google::protobuf::RepeatedPtrField< ::Mysqlx::Datatypes::Scalar >* target)
+void Statement::set_bound_value(const std::string& name, Mysqlx::Datatypes::Scalar *value)
 {
-  // First validates that all the placeholders have a bound value
-  std::string str_undefined;
-  if (m_placeholders.size() && !m_bound_values.size())
-    str_undefined = boost::algorithm::join(m_placeholders, ", ");
-  else
+  std::shared_ptr<Mysqlx::Datatypes::Scalar> scalar(value);
+
+  init_bound_values();
+
+  validate_bind_placeholder(name);
+
+  // Now sets the right value on the position of the indicated placeholder
+  std::vector<std::string>::iterator index = std::find(m_placeholders.begin(), m_placeholders.end(), name);
+  m_bound_values[index - m_placeholders.begin()] = scalar;
+
+  m_args_encoded = false;
+}
+
+void Statement::reset_encoded()
+{
+  m_encoded_message->clear();
+  m_args_encoded = false;
+}
+
+const std::string &Statement::encode(const Message &message, int args_field, const char *statement)
+{
+  if (m_encoded_message->empty())
+  {
+    if (!message.IsInitialized())
+      throw std::logic_error(std::string(statement) + " is not completely initialized: " + message.InitializationErrorString());
+
+    message.SerializeToString(m_encoded_message.get());
+  }
+
+  if (!m_args_encoded)
   {
+    // First validates that all the placeholders have a bound value
     std::vector<std::string> undefined;
-    for (size_t index = 0; index < m_bound_values.size(); index++)
+    for (size_t index = 0; index < m_placeholders.size(); index++)
     {
-      if (!m_bound_values[index])
+      if (index >= m_bound_values.size() || !m_bound_values[index])
         undefined.push_back(m_placeholders[index]);
     }
 
-    str_undefined = boost::algorithm::join(undefined, ", ");
+    // Throws the error if needed
+    if (!undefined.empty())
+      throw std::logic_error("Missing value bindings for the next placeholders: " + boost::algorithm::join(undefined, ", "));
+
+    // No errors, encodes the values as the repeated args field would be
+    const uint32_t tag = google::protobuf::internal::WireFormatLite::MakeTag(args_field,
+                           google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+
+    m_encoded_args.clear();
+    for (size_t index = 0; index < m_placeholders.size(); index++)
+    {
+      uint8_t header[10];
+      uint8_t *header_end = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(tag, header);
+      header_end = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(m_bound_values[index]->ByteSize(), header_end);
+
+      m_encoded_args.append(reinterpret_cast<const char*>(header), header_end - header);
+      m_bound_values[index]->AppendPartialToString(&m_encoded_args);
+    }
+
+    m_args_encoded = true;
   }
 
-  // Throws the error if needed
-  if (!str_undefined.empty())
-    throw std::logic_error("Missing value bindings for the next placeholders: " + str_undefined);
+  // The buffer keeps its capacity so executing again does not allocate
+  m_payload.assign(*m_encoded_message);
+  m_payload.append(m_encoded_args);
 
-  // No errors, proceeds to set the values if any
-  target->Clear();
-  std::vector<Mysqlx::Datatypes::Scalar*>::const_iterator index, end = m_bound_values.end();
-  for (index = m_bound_values.begin(); index != end; index++)
-    target->AddAllocated(*index);
+  return m_payload;
+}
+
+std::shared_ptr<Result> Statement::execute_encoded(std::shared_ptr<Session> session, int mid, const Message &message,
+                                                   int args_field, const char *statement)
+{
+  const std::string &payload(encode(message, args_field, statement));
+
+  std::shared_ptr<Result> result(session->connection()->execute_encoded(mid, payload));
+
+  // wait for results (at least metadata) to arrive
+  result->wait();
+
+  return result;
 }
 
 Collection_Statement::Collection_Statement(std::shared_ptr<Collection> coll)
@@ -179,13 +237,7 @@ Collection_Statement::Collection_Statement(const Collection_Statement& other)
 
 Collection_Statement &Collection_Statement::bind(const std::string &name, const DocumentValue &value)
 {
-  init_bound_values();
-
-  validate_bind_placeholder(name);
-
-  // Now sets the right value on the position of the indicated placeholder
-  std::vector<std::string>::iterator index = std::find(m_placeholders.begin(), m_placeholders.end(), name);
-  m_bound_values[index - m_placeholders.begin()] = convert_document_value(value);
+  set_bound_value(name, convert_document_value(value));
 
   return *this;
 }
@@ -240,40 +292,33 @@ Find_Base::Find_Base(const Find_Base &other)
 Find_Base &Find_Base::operator = (const Find_Base &other)
 {
   m_find = other.m_find;
+  m_encoded_message = other.m_encoded_message;
   return *this;
 }
 
 std::shared_ptr<Result> Find_Base::execute()
 {
-  insert_bound_values(m_find->mutable_args());
-
-  if (!m_find->IsInitialized())
-    throw std::logic_error("FindStatement is not completely initialized: " + m_find->InitializationErrorString());
-
-  SessionRef session(m_coll->schema()->session());
-
-  std::shared_ptr<Result> result(session->connection()->execute_find(*m_find));
-
-  // wait for results (at least metadata) to arrive
-  result->wait();
-
-  return result;
+  return execute_encoded(m_coll->schema()->session(), Mysqlx::ClientMessages::CRUD_FIND, *m_find,
+                         Mysqlx::Crud::Find::kArgsFieldNumber, "FindStatement");
 }
 
 Find_Base &Find_Skip::skip(uint64_t skip_)
 {
+  reset_encoded();
   m_find->mutable_limit()->set_offset(skip_);
   return *this;
 }
 
 Find_Skip &Find_Limit::limit(uint64_t limit_)
 {
+  reset_encoded();
   m_find->mutable_limit()->set_row_count(limit_);
   return *this;
 }
 
 Find_Limit &Find_Sort::sort(const std::vector<std::string> &sortFields)
 {
+  reset_encoded();
   std::vector<std::string>::const_iterator index, end = sortFields.end();
 
   for (index = sortFields.begin(); index != end; index++)
@@ -284,6 +329,7 @@ Find_Limit &Find_Sort::sort(const std::vector<std::string> &sortFields)
 
 Find_Sort &Find_Having::having(const std::string &searchCondition)
 {
+  reset_encoded();
   if (!searchCondition.empty())
     m_find->set_allocated_grouping_criteria(parser::parse_collection_filter(searchCondition, &m_placeholders));
 
@@ -292,6 +338,7 @@ Find_Sort &Find_Having::having(const std::string &searchCondition)
 
 Find_Having &Find_GroupBy::groupBy(const std::vector<std::string> &searchFields)
 {
+  reset_encoded();
   std::vector<std::string>::const_iterator index, end = searchFields.end();
 
   for (index = searchFields.begin(); index != end; index++)
@@ -302,9 +349,8 @@ Find_Having &Find_GroupBy::groupBy(const std::vector<std::string> &searchFields)
 
 Find_GroupBy &FindStatement::fields(const std::string& projection)
 {
-  ::mysqlx::Expr_parser parser(projection, true, false, &m_placeholders);
-
-  Mysqlx::Expr::Expr *expr_obj = parser.expr();
+  reset_encoded();
+  Mysqlx::Expr::Expr *expr_obj = Expr_cache::instance().expr(projection, true, false, &m_placeholders);
 
   m_find->mutable_projection()->Add()->set_allocated_source(expr_obj);
 
@@ -313,6 +359,7 @@ Find_GroupBy &FindStatement::fields(const std::string& projection)
 
 Find_GroupBy &FindStatement::fields(const std::vector<std::string> &searchFields)
 {
+  reset_encoded();
   std::vector<std::string>::const_iterator index, end = searchFields.end();
 
   for (index = searchFields.begin(); index != end; index++)
@@ -334,19 +381,24 @@ FindStatement::FindStatement(std::shared_ptr<Collection> coll, const std::string
 
 //----------------------------------
 
+// Matches the default mysqlx_max_allowed_packet of the server, leaving room
+// for the message header
+static const size_t DEFAULT_MAX_INSERT_SIZE = 1024 * 1024 - 1024;
+
 Add_Base::Add_Base(std::shared_ptr<Collection> coll)
-  : Collection_Statement(coll), m_insert(new Mysqlx::Crud::Insert())
+  : Collection_Statement(coll), m_insert(new Mysqlx::Crud::Insert()), m_max_message_size(DEFAULT_MAX_INSERT_SIZE)
 {
 }
 
 Add_Base::Add_Base(const Add_Base &other)
-  : Collection_Statement(other), m_insert(other.m_insert)
+  : Collection_Statement(other), m_insert(other.m_insert), m_max_message_size(other.m_max_message_size)
 {
 }
 
 Add_Base &Add_Base::operator = (const Add_Base &other)
 {
   m_insert = other.m_insert;
+  m_max_message_size = other.m_max_message_size;
   return *this;
 }
 
@@ -361,7 +413,9 @@ std::shared_ptr<Result> Add_Base::execute()
   SessionRef session(m_coll->schema()->session());
 
   std::shared_ptr<Result> result;
-  if (m_insert->mutable_row()->size())
+  if (m_insert->row_size() > 1 && static_cast<size_t>(m_insert->ByteSize()) > m_max_message_size)
+    result = execute_chunks();
+  else if (m_insert->mutable_row()->size())
   {
     result = session->connection()->execute_insert(*m_insert);
     result->wait();
@@ -375,6 +429,65 @@ std::shared_ptr<Result> Add_Base::execute()
   return result;
 }
 
+// Sends the documents on as many Insert messages as needed to keep them under
+// the maximum size, a document bigger than that is sent on its own message.
+// Documents sent before a failing message remain inserted unless a transaction
+// is used.
+std::shared_ptr<Result> Add_Base::execute_chunks()
+{
+  SessionRef session(m_coll->schema()->session());
+
+  // The rows are moved out of the message, which is then used for each chunk
+  int count = m_insert->row_size();
+  std::vector<Mysqlx::Crud::Insert_TypedRow*> rows(count);
+  m_insert->mutable_row()->ExtractSubrange(0, count, &rows[0]);
+
+  std::shared_ptr<Result> result;
+  std::exception_ptr error;
+  size_t header_size = m_insert->ByteSize();
+  size_t chunk_size = header_size;
+  int first = 0;
+  for (int index = 0; index <= count && !error; index++)
+  {
+    // Length prefix and tag of the row on the message
+    size_t row_size = index < count ? rows[index]->ByteSize() + 6 : 0;
+
+    if (index == count || (index > first && chunk_size + row_size > m_max_message_size))
+    {
+      for (int row = first; row < index; row++)
+        m_insert->mutable_row()->AddAllocated(rows[row]);
+
+      try
+      {
+        std::shared_ptr<Result> previous(result);
+        result = session->connection()->execute_insert(*m_insert);
+        result->wait();
+        if (previous)
+          result->mergeStatus(*previous);
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+
+      m_insert->mutable_row()->ExtractSubrange(0, index - first, &rows[first]);
+      first = index;
+      chunk_size = header_size;
+    }
+
+    chunk_size += row_size;
+  }
+
+  // Leaves the message as it was, with all the documents
+  for (int index = 0; index < count; index++)
+    m_insert->mutable_row()->AddAllocated(rows[index]);
+
+  if (error)
+    std::rethrow_exception(error);
+
+  return result;
+}
+
 AddStatement::AddStatement(std::shared_ptr<Collection> coll)
   : Add_Base(coll)
 {
@@ -430,6 +543,14 @@ AddStatement &AddStatement::add(const Document &doc)
   return *this;
 }
 
+AddStatement &AddStatement::add(Mysqlx::Expr::Expr *doc, const std::string &id)
+{
+  m_last_document_ids.push_back(id);
+  m_insert->mutable_row()->Add()->mutable_field()->AddAllocated(doc);
+
+  return *this;
+}
+
 //--------------------------------------------------------------
 
 Remove_Base::Remove_Base(std::shared_ptr<Collection> coll)
@@ -445,27 +566,19 @@ Remove_Base::Remove_Base(const Remove_Base &other)
 Remove_Base &Remove_Base::operator = (const Remove_Base &other)
 {
   m_delete = other.m_delete;
+  m_encoded_message = other.m_encoded_message;
   return *this;
 }
 
 std::shared_ptr<Result> Remove_Base::execute()
 {
-  insert_bound_values(m_delete->mutable_args());
-
-  if (!m_delete->IsInitialized())
-    throw std::logic_error("RemoveStatement is not completely initialized: " + m_delete->InitializationErrorString());
-
-  SessionRef session(m_coll->schema()->session());
-
-  std::shared_ptr<Result> result(session->connection()->execute_delete(*m_delete));
-
-  result->wait();
-
-  return result;
+  return execute_encoded(m_coll->schema()->session(), Mysqlx::ClientMessages::CRUD_DELETE, *m_delete,
+                         Mysqlx::Crud::Delete::kArgsFieldNumber, "RemoveStatement");
 }
 
 Remove_Base &Remove_Limit::limit(uint64_t limit_)
 {
+  reset_encoded();
   m_delete->mutable_limit()->set_row_count(limit_);
   return *this;
 }
@@ -483,6 +596,7 @@ RemoveStatement::RemoveStatement(std::shared_ptr<Collection> coll, const std::st
 
 Remove_Limit &RemoveStatement::sort(const std::vector<std::string> &sortFields)
 {
+  reset_encoded();
   std::vector<std::string>::const_iterator index, end = sortFields.end();
 
   for (index = sortFields.begin(); index != end; index++)
@@ -507,33 +621,26 @@ Modify_Base &Modify_Base::operator = (const Modify_Base &other)
 {
   m_coll = other.m_coll;
   m_update = other.m_update;
+  m_encoded_message = other.m_encoded_message;
   return *this;
 }
 
 std::shared_ptr<Result> Modify_Base::execute()
 {
-  insert_bound_values(m_update->mutable_args());
-
-  if (!m_update->IsInitialized())
-    throw std::logic_error("ModifyStatement is not completely initialized: " + m_update->InitializationErrorString());
-
-  SessionRef session(m_coll->schema()->session());
-
-  std::shared_ptr<Result> result(session->connection()->execute_update(*m_update));
-
-  result->wait();
-
-  return result;
+  return execute_encoded(m_coll->schema()->session(), Mysqlx::ClientMessages::CRUD_UPDATE, *m_update,
+                         Mysqlx::Crud::Update::kArgsFieldNumber, "ModifyStatement");
 }
 
 Modify_Base &Modify_Limit::limit(uint64_t limit_)
 {
+  reset_encoded();
   m_update->mutable_limit()->set_row_count(limit_);
   return *this;
 }
 
 Modify_Limit &Modify_Sort::sort(const std::vector<std::string> &sortFields)
 {
+  reset_encoded();
   std::vector<std::string>::const_iterator index, end = sortFields.end();
 
   for (index = sortFields.begin(); index != end; index++)
@@ -544,6 +651,7 @@ Modify_Limit &Modify_Sort::sort(const std::vector<std::string> &sortFields)
 
 Modify_Operation &Modify_Operation::set_operation(int type, const std::string &path, const DocumentValue *value, bool validate_array)
 {
+  reset_encoded();
   // Sets the operation
   Mysqlx::Crud::UpdateOperation * operation = m_update->mutable_operation()->Add();
   operation->set_operation(Mysqlx::Crud::UpdateOperation_UpdateType(type));
@@ -570,9 +678,14 @@ Modify_Operation &Modify_Operation::set_operation(int type, const std::string &p
   // Sets the value if applicable
   if (value)
   {
-    if (value->type() == DocumentValue::TExpression ||
-        value->type() == DocumentValue::TDocument ||
-        value->type() == DocumentValue::TArray)
+    if (value->type() == DocumentValue::TExpression)
+    {
+      // Expressions are usually the same on every call, documents are not
+      DocumentValue expression(*value);
+      operation->set_allocated_value(Expr_cache::instance().expr(expression, true, false, &m_placeholders));
+    }
+    else if (value->type() == DocumentValue::TDocument ||
+             value->type() == DocumentValue::TArray)
     {
       DocumentValue expression(*value);
       Expr_parser parser(expression, true, false, &m_placeholders);
@@ -650,13 +763,7 @@ Table_Statement::Table_Statement(const Table_Statement& other)
 
 Table_Statement &Table_Statement::bind(const std::string &name, const TableValue &value)
 {
-  init_bound_values();
-
-  validate_bind_placeholder(name);
-
-  // Now sets the right value on the position of the indicated placeholder
-  std::vector<std::string>::iterator index = std::find(m_placeholders.begin(), m_placeholders.end(), name);
-  m_bound_values[index - m_placeholders.begin()] = convert_table_value(value);
+  set_bound_value(name, convert_table_value(value));
 
   return *this;
 }
@@ -726,33 +833,26 @@ Delete_Base::Delete_Base(const Delete_Base &other)
 Delete_Base &Delete_Base::operator = (const Delete_Base &other)
 {
   m_delete = other.m_delete;
+  m_encoded_message = other.m_encoded_message;
   return *this;
 }
 
 std::shared_ptr<Result> Delete_Base::execute()
 {
-  insert_bound_values(m_delete->mutable_args());
-
-  if (!m_delete->IsInitialized())
-    throw std::logic_error("DeleteStatement is not completely initialized: " + m_delete->InitializationErrorString());
-
-  SessionRef session(m_table->schema()->session());
-
-  std::shared_ptr<Result> result(session->connection()->execute_delete(*m_delete));
-
-  result->wait();
-
-  return result;
+  return execute_encoded(m_table->schema()->session(), Mysqlx::ClientMessages::CRUD_DELETE, *m_delete,
+                         Mysqlx::Crud::Delete::kArgsFieldNumber, "DeleteStatement");
 }
 
 Delete_Base &Delete_Limit::limit(uint64_t limit_)
 {
+  reset_encoded();
   m_delete->mutable_limit()->set_row_count(limit_);
   return *this;
 }
 
 Delete_Limit &Delete_OrderBy::orderBy(const std::vector<std::string> &sortFields)
 {
+  reset_encoded();
   std::vector<std::string>::const_iterator index, end = sortFields.end();
 
   for (index = sortFields.begin(); index != end; index++)
@@ -771,6 +871,7 @@ DeleteStatement::DeleteStatement(std::shared_ptr<Table> table)
 
 Delete_OrderBy &DeleteStatement::where(const std::string& searchCondition)
 {
+  reset_encoded();
   if (!searchCondition.empty())
     m_delete->set_allocated_criteria(parser::parse_table_filter(searchCondition, &m_placeholders));
 
@@ -792,33 +893,26 @@ Update_Base::Update_Base(const Update_Base &other)
 Update_Base &Update_Base::operator = (const Update_Base &other)
 {
   m_update = other.m_update;
+  m_encoded_message = other.m_encoded_message;
   return *this;
 }
 
 std::shared_ptr<Result> Update_Base::execute()
 {
-  insert_bound_values(m_update->mutable_args());
-
-  if (!m_update->IsInitialized())
-    throw std::logic_error("UpdateStatement is not completely initialized: " + m_update->InitializationErrorString());
-
-  SessionRef session(m_table->schema()->session());
-
-  std::shared_ptr<Result> result(session->connection()->execute_update(*m_update));
-
-  result->wait();
-
-  return result;
+  return execute_encoded(m_table->schema()->session(), Mysqlx::ClientMessages::CRUD_UPDATE, *m_update,
+                         Mysqlx::Crud::Update::kArgsFieldNumber, "UpdateStatement");
 }
 
 Update_Base &Update_Limit::limit(uint64_t limit_)
 {
+  reset_encoded();
   m_update->mutable_limit()->set_row_count(limit_);
   return *this;
 }
 
 Update_Limit &Update_OrderBy::orderBy(const std::vector<std::string> &sortFields)
 {
+  reset_encoded();
   std::vector<std::string>::const_iterator index, end = sortFields.end();
 
   for (index = sortFields.begin(); index != end; index++)
@@ -829,6 +923,7 @@ Update_Limit &Update_OrderBy::orderBy(const std::vector<std::string> &sortFields
 
 Update_OrderBy &Update_Where::where(const std::string& searchCondition)
 {
+  reset_encoded();
   if (!searchCondition.empty())
     m_update->set_allocated_criteria(parser::parse_table_filter(searchCondition, &m_placeholders));
 
@@ -837,6 +932,7 @@ Update_OrderBy &Update_Where::where(const std::string& searchCondition)
 
 Update_Set &Update_Set::set(const std::string &field, const TableValue& value)
 {
+  reset_encoded();
   Mysqlx::Crud::UpdateOperation *operation = m_update->mutable_operation()->Add();
 
   operation->mutable_source()->set_name(field);
@@ -850,14 +946,14 @@ Update_Set &Update_Set::set(const std::string &field, const TableValue& value)
 
 Update_Set &Update_Set::set(const std::string &field, const std::string& expression)
 {
+  reset_encoded();
   Mysqlx::Crud::UpdateOperation *operation = m_update->mutable_operation()->Add();
 
   operation->mutable_source()->set_name(field);
 
   operation->set_operation(Mysqlx::Crud::UpdateOperation::SET);
 
-  Expr_parser parser(expression, false, false, &m_placeholders);
-  operation->set_allocated_value(parser.expr());
+  operation->set_allocated_value(Expr_cache::instance().expr(expression, false, false, &m_placeholders));
 
   return *this;
 }
@@ -885,40 +981,33 @@ Select_Base::Select_Base(const Select_Base &other)
 Select_Base &Select_Base::operator = (const Select_Base &other)
 {
   m_find = other.m_find;
+  m_encoded_message = other.m_encoded_message;
   return *this;
 }
 
 std::shared_ptr<Result> Select_Base::execute()
 {
-  insert_bound_values(m_find->mutable_args());
-
-  if (!m_find->IsInitialized())
-    throw std::logic_error("SelectStatement is not completely initialized: " + m_find->InitializationErrorString());
-
-  SessionRef session(m_table->schema()->session());
-
-  std::shared_ptr<Result> result(session->connection()->execute_find(*m_find));
-
-  // wait for results (at least metadata) to arrive
-  result->wait();
-
-  return result;
+  return execute_encoded(m_table->schema()->session(), Mysqlx::ClientMessages::CRUD_FIND, *m_find,
+                         Mysqlx::Crud::Find::kArgsFieldNumber, "SelectStatement");
 }
 
 Select_Base &Select_Offset::offset(uint64_t offset_)
 {
+  reset_encoded();
   m_find->mutable_limit()->set_offset(offset_);
   return *this;
 }
 
 Select_Offset &Select_Limit::limit(uint64_t limit_)
 {
+  reset_encoded();
   m_find->mutable_limit()->set_row_count(limit_);
   return *this;
 }
 
 Select_Limit &Select_OrderBy::orderBy(const std::vector<std::string> &sortFields)
 {
+  reset_encoded();
   std::vector<std::string>::const_iterator index, end = sortFields.end();
 
   for (index = sortFields.begin(); index != end; index++)
@@ -929,6 +1018,7 @@ Select_Limit &Select_OrderBy::orderBy(const std::vector<std::string> &sortFields
 
 Select_OrderBy &Select_Having::having(const std::string &searchCondition)
 {
+  reset_encoded();
   if (!searchCondition.empty())
     m_find->set_allocated_grouping_criteria(parser::parse_table_filter(searchCondition, &m_placeholders));
 
@@ -937,6 +1027,7 @@ Select_OrderBy &Select_Having::having(const std::string &searchCondition)
 
 Select_Having &Select_GroupBy::groupBy(const std::vector<std::string> &searchFields)
 {
+  reset_encoded();
   std::vector<std::string>::const_iterator index, end = searchFields.end();
 
   for (index = searchFields.begin(); index != end; index++)
@@ -963,6 +1054,7 @@ SelectStatement::SelectStatement(std::shared_ptr<Table> table, const std::vector
 
 Select_GroupBy &SelectStatement::where(const std::string &searchCondition)
 {
+  reset_encoded();
   if (!searchCondition.empty())
     m_find->set_allocated_criteria(parser::parse_table_filter(searchCondition, &m_placeholders));
 
@@ -1016,8 +1108,7 @@ Insert_Values &Insert_Values::values(const std::vector<TableValue> &row_data)
     if (index->type() == TableValue::TExpression)
     {
       TableValue expression(*index);
-      Expr_parser parser(expression, false, false, &m_placeholders);
-      row->mutable_field()->AddAllocated(parser.expr());
+      row->mutable_field()->AddAllocated(Expr_cache::instance().expr(expression, false, false, &m_placeholders));
     }
     else
     {
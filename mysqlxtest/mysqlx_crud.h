@@ -37,6 +37,11 @@ namespace Mysqlx
     class Any;
     class Scalar;
   }
+
+  namespace Expr
+  {
+    class Expr;
+  }
 }
 
 namespace mysqlx
@@ -69,17 +74,32 @@ namespace mysqlx
   class Statement
   {
   public:
-    Statement(){};
+    Statement();
     Statement(const Statement& other);
     virtual ~Statement();
     virtual std::shared_ptr<Result> execute() = 0;
 
   protected:
     std::vector<std::string> m_placeholders;
-    std::vector<Mysqlx::Datatypes::Scalar*> m_bound_values;
-    void insert_bound_values(::google::protobuf::RepeatedPtrField< ::Mysqlx::Datatypes::Scalar >* target);
+    std::vector<std::shared_ptr<Mysqlx::Datatypes::Scalar> > m_bound_values;
+
+    // The statement message is encoded once, without the bound values, and
+    // reused on the next executions which only encode the bound values and
+    // append them: repeated fields may come in any order on the wire.
+    // The encoded message is shared by the copies of the statement, as the
+    // message is, and is discarded by any function changing the message
+    std::shared_ptr<std::string> m_encoded_message;
+    std::string m_encoded_args;
+    bool m_args_encoded;
+    std::string m_payload;
+
     void init_bound_values();
     void validate_bind_placeholder(const std::string& name);
+    void set_bound_value(const std::string& name, Mysqlx::Datatypes::Scalar *value);
+    void reset_encoded();
+    const std::string &encode(const Message &message, int args_field, const char *statement);
+    std::shared_ptr<Result> execute_encoded(std::shared_ptr<Session> session, int mid, const Message &message,
+                                            int args_field, const char *statement);
   };
 
   // -------------------------------------------------------
@@ -675,8 +695,16 @@ namespace mysqlx
     Add_Base &operator = (const Add_Base &other);
 
     virtual std::shared_ptr<Result> execute();
+
+    // Documents exceeding this size on a single Insert message are sent on
+    // several messages
+    void set_max_message_size(size_t size) { m_max_message_size = size; }
   protected:
     std::shared_ptr<Mysqlx::Crud::Insert> m_insert;
+    size_t m_max_message_size;
+
+  private:
+    std::shared_ptr<Result> execute_chunks();
   };
 
   class AddStatement : public Add_Base
@@ -688,6 +716,8 @@ namespace mysqlx
     AddStatement &operator = (const AddStatement &other) { Add_Base::operator=(other); return *this; }
 
     AddStatement &add(const Document &doc);
+    // Adds a document already converted to an expression, takes ownership of it
+    AddStatement &add(Mysqlx::Expr::Expr *doc, const std::string &id);
   };
 
   // -------------------------------------------------------
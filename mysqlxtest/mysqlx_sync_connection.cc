@@ -318,6 +318,22 @@ error_code Mysqlx_sync_connection::read(void *data, const std::size_t data_lengt
 }
 
 
+// Reads whatever is already available on the socket (at least one byte,
+// at most data_length) with a single read request
+error_code Mysqlx_sync_connection::read_some(void *data, const std::size_t data_length, std::size_t &bytes_read)
+{
+  details::Callback_executor_ptr executor(details::get_callback_executor(m_service, m_timeout));
+  Mutable_buffer_sequence buffers;
+
+  buffers.push_back(boost::asio::buffer(data, data_length));
+  executor->read(m_async_connection, buffers);
+  error_code error = executor->wait();
+  bytes_read = executor->get_number_of_bytes();
+
+  return error;
+}
+
+
 error_code Mysqlx_sync_connection::read_with_timeout(void *data, std::size_t &data_length, const std::size_t deadline_miliseconds)
 {
   error_code error;
@@ -50,6 +50,7 @@ public:
 
   boost::system::error_code write(const void *data, const std::size_t data_length);
   boost::system::error_code read(void *data, const std::size_t data_length);
+  boost::system::error_code read_some(void *data, const std::size_t data_length, std::size_t &bytes_read);
   boost::system::error_code read_with_timeout(void *data, std::size_t &data_length, const std::size_t deadline_miliseconds);
 
   void close();
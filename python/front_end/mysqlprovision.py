@@ -271,6 +271,77 @@ _ERROR_NO_SSL_SUPPORT_SESSION = (
     "without using any SSL certificate options and re-execute the command "
     "again.")
 
+# Option to run the commands received on stdin instead of a single command
+# given on the command line, used by the MySQL Shell to avoid starting a new
+# process for each command.
+WORKER = "--worker"
+
+# Record written after the output of each command run as a worker.
+_EXIT_RECORD = '{{"type": "EXIT", "exit_code": {0}}}\n'
+
+
+def _run_worker():
+    """Runs the commands received on stdin until it is closed.
+
+    Each command comes as a JSON object on a single line, with the command
+    line arguments ("args") and the input of the command ("input"), like the
+    passwords read with --stdin. The script is run again for each command,
+    which reuses the modules already imported, and its output is followed by
+    a record with the exit code of the command.
+    """
+    import json
+    import runpy
+    try:
+        from StringIO import StringIO
+    except ImportError:
+        from io import StringIO
+
+    script = sys.argv[0]
+    requests = sys.stdin
+    while True:
+        line = requests.readline()
+        if not line:
+            break
+
+        exit_code = 0
+        try:
+            request = json.loads(line)
+            args = [arg if isinstance(arg, str) else arg.encode("utf-8")
+                    for arg in request.get("args", [])]
+            if WORKER in args:
+                raise ValueError("Nested worker requested")
+
+            sys.argv = [script] + args
+            sys.stdin = StringIO(request.get("input", ""))
+            runpy.run_path(script, run_name="__main__")
+        except SystemExit:
+            _, err, _ = sys.exc_info()
+            if err.code is None:
+                exit_code = 0
+            elif isinstance(err.code, int):
+                exit_code = err.code
+            else:
+                sys.stderr.write("{0}\n".format(err.code))
+                exit_code = 1
+        except Exception:  # pylint: disable=broad-except
+            _, err, _ = sys.exc_info()
+            sys.stdout.write(json.dumps({"type": "ERROR", "msg": str(err)}))
+            sys.stdout.write("\n")
+            exit_code = 1
+        finally:
+            # Each command sets its own logging up
+            logger.disable_logging()
+            sys.stdin = requests
+
+        sys.stderr.flush()
+        sys.stdout.write(_EXIT_RECORD.format(exit_code))
+        sys.stdout.flush()
+
+
+if __name__ == "__main__" and sys.argv[1:] == [WORKER]:
+    _run_worker()
+    sys.exit(0)
+
 if __name__ == "__main__":
     # retrieve logger
     _LOGGER = logging.getLogger(_SCRIPT_NAME)
@@ -52,6 +52,11 @@ _options(options) {
   } catch (std::logic_error &e) {
     ngcommon::Logger::create_instance(log_path.c_str(), _options.log_to_stderr, _options.log_level);
     _logger = ngcommon::Logger::singleton();
+
+    // Debug levels log on every statement, writing and flushing the file on
+    // each of them slows down everything else
+    if (_options.log_level >= ngcommon::Logger::LOG_DEBUG)
+      _logger->start_async_writer(ngcommon::Logger::ASYNC_WRITER_CAPACITY, _options.log_overflow);
   }
 
   _input_mode = shcore::Input_state::Ok;
@@ -61,6 +66,7 @@ _options(options) {
 
   // Updates shell core options that changed upon initialization
   (*shcore_options)[SHCORE_BATCH_CONTINUE_ON_ERROR] = shcore::Value(_options.force);
+  (*shcore_options)[SHCORE_BATCH_PIPELINE_SIZE] = shcore::Value(_options.pipeline_size);
   (*shcore_options)[SHCORE_INTERACTIVE] = shcore::Value(_options.interactive);
   (*shcore_options)[SHCORE_USE_WIZARDS] = shcore::Value(_options.wizards);
   if (!_options.output_format.empty())
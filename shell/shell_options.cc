@@ -31,6 +31,7 @@ Shell_options::Shell_options() {
 #endif
 
   log_level = ngcommon::Logger::LOG_INFO;
+  log_overflow = ngcommon::Logger::OVERFLOW_BLOCK;
   password = nullptr;
   session_type = mysqlsh::SessionType::Auto;
 
@@ -38,6 +39,7 @@ Shell_options::Shell_options() {
   print_cmd_line_helper = false;
   print_version = false;
   force = false;
+  pipeline_size = 0;
   interactive = false;
   full_interactive = false;
   passwords_from_stdin = false;
@@ -27,6 +27,9 @@
 #define MAX_COLUMN_LENGTH 1024
 #define MIN_COLUMN_LENGTH 4
 
+// Records read to define the column widths when streaming a result
+#define STREAM_SAMPLE_SIZE 1000
+
 using options = shcore::Shell_core_options;
 
 ResultsetDumper::ResultsetDumper(std::shared_ptr<mysqlsh::ShellBaseResult> target, shcore::Interpreter_delegate *output_handler, bool buffer_data) :
@@ -34,6 +37,10 @@ _resultset(target), _output_handler(output_handler), _buffer_data(buffer_data) {
   _format = options::get()->get_string(SHCORE_OUTPUT_FORMAT);
   _interactive = options::get()->get_bool(SHCORE_INTERACTIVE);
   _show_warnings = options::get()->get_bool(SHCORE_SHOW_WARNINGS);
+
+  // Results not buffered are no longer needed once printed so their records
+  // are streamed rather than fetched all at once
+  _stream_data = !_buffer_data || options::get()->get_bool(SHCORE_OUTPUT_STREAMING);
 }
 
 void ResultsetDumper::dump() {
@@ -42,7 +49,7 @@ void ResultsetDumper::dump() {
   // Buffers the data remaining on the record
   size_t rset, record;
   bool buffered = false;;
-  if (_buffer_data) {
+  if (_buffer_data && !_stream_data) {
     _resultset->buffer();
 
     // Stores the current data set/record position on the result
@@ -201,71 +208,86 @@ void ResultsetDumper::dump_normal(std::shared_ptr<mysqlsh::mysqlx::Result> resul
   }
 }
 
-void ResultsetDumper::dump_tabbed(shcore::Value::Array_type_ref records) {
+void ResultsetDumper::start_records(shcore::Value::Array_type_ref records, bool sample) {
   std::shared_ptr<shcore::Value::Array_type> metadata = _resultset->get_member("columns").as_array();
 
-  size_t index = 0;
-  size_t field_count = metadata->size();
-  std::vector<std::string> formats(field_count, "%-");
+  _column_labels.clear();
+  for (size_t index = 0; index < metadata->size(); index++) {
+    std::shared_ptr<mysqlsh::Column> column = std::static_pointer_cast<mysqlsh::Column>(metadata->at(index).as_object());
+    _column_labels.push_back(column->get_column_label());
+  }
 
-  // Prints the initial separator line and the column headers
+  if (_format == "vertical")
+    start_vertical();
+  else if (_interactive || _format == "table")
+    start_table(records, sample);
+  else
+    start_tabbed();
+}
+
+void ResultsetDumper::dump_record(std::shared_ptr<mysqlsh::Row> row, size_t row_index) {
+  if (_format == "vertical")
+    dump_vertical(row, row_index);
+  else if (_interactive || _format == "table")
+    dump_table(row);
+  else
+    dump_tabbed(row);
+}
+
+void ResultsetDumper::end_records() {
+  // Only the table format has a closing line
+  if (_format != "vertical" && (_interactive || _format == "table"))
+    _output_handler->print(_output_handler->user_data, _separator.c_str());
+}
+
+void ResultsetDumper::start_tabbed() {
+  size_t field_count = _column_labels.size();
+
+  // Prints the column headers
   // TODO: Consider the charset information on the length calculations
-  for (index = 0; index < field_count; index++) {
-    std::shared_ptr<mysqlsh::Column> column = std::static_pointer_cast<mysqlsh::Column>(metadata->at(index).as_object());
-    _output_handler->print(_output_handler->user_data, column->get_column_label().c_str());
+  for (size_t index = 0; index < field_count; index++) {
+    _output_handler->print(_output_handler->user_data, _column_labels[index].c_str());
     _output_handler->print(_output_handler->user_data, index < (field_count - 1) ? "\t" : "\n");
   }
+}
 
-  // Now prints the records
-  for (size_t row_index = 0; row_index < records->size(); row_index++) {
-    std::shared_ptr<mysqlsh::Row> row = (*records)[row_index].as_object<mysqlsh::Row>();
+void ResultsetDumper::dump_tabbed(std::shared_ptr<mysqlsh::Row> row) {
+  size_t field_count = _column_labels.size();
 
-    for (size_t field_index = 0; field_index < field_count; field_index++) {
-      std::string raw_value = row->get_member(field_index).descr();
-      _output_handler->print(_output_handler->user_data, raw_value.c_str());
-      _output_handler->print(_output_handler->user_data, field_index < (field_count - 1) ? "\t" : "\n");
-    }
+  for (size_t field_index = 0; field_index < field_count; field_index++) {
+    std::string raw_value = row->get_member(field_index).descr();
+    _output_handler->print(_output_handler->user_data, raw_value.c_str());
+    _output_handler->print(_output_handler->user_data, field_index < (field_count - 1) ? "\t" : "\n");
   }
 }
 
-void ResultsetDumper::dump_vertical(shcore::Value::Array_type_ref records) {
-  std::shared_ptr<shcore::Value::Array_type> metadata = _resultset->get_member("columns").as_array();
-  auto field_count = metadata->size();
-  std::string star_separator(27, '*');
-
+void ResultsetDumper::start_vertical() {
   // Calculate length of a longest column description, used to right align
   // column descriptions
-  std::size_t max_col_len = 0;
-  for (int col_index = 0; col_index < metadata->size(); col_index++) {
-    std::shared_ptr<mysqlsh::Column> column =
-        std::static_pointer_cast<mysqlsh::Column>(metadata->at(col_index).as_object());
-    max_col_len = std::max(max_col_len,  column->get_column_label().length());
-  }
-
-  for (int row_index = 0; row_index < records->size(); row_index++) {
-    std::string row_header = star_separator + " " + std::to_string(row_index + 1) +
-      ". row " + star_separator + "\n";
+  _max_label_length = 0;
+  for (size_t col_index = 0; col_index < _column_labels.size(); col_index++)
+    _max_label_length = std::max(_max_label_length, _column_labels[col_index].length());
+}
 
-    _output_handler->print(_output_handler->user_data, row_header.c_str());
+void ResultsetDumper::dump_vertical(std::shared_ptr<mysqlsh::Row> row, size_t row_index) {
+  std::string star_separator(27, '*');
+  std::string row_header = star_separator + " " + std::to_string(row_index + 1) +
+    ". row " + star_separator + "\n";
 
-    for (int col_index = 0; col_index < metadata->size(); col_index++) {
-      std::shared_ptr<mysqlsh::Column> column =
-          std::static_pointer_cast<mysqlsh::Column>(metadata->at(col_index).as_object());
+  _output_handler->print(_output_handler->user_data, row_header.c_str());
 
-      std::shared_ptr<mysqlsh::Row> row = records->at(row_index).as_object<mysqlsh::Row>();
-      std::string padding(max_col_len - column->get_column_label().size(), ' ');
-      std::string value_row = padding + column->get_column_label() + ": " +
-          row->get_member(col_index).descr() + "\n";
+  for (size_t col_index = 0; col_index < _column_labels.size(); col_index++) {
+    std::string padding(_max_label_length - _column_labels[col_index].size(), ' ');
+    std::string value_row = padding + _column_labels[col_index] + ": " +
+        row->get_member(col_index).descr() + "\n";
 
-      _output_handler->print(_output_handler->user_data, value_row.c_str());
-    }
+    _output_handler->print(_output_handler->user_data, value_row.c_str());
   }
 }
 
-void ResultsetDumper::dump_table(shcore::Value::Array_type_ref records) {
+void ResultsetDumper::start_table(shcore::Value::Array_type_ref records, bool sample) {
   std::shared_ptr<shcore::Value::Array_type> metadata = _resultset->get_member("columns").as_array();
   std::vector<uint64_t> max_lengths;
-  std::vector<std::string> column_names;
   std::vector<bool> numerics;
 
   size_t field_count = metadata->size();
@@ -274,14 +296,19 @@ void ResultsetDumper::dump_table(shcore::Value::Array_type_ref records) {
   for (size_t field_index = 0; field_index < field_count; field_index++) {
     std::shared_ptr<mysqlsh::Column> column = std::static_pointer_cast<mysqlsh::Column>(metadata->at(field_index).as_object());
 
-    column_names.push_back(column->get_column_label());
     numerics.push_back(column->is_numeric());
 
     max_lengths.push_back(0);
-    max_lengths[field_index] = std::max<uint64_t>(max_lengths[field_index], column->get_column_label().length());
+    max_lengths[field_index] = std::max<uint64_t>(max_lengths[field_index], _column_labels[field_index].length());
+
+    // Numbers past the sample fit in the length of their type, unlike text
+    // it is not much wider than the data
+    if (sample && numerics[field_index])
+      max_lengths[field_index] = std::max<uint64_t>(max_lengths[field_index], column->get_length());
   }
 
-  // Now updates the length with the real column data lengths
+  // Now updates the length with the real column data lengths, when streaming
+  // these are only the records on the sample
   size_t row_index;
   for (row_index = 0; row_index < records->size(); row_index++) {
     std::shared_ptr<mysqlsh::Row> row = (*records)[row_index].as_object<mysqlsh::Row>();
@@ -292,56 +319,64 @@ void ResultsetDumper::dump_table(shcore::Value::Array_type_ref records) {
   //-----------
 
   size_t index = 0;
-  std::vector<std::string> formats(field_count, "%-");
+  _formats.assign(field_count, "%-");
+  _column_widths.assign(max_lengths.begin(), max_lengths.end());
 
   // Calculates the max column widths and constructs the separator line.
-  std::string separator("+");
+  _separator = "+";
   for (index = 0; index < field_count; index++) {
     // Creates the format string to print each field
-    formats[index].append(boost::lexical_cast<std::string>(max_lengths[index]));
+    _formats[index].append(boost::lexical_cast<std::string>(max_lengths[index]));
     if (index == field_count - 1)
-      formats[index].append("s |");
+      _formats[index].append("s |");
     else
-      formats[index].append("s | ");
+      _formats[index].append("s | ");
 
     std::string field_separator(max_lengths[index] + 2, '-');
     field_separator.append("+");
-    separator.append(field_separator);
+    _separator.append(field_separator);
   }
-  separator.append("\n");
+  _separator.append("\n");
 
   // Prints the initial separator line and the column headers
   // TODO: Consider the charset information on the length calculations
-  _output_handler->print(_output_handler->user_data, separator.c_str());
+  _output_handler->print(_output_handler->user_data, _separator.c_str());
   _output_handler->print(_output_handler->user_data, +"| ");
   for (index = 0; index < field_count; index++) {
-    std::string data = (boost::format(formats[index]) % column_names[index]).str();
+    std::string data = (boost::format(_formats[index]) % _column_labels[index]).str();
     _output_handler->print(_output_handler->user_data, data.c_str());
 
     // Once the header is printed, updates the numeric fields formats
     // so they are right aligned
     if (numerics[index])
-    formats[index] = formats[index].replace(1, 1, "");
+    _formats[index] = _formats[index].replace(1, 1, "");
   }
   _output_handler->print(_output_handler->user_data, "\n");
-  _output_handler->print(_output_handler->user_data, separator.c_str());
-
-  // Now prints the records
-  for (row_index = 0; row_index < records->size(); row_index++) {
-    _output_handler->print(_output_handler->user_data, "| ");
+  _output_handler->print(_output_handler->user_data, _separator.c_str());
+}
 
-    std::shared_ptr<mysqlsh::Row> row = (*records)[row_index].as_object<mysqlsh::Row>();
+void ResultsetDumper::dump_table(std::shared_ptr<mysqlsh::Row> row) {
+  _output_handler->print(_output_handler->user_data, "| ");
+
+  for (size_t field_index = 0; field_index < _formats.size(); field_index++) {
+    std::string raw_value = row->get_member(field_index).descr();
+
+    // The records streamed after the sample keep the column widths it gave,
+    // so wider values are cut and end with "..."
+    size_t width = _column_widths[field_index];
+    if (raw_value.length() > width) {
+      size_t length = width >= 3 ? width - 3 : width;
+      // Not in the middle of a UTF-8 character
+      while (length > 0 && (raw_value[length] & 0xC0) == 0x80)
+        length--;
+      raw_value = raw_value.substr(0, length) + std::string(width >= 3 ? "..." : "");
+    }
 
-    for (size_t field_index = 0; field_index < field_count; field_index++) {
-      std::string raw_value = row->get_member(field_index).descr();
-      std::string data = (boost::format(formats[field_index]) % (raw_value)).str();
+    std::string data = (boost::format(_formats[field_index]) % (raw_value)).str();
 
-      _output_handler->print(_output_handler->user_data, data.c_str());
-    }
-    _output_handler->print(_output_handler->user_data, "\n");
+    _output_handler->print(_output_handler->user_data, data.c_str());
   }
-
-  _output_handler->print(_output_handler->user_data, separator.c_str());
+  _output_handler->print(_output_handler->user_data, "\n");
 }
 
 std::string ResultsetDumper::get_affected_stats(const std::string& member, const std::string &legend) {
@@ -377,19 +412,43 @@ int ResultsetDumper::get_warning_and_execution_time_stats(std::string& output_st
 }
 
 void ResultsetDumper::dump_records(std::string& output_stats) {
-  shcore::Value records = _resultset->call("fetchAll", shcore::Argument_list());
-  shcore::Value::Array_type_ref array_records = records.as_array();
+  shcore::Value::Array_type_ref array_records;
+  bool pending_records = false;
+
+  if (_stream_data) {
+    // Only a sample of the records is read to define the output layout, the
+    // rest are printed as they are read so memory usage is bounded
+    array_records.reset(new shcore::Value::Array_type());
+
+    shcore::Value record;
+    while (array_records->size() < STREAM_SAMPLE_SIZE &&
+           (record = _resultset->call("fetchOne", shcore::Argument_list())))
+      array_records->push_back(record);
+
+    pending_records = array_records->size() == STREAM_SAMPLE_SIZE;
+  } else {
+    array_records = _resultset->call("fetchAll", shcore::Argument_list()).as_array();
+  }
 
   if (array_records->size()) {
     // print rows from result, with stats etc
-    if (_format == "vertical")
-      dump_vertical(array_records);
-    else if (_interactive || _format == "table")
-      dump_table(array_records);
-    else
-      dump_tabbed(array_records);
+    start_records(array_records, pending_records);
+
+    size_t row_count = 0;
+    for (; row_count < array_records->size(); row_count++)
+      dump_record((*array_records)[row_count].as_object<mysqlsh::Row>(), row_count);
+
+    if (pending_records) {
+      // The sample is no longer needed
+      array_records->clear();
+
+      shcore::Value record;
+      while ((record = _resultset->call("fetchOne", shcore::Argument_list())))
+        dump_record(record.as_object<mysqlsh::Row>(), row_count++);
+    }
+
+    end_records();
 
-    int row_count = int(array_records->size());
     output_stats = (boost::format("%lld %s in set") % row_count % (row_count == 1 ? "row" : "rows")).str();
   } else
     output_stats = "Empty set";
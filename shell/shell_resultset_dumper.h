@@ -50,6 +50,14 @@ protected:
   bool _show_warnings;
   bool _interactive;
   bool _buffer_data;
+  bool _stream_data;
+
+  // Layout of the records being printed
+  std::vector<std::string> _column_labels;
+  std::vector<std::string> _formats;
+  std::vector<size_t> _column_widths;
+  std::string _separator;
+  size_t _max_label_length;
 
   void dump_json();
   void dump_normal();
@@ -62,9 +70,15 @@ protected:
   std::string get_affected_stats(const std::string& member, const std::string &legend);
   int get_warning_and_execution_time_stats(std::string& output_stats);
   void dump_records(std::string& output_stats);
-  void dump_tabbed(shcore::Value::Array_type_ref records);
-  void dump_table(shcore::Value::Array_type_ref records);
-  void dump_vertical(shcore::Value::Array_type_ref records);
+  void start_records(shcore::Value::Array_type_ref records, bool sample);
+  void dump_record(std::shared_ptr<mysqlsh::Row> row, size_t row_index);
+  void end_records();
+  void start_tabbed();
+  void dump_tabbed(std::shared_ptr<mysqlsh::Row> row);
+  void start_table(shcore::Value::Array_type_ref records, bool sample);
+  void dump_table(std::shared_ptr<mysqlsh::Row> row);
+  void start_vertical();
+  void dump_vertical(std::shared_ptr<mysqlsh::Row> row, size_t row_index);
   void dump_warnings(bool classic = false);
 };
 #endif
@@ -34,7 +34,7 @@
 
 #include <fstream>
 #include <cerrno>
-#include <boost/format.hpp>
+#include <cmath>
 #include <boost/system/error_code.hpp>
 
 #include <iostream>
@@ -84,40 +84,24 @@ JScript_type_bridger::~JScript_type_bridger() {
   dispose();
 }
 
-double JScript_type_bridger::call_num_method(v8::Handle<v8::Object> object, const char *method) {
-  v8::Handle<v8::Function> func = v8::Handle<v8::Function>::Cast(object->Get(v8::String::NewFromUtf8(owner->isolate(), method)));
-  v8::Handle<v8::Value> result = func->Call(object, 0, NULL);
-  return result->ToNumber()->Value();
-}
-
 v8::Handle<v8::Value> JScript_type_bridger::native_object_to_js(Object_bridge_ref object) {
   if (object && object->class_name() == "Date") {
     std::shared_ptr<Date> date = std::static_pointer_cast<Date>(object);
-    // The only Date constructor exposed to C++ takes milliseconds, the constructor that parses a date from an string is implemented
-    // in Javascript, so it is invoked this way.
-    v8::Handle<v8::String> source = v8::String::NewFromUtf8(owner->isolate(), (boost::format("new Date('%d-%d-%d %d:%d:%d')") %
-      date->get_year() % date->get_month() % date->get_day() % date->get_hour() % date->get_min() % (int)date->get_sec()).str().c_str());
-    v8::Handle<v8::Script> script = v8::Script::Compile(source);
-    v8::Handle<v8::Value> result = script->Run();
-    return result;
+    // Both sides interpret the date on local time, so the milliseconds since
+    // epoch are enough and no script needs to be compiled for every value
+    return v8::Date::New(owner->isolate(), static_cast<double>(date->as_ms()));
   }
 
   return object->is_indexed() ? indexed_object_wrapper->wrap(object) : object_wrapper->wrap(object);
 }
 
 Object_bridge_ref JScript_type_bridger::js_object_to_native(v8::Handle<v8::Object> object) {
-  std::string ctorname = *v8::String::Utf8Value(object->GetConstructorName());
+  if (object->IsDate()) {
+    double ms = v8::Handle<v8::Date>::Cast(object)->ValueOf();
 
-  if (ctorname == "Date") {
-    int year, month, day, hour, min;
-    float sec;
-    year = (int)call_num_method(object, "getFullYear");
-    month = (int)call_num_method(object, "getMonth");
-    day = (int)call_num_method(object, "getDate");
-    hour = (int)call_num_method(object, "getHours");
-    min = (int)call_num_method(object, "getMinutes");
-    sec = (float)call_num_method(object, "getSeconds");
-    return Object_bridge_ref(new Date(year, month, day, hour, min, sec));
+    // Invalid dates have no time value
+    if (!std::isnan(ms))
+      return Date::from_ms(static_cast<int64_t>(ms));
   }
 
   return Object_bridge_ref();
@@ -203,7 +187,7 @@ v8::Handle<v8::Value> JScript_type_bridger::shcore_value_to_v8_value(const Value
       r = v8::Boolean::New(owner->isolate(), value.value.b);
       break;
     case String:
-      r = v8::String::NewFromUtf8(owner->isolate(), value.value.s->c_str());
+      r = v8::String::NewFromUtf8(owner->isolate(), value.value.s.c_str());
       break;
     case Integer:
       r = v8::Integer::New(owner->isolate(), value.value.i);
@@ -215,26 +199,26 @@ v8::Handle<v8::Value> JScript_type_bridger::shcore_value_to_v8_value(const Value
       r = v8::Number::New(owner->isolate(), value.value.d);
       break;
     case Object:
-      r = native_object_to_js(*value.value.o);
+      r = native_object_to_js(value.value.o);
       break;
     case Array:
       // maybe convert fully
-      r = array_wrapper->wrap(*value.value.array);
+      r = array_wrapper->wrap(value.value.array);
       break;
     case Map:
       // maybe convert fully
-      r = map_wrapper->wrap(*value.value.map);
+      r = map_wrapper->wrap(value.value.map);
       break;
     case MapRef:
     {
-      std::shared_ptr<Value::Map_type> map(value.value.mapref->lock());
+      std::shared_ptr<Value::Map_type> map(value.value.mapref.lock());
       if (map) {
         throw std::invalid_argument("Cannot convert internal value to JS: wrapmapref not implemented\n");
       }
     }
     break;
     case shcore::Function:
-      r = function_wrapper->wrap(*value.value.func);
+      r = function_wrapper->wrap(value.value.func);
       break;
   }
   return r;
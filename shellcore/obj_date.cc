@@ -22,6 +22,8 @@
 
 #include <boost/format.hpp>
 #include <cstdio>
+#include <cstring>
+#include <ctime>
 
 using namespace shcore;
 
@@ -99,43 +101,126 @@ Object_bridge_ref Date::create(const shcore::Argument_list &args) {
 }
 
 Object_bridge_ref Date::unrepr(const std::string &s) {
-  int year = 0;
-  int month = 0;
-  int day = 0;
-  int hour = 0;
-  int min = 0;
-  float sec = 0.0;
+  return unrepr(s.data(), s.size());
+}
+
+// Parses YYYY-MM-DD HH:MM:SS[.ffffff], any non digit character separates the
+// fields and the missing ones are 0. Every DATETIME value on a classic result
+// goes through here, so it is done by hand rather than with sscanf
+Object_bridge_ref Date::unrepr(const char *data, size_t length) {
+  int fields[6] = {0, 0, 0, 0, 0, 0};
+  float fraction = 0.0;
+  const char *end = data + length;
+
+  for (int field = 0; field < 6 && data < end; field++) {
+    for (; data < end && *data >= '0' && *data <= '9'; data++)
+      fields[field] = fields[field] * 10 + (*data - '0');
+
+    if (field == 5 && data < end && *data == '.') {
+      float scale = 0.1f;
+      for (data++; data < end && *data >= '0' && *data <= '9'; data++, scale /= 10)
+        fraction += (*data - '0') * scale;
+    } else if (data < end) {
+      data++;
+    }
+  }
+
+  return Object_bridge_ref(new Date(fields[0], fields[1] - 1, fields[2], fields[3], fields[4], fields[5] + fraction));
+}
+
+// Days since 1970-01-01 of a date of the proleptic Gregorian calendar, month
+// from 1 to 12, valid for any year unlike mktime
+static int64_t days_from_civil(int64_t year, int month, int day) {
+  year -= month <= 2;
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t year_of_era = year - era * 400;
+  int64_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+// The reverse of days_from_civil, month from 1 to 12
+static void civil_from_days(int64_t days, int *year, int *month, int *day) {
+  days += 719468;
+  int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  int64_t day_of_era = days - era * 146097;
+  int64_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+  int64_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  int64_t shifted_month = (5 * day_of_year + 2) / 153;
+  *day = static_cast<int>(day_of_year - (153 * shifted_month + 2) / 5 + 1);
+  *month = static_cast<int>(shifted_month < 10 ? shifted_month + 3 : shifted_month - 9);
+  *year = static_cast<int>(year_of_era + era * 400 + (*month <= 2));
+}
+
+static bool to_local_time(time_t seconds_since_epoch, struct tm *t) {
+#if WIN32
+  return localtime_s(t, &seconds_since_epoch) == 0;
+#else
+  return localtime_r(&seconds_since_epoch, t) != NULL;
+#endif
+}
+
+// Seconds local time is ahead of UTC, as of the epoch. Used for the dates the
+// C library can not handle, which are before it
+static int64_t utc_offset() {
+  struct tm t;
+  if (!to_local_time(86400, &t))
+    return 0;
 
-  sscanf(s.c_str(), "%i-%i-%i %i:%i:%f", &year, &month, &day, &hour, &min, &sec);
-  return Object_bridge_ref(new Date(year, month - 1, day, hour, min, sec));
+  return days_from_civil(t.tm_year + 1900, t.tm_mon + 1, t.tm_mday) * 86400 +
+         t.tm_hour * 3600 + t.tm_min * 60 + t.tm_sec - 86400;
 }
 
 int64_t Date::as_ms() const {
   struct tm t;
-  // caution, this obviously doesnt work for dates before 1970 yr
+  memset(&t, 0, sizeof(t));
   t.tm_year = _year - 1900;
   t.tm_mon = _month;
   t.tm_mday = _day;
   t.tm_hour = _hour;
   t.tm_min = _min;
   t.tm_sec = (int)_sec;
+  // Local time, letting mktime figure out whether DST applies
+  t.tm_isdst = -1;
+
+  int64_t ms = (int64_t)((_sec - (int)_sec) * 1000.0f + 0.5f);
+
+  // mktime fails for dates before 1970 on some platforms, Windows among them,
+  // those are computed from the calendar instead. -1 is also the second before
+  // the epoch, which the calendar gives as well
+  time_t seconds_since_epoch = mktime(&t);
+  if (seconds_since_epoch == (time_t)-1) {
+    int64_t local_seconds = days_from_civil(_year, _month + 1, _day) * 86400 + _hour * 3600 + _min * 60 + (int)_sec;
+    return (local_seconds - utc_offset()) * 1000 + ms;
+  }
 
-  int64_t seconds_since_epoch = mktime(&t);
-
-  return seconds_since_epoch * 1000 + (int)(_sec * 1000.0) % 1000;
+  return (int64_t)seconds_since_epoch * 1000 + ms;
 }
 
 Object_bridge_ref Date::from_ms(int64_t ms_since_epoch) {
   int ms = ms_since_epoch % 1000;
-  time_t seconds_since_epoch = ms_since_epoch / 1000;
+  int64_t seconds_since_epoch = ms_since_epoch / 1000;
+
+  // Dates before the epoch
+  if (ms < 0) {
+    ms += 1000;
+    seconds_since_epoch--;
+  }
 
   struct tm t;
-#if WIN32
-  localtime_s(&t, &seconds_since_epoch);
-#else
-  localtime_r(&seconds_since_epoch, &t);
-#endif
+  if (!to_local_time(static_cast<time_t>(seconds_since_epoch), &t)) {
+    // As in as_ms(), for the dates the C library can not handle
+    int64_t local_seconds = seconds_since_epoch + utc_offset();
+    int64_t days = (local_seconds >= 0 ? local_seconds : local_seconds - 86399) / 86400;
+    int64_t second_of_day = local_seconds - days * 86400;
+
+    int year, month, day;
+    civil_from_days(days, &year, &month, &day);
+    return Object_bridge_ref(new Date(year, month - 1, day, static_cast<int>(second_of_day / 3600),
+                                      static_cast<int>(second_of_day / 60 % 60),
+                                      static_cast<int>(second_of_day % 60) + (float)ms / 1000.0f));
+  }
 
   return Object_bridge_ref(new Date(t.tm_year + 1900, t.tm_mon, t.tm_mday,
-                                    t.tm_hour, t.tm_min, t.tm_sec + (float)ms / 1000.0));
+                                    t.tm_hour, t.tm_min, t.tm_sec + (float)ms / 1000.0f));
 }
@@ -44,7 +44,7 @@ void Object_registry::add_to_reg_list(const std::string &list_name, const std::s
   else if (liter->second.type != Array)
     throw std::invalid_argument("Registry " + list_name + " is not a list");
 
-  (*liter->second.value.array)->push_back(Value(object));
+  liter->second.value.array->push_back(Value(object));
 }
 
 void Object_registry::add_to_reg_list(const std::string &list_name, const Value &value) {
@@ -55,7 +55,7 @@ void Object_registry::add_to_reg_list(const std::string &list_name, const Value
   else if (liter->second.type != Array)
     throw std::invalid_argument("Registry " + list_name + " is not a list");
 
-  (*liter->second.value.array)->push_back(value);
+  liter->second.value.array->push_back(value);
 }
 
 void Object_registry::remove_from_reg_list(const std::string &list_name, const std::shared_ptr<Object_bridge> &object) {
@@ -64,9 +64,9 @@ void Object_registry::remove_from_reg_list(const std::string &list_name, const s
     throw std::invalid_argument("Registry " + list_name + " is not a list");
 
   Value &list(liter->second);
-  Value::Array_type::iterator iter = std::find((*list.value.array)->begin(), (*list.value.array)->end(), Value(object));
-  if (iter != (*list.value.array)->end())
-    (*list.value.array)->erase(iter);
+  Value::Array_type::iterator iter = std::find(list.value.array->begin(), list.value.array->end(), Value(object));
+  if (iter != list.value.array->end())
+    list.value.array->erase(iter);
 }
 
 void Object_registry::remove_from_reg_list(const std::string &list_name, Value::Array_type::iterator iterator) {
@@ -74,7 +74,7 @@ void Object_registry::remove_from_reg_list(const std::string &list_name, Value::
   if (liter != _registry->end() || liter->second.type != Array)
     throw std::invalid_argument("Registry " + list_name + " is not a list");
 
-  (*liter->second.value.array)->erase(iterator);
+  liter->second.value.array->erase(iterator);
 }
 
 std::shared_ptr<Value::Array_type> &Object_registry::get_reg_list(const std::string &list_name) {
@@ -82,5 +82,5 @@ std::shared_ptr<Value::Array_type> &Object_registry::get_reg_list(const std::str
   if (liter != _registry->end() || liter->second.type != Array)
     throw std::invalid_argument("Registry " + list_name + " is not a list");
 
-  return *liter->second.value.array;
+  return liter->second.value.array;
 }
@@ -161,7 +161,7 @@ PyObject *Python_type_bridger::shcore_value_to_pyobj(const Value &value) {
       r = PyBool_FromLong(value.value.b);
       break;
     case String:
-      r = PyString_FromString(value.value.s->c_str());
+      r = PyString_FromString(value.value.s.c_str());
       break;
     case Integer:
       r = PyInt_FromSsize_t(value.value.i);
@@ -173,18 +173,18 @@ PyObject *Python_type_bridger::shcore_value_to_pyobj(const Value &value) {
       r = PyFloat_FromDouble(value.value.d);
       break;
     case Object:
-      r = wrap(*value.value.o);
+      r = wrap(value.value.o);
       break;
     case Array:
-      r = wrap(*value.value.array);
+      r = wrap(value.value.array);
       break;
     case Map:
-      r = wrap(*value.value.map);
+      r = wrap(value.value.map);
       break;
     case MapRef:
       /*
       {
-      std::shared_ptr<Value::Map_type> map(value.value.mapref->lock());
+      std::shared_ptr<Value::Map_type> map(value.value.mapref.lock());
       if (map)
       {
       std::cout << "wrapmapref not implemented\n";
@@ -194,7 +194,7 @@ PyObject *Python_type_bridger::shcore_value_to_pyobj(const Value &value) {
       r = Py_None;
       break;
     case shcore::Function:
-      r = wrap(*value.value.func);
+      r = wrap(value.value.func);
       break;
   }
   return r;
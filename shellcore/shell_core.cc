@@ -268,6 +268,8 @@ int Shell_core::process_stream(std::istream& stream, const std::string& source,
       std::string delimiter = ";";
       handle_input(delimiter, state, result_processor);
     }
+
+    _langs[_mode]->finish_input(result_processor);
   } else {
     std::string data;
     if (&std::cin == &stream) {
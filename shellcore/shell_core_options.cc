@@ -72,9 +72,14 @@ void Shell_core_options::set_member(const std::string &prop, Value value) {
     } else if (prop == SHCORE_INTERACTIVE || prop == SHCORE_BATCH_CONTINUE_ON_ERROR)
       throw shcore::Exception::value_error((boost::format("The option %s is read only.") % prop).str());
 
-    else if (prop == SHCORE_SHOW_WARNINGS && value.type != shcore::Bool)
+    else if ((prop == SHCORE_SHOW_WARNINGS || prop == SHCORE_OUTPUT_STREAMING ||
+              prop == SHCORE_PROVISIONING_WORKER) && value.type != shcore::Bool)
         throw shcore::Exception::value_error((boost::format("The option %s requires a boolean value.") % prop).str());
 
+    else if ((prop == SHCORE_BATCH_PIPELINE_SIZE || prop == SHCORE_METADATA_CACHE_TTL) &&
+             (value.type != shcore::Integer || value.as_int() < 0))
+        throw shcore::Exception::value_error((boost::format("The option %s requires a non negative integer value.") % prop).str());
+
     (*_options)[prop] = value;
   } else
     throw shcore::Exception::attrib_error("Unable to set the property " + prop + " on the shell object.");
@@ -89,8 +94,12 @@ _options(new shcore::Value::Map_type) {
   (*_options)[SHCORE_INTERACTIVE] = Value::True();
   (*_options)[SHCORE_SHOW_WARNINGS] = Value::True();
   (*_options)[SHCORE_BATCH_CONTINUE_ON_ERROR] = Value::False();
+  (*_options)[SHCORE_BATCH_PIPELINE_SIZE] = Value(0);
   (*_options)[SHCORE_MULTIPLE_INSTANCES] = Value::False();
   (*_options)[SHCORE_USE_WIZARDS] = Value::True();
+  (*_options)[SHCORE_OUTPUT_STREAMING] = Value::False();
+  (*_options)[SHCORE_METADATA_CACHE_TTL] = Value(0);
+  (*_options)[SHCORE_PROVISIONING_WORKER] = Value::False();
 
   std::string home = shcore::get_home_dir();
 
@@ -112,14 +121,22 @@ void Shell_core_options::init() {
   add_property(option + "|" + option);
   option.assign(SHCORE_BATCH_CONTINUE_ON_ERROR);
   add_property(option + "|" + option);
+  option.assign(SHCORE_BATCH_PIPELINE_SIZE);
+  add_property(option + "|" + option);
   option.assign(SHCORE_MULTIPLE_INSTANCES);
   add_property(option + "|" + option);
   option.assign(SHCORE_USE_WIZARDS);
   add_property(option + "|" + option);
+  option.assign(SHCORE_OUTPUT_STREAMING);
+  add_property(option + "|" + option);
   option.assign(SHCORE_GADGETS_PATH);
   add_property(option + "|" + option);
   option.assign(SHCORE_SANDBOX_DIR);
   add_property(option + "|" + option);
+  option.assign(SHCORE_METADATA_CACHE_TTL);
+  add_property(option + "|" + option);
+  option.assign(SHCORE_PROVISIONING_WORKER);
+  add_property(option + "|" + option);
 }
 
 Shell_core_options::~Shell_core_options() {
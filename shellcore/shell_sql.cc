@@ -24,12 +24,19 @@
 #include <boost/format.hpp>
 #include <boost/algorithm/string.hpp>
 #include <fstream>
+#include <set>
 
 using namespace shcore;
 using namespace boost::system;
 
+// Bytes of statements sent on the pipeline whose results were not processed.
+// Kept below the socket buffers so the shell never blocks sending while the
+// server blocks sending results nobody reads
+static const size_t k_max_pipelined_bytes = 16 * 1024;
+
 Shell_sql::Shell_sql(IShell_core *owner)
-  : Shell_language(owner), _delimiters({";", "\\G", "\\g"})
+  : Shell_language(owner), _delimiters({";", "\\G", "\\g"}),
+  _pipelined_count(0), _pipelined_bytes(0), _pipeline_failed(false)
 {
   static const std::string cmd_help_G =
       "SYNTAX:\n"
@@ -56,6 +63,40 @@ Value Shell_sql::process_sql(const std::string &query_str,
     std::function<void(shcore::Value)> result_processor) {
   Value ret_val;
   try {
+    // In batch mode over an X session the statements are sent without waiting
+    // for the previous results, which are processed as they arrive
+    std::shared_ptr<mysqlsh::mysqlx::BaseSession> x_session;
+    size_t max_pending = pipeline_size();
+    if (max_pending)
+      x_session = std::dynamic_pointer_cast<mysqlsh::mysqlx::BaseSession>(session);
+
+    if (x_session) {
+      bool continue_on_error = (*Shell_core_options::get())[SHCORE_BATCH_CONTINUE_ON_ERROR].as_bool();
+
+      // On a failure the server skips the rest of the pipeline, so does the shell
+      if (!_pipeline_failed || continue_on_error) {
+        // Makes room on the pipeline before sending, a statement larger than
+        // the byte window is sent once the pipeline is empty
+        while (!_pipeline.empty() && (_pipeline.size() >= max_pending ||
+               _pipelined_bytes + query_str.size() > k_max_pipelined_bytes))
+          process_pipelined(result_processor);
+
+        Pipelined_statement pending;
+        pending.statement = query_str;
+        pending.delimiter = delimiter;
+        pending.session = x_session;
+        pending.result = x_session->send_sql(query_str, !continue_on_error);
+        pending.index = ++_pipelined_count;
+        _pipeline.push_back(pending);
+        _pipelined_bytes += query_str.size();
+      }
+
+      // Errors are reported when the results are processed
+      ret_val = Value::Null();
+      _last_handled += query_str + delimiter;
+      return ret_val;
+    }
+
     shcore::Argument_list query;
     query.push_back(Value(query_str));
 
@@ -73,15 +114,7 @@ Value Shell_sql::process_sql(const std::string &query_str,
           session->class_name() + ") can't be used for SQL execution.");
 
     // If reached this point, processes the returned result object
-    if (!_killed) {
-      auto shcore_options = Shell_core_options::get();
-      auto old_format = (*shcore_options)[SHCORE_OUTPUT_FORMAT];
-      if (delimiter == "\\G")
-        (*shcore_options)[SHCORE_OUTPUT_FORMAT] = Value("vertical");
-      result_processor(ret_val);
-      (*shcore_options)[SHCORE_OUTPUT_FORMAT] = old_format;
-    }
-    _killed = false;
+    print_result(ret_val, delimiter, result_processor);
   } catch (shcore::Exception &exc) {
     print_exception(exc);
   }
@@ -91,6 +124,80 @@ Value Shell_sql::process_sql(const std::string &query_str,
   return ret_val;
 }
 
+void Shell_sql::print_result(Value result,
+    mysql::splitter::Delimiters::delim_type_t delimiter,
+    std::function<void(shcore::Value)> result_processor) {
+  if (!_killed) {
+    auto shcore_options = Shell_core_options::get();
+    auto old_format = (*shcore_options)[SHCORE_OUTPUT_FORMAT];
+    if (delimiter == "\\G")
+      (*shcore_options)[SHCORE_OUTPUT_FORMAT] = Value("vertical");
+    result_processor(result);
+    (*shcore_options)[SHCORE_OUTPUT_FORMAT] = old_format;
+  }
+  _killed = false;
+}
+
+// Pipelining is only used in batch mode, interactively every statement is
+// printed before the next one is typed anyway
+size_t Shell_sql::pipeline_size() const {
+  auto shcore_options = Shell_core_options::get();
+  if ((*shcore_options)[SHCORE_INTERACTIVE].as_bool())
+    return 0;
+
+  return static_cast<size_t>((*shcore_options)[SHCORE_BATCH_PIPELINE_SIZE].as_int());
+}
+
+// Processes the result of the oldest statement on the pipeline
+void Shell_sql::process_pipelined(std::function<void(shcore::Value)> result_processor) {
+  Pipelined_statement pending(_pipeline.front());
+  _pipeline.pop_front();
+  _pipelined_bytes -= pending.statement.size();
+
+  // The statements after a failure were rejected by the server
+  if (_pipeline_failed && !(*Shell_core_options::get())[SHCORE_BATCH_CONTINUE_ON_ERROR].as_bool())
+    return;
+
+  try {
+    print_result(pending.session->get_sql_result(pending.result), pending.delimiter, result_processor);
+  } catch (shcore::Exception &exc) {
+    // The statement was sent a while ago, so the error identifies it
+    std::string statement = pending.statement;
+    if (statement.size() > 80)
+      statement = statement.substr(0, 77) + "...";
+
+    auto error = exc.error();
+    (*error)["message"] = Value((boost::format("%s (statement #%u: %s)") %
+                                 exc.what() % pending.index % statement).str());
+    print_exception(shcore::Exception(error));
+
+    _pipeline_failed = true;
+    result_processor(Value());
+  }
+}
+
+void Shell_sql::finish_input(std::function<void(shcore::Value)> result_processor) {
+  std::set<std::shared_ptr<mysqlsh::mysqlx::BaseSession> > sessions;
+
+  while (!_pipeline.empty()) {
+    sessions.insert(_pipeline.front().session);
+    process_pipelined(result_processor);
+  }
+
+  // Closes the error expectation and reads the results nobody waited for
+  for (auto session : sessions) {
+    try {
+      session->read_pending_results();
+    } catch (shcore::Exception &exc) {
+      print_exception(exc);
+    }
+  }
+
+  _pipelined_count = 0;
+  _pipelined_bytes = 0;
+  _pipeline_failed = false;
+}
+
 void Shell_sql::handle_input(std::string &code, Input_state &state, std::function<void(shcore::Value)> result_processor) {
   Value ret_val;
   state = Input_state::Ok;
@@ -30,6 +30,8 @@
 #include <cstring>
 #include <sstream>
 #include <rapidjson/prettywriter.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/memorystream.h>
 #include <limits>
 
 // These is* functions have undefined behavior if the passed value
@@ -140,14 +142,14 @@ Exception Exception::parser_error(const std::string &message) {
 const char *Exception::what() const BOOST_NOEXCEPT_OR_NOTHROW
 {
   if ((*_error)["message"].type == String)
-  return (*_error)["message"].value.s->c_str();
+  return (*_error)["message"].value.s.c_str();
   return "?";
 }
 
 const char *Exception::type() const BOOST_NOEXCEPT_OR_NOTHROW
 {
   if ((*_error)["type"].type == String)
-  return (*_error)["type"].value.s->c_str();
+  return (*_error)["type"].value.s.c_str();
   return "Exception";
 }
 
@@ -334,19 +336,29 @@ void Value::Map_type::merge_contents(std::shared_ptr<Map_type> source, bool over
 }
 
 Value::Value(const Value &copy)
-  : type(shcore::Null) {
-  operator=(copy);
+  : type(Undefined) {
+  copy_from(copy);
+}
+
+Value::Value(Value &&other)
+  : type(Undefined) {
+  move_from(other);
 }
 
 Value::Value(const std::string &s)
   : type(String) {
-  value.s = new std::string(s);
+  new (&value.s) std::string(s);
+}
+
+Value::Value(std::string &&s)
+  : type(String) {
+  new (&value.s) std::string(std::move(s));
 }
 
 Value::Value(const char *s) {
   if (s) {
     type = String;
-    value.s = new std::string(s);
+    new (&value.s) std::string(s);
   } else {
     type = shcore::Null;
   }
@@ -355,7 +367,7 @@ Value::Value(const char *s) {
 Value::Value(const char *s, size_t n) {
   if (s) {
     type = String;
-    value.s = new std::string(s, n);
+    new (&value.s) std::string(s, n);
   } else {
     type = shcore::Null;
   }
@@ -388,30 +400,144 @@ Value::Value(bool b)
 
 Value::Value(std::shared_ptr<Function_base> f)
   : type(Function) {
-  value.func = new std::shared_ptr<Function_base>(f);
+  new (&value.func) std::shared_ptr<Function_base>(std::move(f));
 }
 
 Value::Value(std::shared_ptr<Object_bridge> n)
   : type(Object) {
-  value.o = new std::shared_ptr<Object_bridge>(n);
+  new (&value.o) std::shared_ptr<Object_bridge>(std::move(n));
 }
 
 Value::Value(Map_type_ref n)
   : type(Map) {
-  value.map = new std::shared_ptr<Map_type>(n);
+  new (&value.map) std::shared_ptr<Map_type>(std::move(n));
 }
 
 Value::Value(std::weak_ptr<Map_type> n)
   : type(MapRef) {
-  value.mapref = new std::weak_ptr<Map_type>(n);
+  new (&value.mapref) std::weak_ptr<Map_type>(std::move(n));
 }
 
 Value::Value(Array_type_ref n)
   : type(Array) {
-  value.array = new std::shared_ptr<Array_type>(n);
+  new (&value.array) std::shared_ptr<Array_type>(std::move(n));
+}
+
+void Value::copy_from(const Value &other) {
+  switch (other.type) {
+    case Undefined:
+    case shcore::Null:
+      break;
+    case Bool:
+      value.b = other.value.b;
+      break;
+    case Integer:
+      value.i = other.value.i;
+      break;
+    case UInteger:
+      value.ui = other.value.ui;
+      break;
+    case Float:
+      value.d = other.value.d;
+      break;
+    case String:
+      new (&value.s) std::string(other.value.s);
+      break;
+    case Object:
+      new (&value.o) std::shared_ptr<Object_bridge>(other.value.o);
+      break;
+    case Array:
+      new (&value.array) std::shared_ptr<Array_type>(other.value.array);
+      break;
+    case Map:
+      new (&value.map) std::shared_ptr<Map_type>(other.value.map);
+      break;
+    case MapRef:
+      new (&value.mapref) std::weak_ptr<Map_type>(other.value.mapref);
+      break;
+    case Function:
+      new (&value.func) std::shared_ptr<Function_base>(other.value.func);
+      break;
+  }
+  type = other.type;
+}
+
+void Value::move_from(Value &other) {
+  switch (other.type) {
+    case Undefined:
+    case shcore::Null:
+      break;
+    case Bool:
+      value.b = other.value.b;
+      break;
+    case Integer:
+      value.i = other.value.i;
+      break;
+    case UInteger:
+      value.ui = other.value.ui;
+      break;
+    case Float:
+      value.d = other.value.d;
+      break;
+    case String:
+      new (&value.s) std::string(std::move(other.value.s));
+      break;
+    case Object:
+      new (&value.o) std::shared_ptr<Object_bridge>(std::move(other.value.o));
+      break;
+    case Array:
+      new (&value.array) std::shared_ptr<Array_type>(std::move(other.value.array));
+      break;
+    case Map:
+      new (&value.map) std::shared_ptr<Map_type>(std::move(other.value.map));
+      break;
+    case MapRef:
+      new (&value.mapref) std::weak_ptr<Map_type>(std::move(other.value.mapref));
+      break;
+    case Function:
+      new (&value.func) std::shared_ptr<Function_base>(std::move(other.value.func));
+      break;
+  }
+  type = other.type;
+
+  other.release();
+}
+
+void Value::release() {
+  switch (type) {
+    case Undefined:
+    case shcore::Null:
+    case Bool:
+    case Integer:
+    case UInteger:
+    case Float:
+      break;
+    case String:
+      value.s.~basic_string();
+      break;
+    case Object:
+      value.o.~shared_ptr();
+      break;
+    case Array:
+      value.array.~shared_ptr();
+      break;
+    case Map:
+      value.map.~shared_ptr();
+      break;
+    case MapRef:
+      value.mapref.~weak_ptr();
+      break;
+    case Function:
+      value.func.~shared_ptr();
+      break;
+  }
+  type = Undefined;
 }
 
 Value &Value::operator= (const Value &other) {
+  if (this == &other)
+    return *this;
+
   if (type == other.type) {
     switch (type) {
       case Undefined:
@@ -431,88 +557,39 @@ Value &Value::operator= (const Value &other) {
         value.d = other.value.d;
         break;
       case String:
-        *value.s = *other.value.s;
+        value.s = other.value.s;
         break;
       case Object:
-        *value.o = *other.value.o;
+        value.o = other.value.o;
         break;
       case Array:
-        *value.array = *other.value.array;
+        value.array = other.value.array;
         break;
       case Map:
-        *value.map = *other.value.map;
+        value.map = other.value.map;
         break;
       case MapRef:
-        *value.mapref = *other.value.mapref;
+        value.mapref = other.value.mapref;
         break;
       case Function:
-        *value.func = *other.value.func;
+        value.func = other.value.func;
         break;
     }
   } else {
-    switch (type) {
-      case Undefined:
-      case shcore::Null:
-      case Bool:
-      case Integer:
-      case UInteger:
-      case Float:
-        break;
-      case String:
-        delete value.s;
-        break;
-      case Object:
-        delete value.o;
-        break;
-      case Array:
-        delete value.array;
-        break;
-      case Map:
-        delete value.map;
-        break;
-      case MapRef:
-        delete value.mapref;
-        break;
-      case Function:
-        delete value.func;
-        break;
-    }
-    type = other.type;
-    switch (type) {
-      case Undefined:
-      case shcore::Null:
-        break;
-      case Bool:
-        value.b = other.value.b;
-        break;
-      case Integer:
-        value.i = other.value.i;
-        break;
-      case UInteger:
-        value.ui = other.value.ui;
-        break;
-      case Float:
-        value.d = other.value.d;
-        break;
-      case String:
-        value.s = new std::string(*other.value.s);
-        break;
-      case Object:
-        value.o = new std::shared_ptr<Object_bridge>(*other.value.o);
-        break;
-      case Array:
-        value.array = new std::shared_ptr<Array_type>(*other.value.array);
-        break;
-      case Map:
-        value.map = new std::shared_ptr<Map_type>(*other.value.map);
-        break;
-      case MapRef:
-        value.mapref = new std::weak_ptr<Map_type>(*other.value.mapref);
-        break;
-      case Function:
-        value.func = new std::shared_ptr<Function_base>(*other.value.func);
-        break;
-    }
+    // other may be owned by the value being replaced
+    Value copy(other);
+    release();
+    move_from(copy);
+  }
+  return *this;
+}
+
+Value &Value::operator= (Value &&other) {
+  if (this != &other) {
+    // other may be owned by the value being replaced
+    Value moved(std::move(other));
+    release();
+    move_from(moved);
   }
   return *this;
 }
@@ -762,11 +839,112 @@ bool my_strnicmp(const char *c1, const char *c2, size_t n) {
   return boost::iequals(boost::make_iterator_range(c1, c1 + n), boost::make_iterator_range(c2, c2 + n));
 }
 
+namespace {
+// Builds the Value straight from the rapidjson SAX events: containers are
+// added to their parent as soon as they are opened and filled in place, so
+// no intermediate DOM is created and values are never copied
+class Value_builder {
+public:
+  Value_builder() {
+    _open.reserve(16);
+  }
+
+  Value &root() { return _root; }
+
+  bool Null() { add(Value::Null()); return true; }
+  bool Bool(bool b) { add(Value(b)); return true; }
+  bool Int(int i) { add(Value(static_cast<int64_t>(i))); return true; }
+  bool Uint(unsigned u) { add(Value(static_cast<int64_t>(u))); return true; }
+  bool Int64(int64_t i) { add(Value(i)); return true; }
+  bool Uint64(uint64_t u) {
+    if (u > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+      add(Value(u));
+    else
+      add(Value(static_cast<int64_t>(u)));
+    return true;
+  }
+  bool Double(double d) { add(Value(d)); return true; }
+  bool String(const char *str, rapidjson::SizeType length, bool) {
+    add(Value(str, length));
+    return true;
+  }
+
+  bool StartObject() { open(Value::new_map()); return true; }
+  bool Key(const char *str, rapidjson::SizeType length, bool) {
+    _key.assign(str, length);
+    return true;
+  }
+  bool EndObject(rapidjson::SizeType) { _open.pop_back(); return true; }
+
+  bool StartArray() { open(Value::new_array()); return true; }
+  bool EndArray(rapidjson::SizeType) { _open.pop_back(); return true; }
+
+private:
+  Value _root;
+  std::string _key;
+  // The containers being filled, the innermost last. They are owned by their
+  // parent, which gets no other values until they are closed
+  std::vector<Value *> _open;
+
+  Value *add(Value &&value) {
+    if (_open.empty()) {
+      _root = std::move(value);
+      return &_root;
+    }
+
+    Value *parent = _open.back();
+    if (parent->type == Array) {
+      parent->value.array->push_back(std::move(value));
+      return &parent->value.array->back();
+    }
+
+    // As with the legacy parser, the last duplicate key wins
+    Value &slot = (*parent->value.map)[_key];
+    slot = std::move(value);
+    return &slot;
+  }
+
+  void open(Value &&container) {
+    _open.push_back(add(std::move(container)));
+  }
+};
+
+// Parses standard JSON, returns false if data is not valid JSON so the
+// caller can fall back to the legacy parser
+bool parse_json(const char *data, size_t length, Value *ret_val) {
+  rapidjson::MemoryStream stream(data, length);
+  rapidjson::Reader reader;
+  Value_builder builder;
+
+  reader.Parse<rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseFullPrecisionFlag>(stream, builder);
+  if (reader.HasParseError())
+    return false;
+
+  *ret_val = std::move(builder.root());
+  return true;
+}
+}
+
 Value Value::parse(const std::string &s) {
+  // Most of the input is plain JSON (documents coming from the server, files
+  // and repr() output), the legacy parser is only needed for the extensions
+  // it supports: single quotes, undefined, case insensitive constants...
+  Value ret_val;
+  if (parse_json(s.data(), s.size(), &ret_val))
+    return ret_val;
+
   char *pc = const_cast<char *>(s.c_str());
   return parse(&pc);
 }
 
+Value Value::parse(const char *data, size_t length) {
+  Value ret_val;
+  if (parse_json(data, length, &ret_val))
+    return ret_val;
+
+  return parse(std::string(data, length));
+}
+
 Value Value::parse(char **pc) {
   if (**pc == '{') {
     return parse_map(pc);
@@ -824,17 +1002,17 @@ bool Value::operator == (const Value &other) const {
       case Float:
         return value.d == other.value.d;
       case String:
-        return *value.s == *other.value.s;
+        return value.s == other.value.s;
       case Object:
-        return **value.o == **other.value.o;
+        return *value.o == *other.value.o;
       case Array:
-        return **value.array == **other.value.array;
+        return *value.array == *other.value.array;
       case Map:
-        return **value.map == **other.value.map;
+        return *value.map == *other.value.map;
       case MapRef:
-        return *value.mapref->lock() == *other.value.mapref->lock();
+        return *value.mapref.lock() == *other.value.mapref.lock();
       case Function:
-        return **value.func == **other.value.func;
+        return *value.func == *other.value.func;
     }
   } else {
     // with type conversion
@@ -960,20 +1138,20 @@ std::string &Value::append_descr(std::string &s_out, int indent, int quote_strin
     break;
     case String:
       if (quote_strings)
-        s_out += (char)quote_strings + *value.s + (char)quote_strings;
+        s_out += (char)quote_strings + value.s + (char)quote_strings;
       else
-        s_out += *value.s;
+        s_out += value.s;
       break;
     case Object:
-      if (!value.o || !*value.o)
+      if (!value.o)
         throw Exception::value_error("Invalid object value encountered");
       as_object()->append_descr(s_out, indent, quote_strings);
       break;
     case Array:
     {
-      if (!value.array || !*value.array)
+      if (!value.array)
         throw Exception::value_error("Invalid array value encountered");
-      Array_type *vec = value.array->get();
+      Array_type *vec = value.array.get();
       Array_type::iterator myend = vec->end(), mybegin = vec->begin();
       s_out += "[";
       for (Array_type::iterator iter = mybegin; iter != myend; ++iter) {
@@ -996,9 +1174,9 @@ std::string &Value::append_descr(std::string &s_out, int indent, int quote_strin
     break;
     case Map:
     {
-      if (!value.map || !*value.map)
+      if (!value.map)
         throw Exception::value_error("Invalid map value encountered");
-      Map_type *map = value.map->get();
+      Map_type *map = value.map.get();
       Map_type::iterator myend = map->end(), mybegin = map->begin();
       s_out += "{";
       
@@ -1073,7 +1251,7 @@ std::string &Value::append_repr(std::string &s_out) const {
     break;
     case String:
     {
-      std::string &s = *value.s;
+      const std::string &s = value.s;
       s_out += "\"";
       for (size_t i = 0; i < s.length(); i++) {
         char c = s[i];
@@ -1118,11 +1296,11 @@ std::string &Value::append_repr(std::string &s_out) const {
     }
     break;
     case Object:
-      s_out = (*value.o)->append_repr(s_out);
+      s_out = value.o->append_repr(s_out);
       break;
     case Array:
     {
-      Array_type *vec = value.array->get();
+      Array_type *vec = value.array.get();
       Array_type::iterator myend = vec->end(), mybegin = vec->begin();
       s_out += "[";
       for (Array_type::iterator iter = mybegin; iter != myend; ++iter) {
@@ -1135,7 +1313,7 @@ std::string &Value::append_repr(std::string &s_out) const {
     break;
     case Map:
     {
-      Map_type *map = value.map->get();
+      Map_type *map = value.map.get();
       Map_type::iterator myend = map->end(), mybegin = map->begin();
       s_out += "{";
       for (Map_type::iterator iter = mybegin; iter != myend; ++iter) {
@@ -1160,33 +1338,7 @@ std::string &Value::append_repr(std::string &s_out) const {
 }
 
 Value::~Value() {
-  switch (type) {
-    case Undefined:
-    case shcore::Null:
-    case Bool:
-    case Integer:
-    case UInteger:
-    case Float:
-      break;
-    case String:
-      delete value.s;
-      break;
-    case Object:
-      delete value.o;
-      break;
-    case Array:
-      delete value.array;
-      break;
-    case Map:
-      delete value.map;
-      break;
-    case MapRef:
-      delete value.mapref;
-      break;
-    case Function:
-      delete value.func;
-      break;
-  }
+  release();
 }
 
 void Value::check_type(Value_type t) const {
@@ -1245,7 +1397,7 @@ const std::string &Argument_list::string_at(unsigned int i) const {
     throw Exception::argument_error("Insufficient number of arguments");
   switch (at(i).type) {
     case String:
-      return *at(i).value.s;
+      return at(i).value.s;
     default:
       throw Exception::type_error((boost::format("Argument #%1% is expected to be a string") % (i + 1)).str());
   };
@@ -1315,7 +1467,7 @@ std::shared_ptr<Object_bridge> Argument_list::object_at(unsigned int i) const {
     throw Exception::argument_error("Insufficient number of arguments");
   if (at(i).type != Object)
     throw Exception::type_error((boost::format("Argument #%1% is expected to be an object") % (i + 1)).str());
-  return *at(i).value.o;
+  return at(i).value.o;
 }
 
 std::shared_ptr<Value::Map_type> Argument_list::map_at(unsigned int i) const {
@@ -1323,7 +1475,7 @@ std::shared_ptr<Value::Map_type> Argument_list::map_at(unsigned int i) const {
     throw Exception::argument_error("Insufficient number of arguments");
   if (at(i).type != Map)
     throw Exception::type_error((boost::format("Argument #%1% is expected to be a map") % (i + 1)).str());
-  return *at(i).value.map;
+  return at(i).value.map;
 }
 
 std::shared_ptr<Value::Array_type> Argument_list::array_at(unsigned int i) const {
@@ -1331,7 +1483,7 @@ std::shared_ptr<Value::Array_type> Argument_list::array_at(unsigned int i) const
     throw Exception::argument_error("Insufficient number of arguments");
   if (at(i).type != Array)
     throw Exception::type_error((boost::format("Argument #%1% is expected to be an array") % (i + 1)).str());
-  return *at(i).value.array;
+  return at(i).value.array;
 }
 
 void Argument_list::ensure_count(unsigned int c, const char *context) const {
@@ -1363,7 +1515,7 @@ const std::string &Argument_map::string_at(const std::string &key) const {
   const Value &v(at(key));
   switch (v.type) {
     case String:
-      return *v.value.s;
+      return v.value.s;
     default:
       throw Exception::type_error(std::string("Argument ").append(key).append(" is expected to be a string"));
   }
@@ -1431,21 +1583,21 @@ std::shared_ptr<Object_bridge> Argument_map::object_at(const std::string &key) c
   const Value &value(at(key));
   if (value.type != Object)
     throw Exception::type_error("Argument '"+key+"' is expected to be an object");
-  return *value.value.o;
+  return value.value.o;
 }
 
 std::shared_ptr<Value::Map_type> Argument_map::map_at(const std::string &key) const {
   const Value &value(at(key));
   if (value.type != Map)
     throw Exception::type_error("Argument '"+key+"' is expected to be a map");
-  return *value.value.map;
+  return value.value.map;
 }
 
 std::shared_ptr<Value::Array_type> Argument_map::array_at(const std::string &key) const {
   const Value &value(at(key));
   if (value.type != Array)
     throw Exception::type_error("Argument '"+key+"' is expected to be an array");
-  return *value.value.array;
+  return value.value.array;
 }
 
 void Argument_map::ensure_keys(const std::set<std::string> &mandatory_keys,
@@ -27,10 +27,117 @@
 using namespace std::placeholders;
 using namespace shcore;
 
-Cpp_object_bridge::Cpp_object_bridge() : naming_style(LowerCamelCase) {
+void Cpp_member_index::add_function(const std::string &base_name, const std::shared_ptr<Cpp_function> &function) {
+  Function_entry entry = {base_name, function};
+  _functions[LowerCamelCase].insert(std::make_pair(function->name(LowerCamelCase), entry));
+  _functions[LowerCaseUnderscores].insert(std::make_pair(function->name(LowerCaseUnderscores), entry));
+}
+
+void Cpp_member_index::remove_function(const Cpp_function &function) {
+  for (auto style : {LowerCamelCase, LowerCaseUnderscores}) {
+    auto entry = _functions[style].find(function.name(style));
+    if (entry != _functions[style].end() && entry->second.function.get() == &function)
+      _functions[style].erase(entry);
+  }
+}
+
+void Cpp_member_index::add_property(const std::shared_ptr<Cpp_property_name> &property) {
+  _properties[LowerCamelCase].insert(std::make_pair(property->name(LowerCamelCase), property));
+  _properties[LowerCaseUnderscores].insert(std::make_pair(property->name(LowerCaseUnderscores), property));
+}
+
+void Cpp_member_index::remove_property(const Cpp_property_name &property) {
+  for (auto style : {LowerCamelCase, LowerCaseUnderscores}) {
+    auto entry = _properties[style].find(property.name(style));
+    if (entry != _properties[style].end() && entry->second.get() == &property)
+      _properties[style].erase(entry);
+  }
+}
+
+const Cpp_member_index::Function_entry *Cpp_member_index::function(const std::string &name, NamingStyle style) const {
+  if (style != LowerCamelCase && style != LowerCaseUnderscores)
+    return nullptr;
+
+  auto entry = _functions[style].find(name);
+  return entry == _functions[style].end() ? nullptr : &entry->second;
+}
+
+const std::shared_ptr<Cpp_property_name> *Cpp_member_index::property(const std::string &name, NamingStyle style) const {
+  if (style != LowerCamelCase && style != LowerCaseUnderscores)
+    return nullptr;
+
+  auto entry = _properties[style].find(name);
+  return entry == _properties[style].end() ? nullptr : &entry->second;
+}
+
+Cpp_member_registry::Cpp_member_registry() {
+  add_varargs_method("help", method(&Cpp_object_bridge::help));
+}
+
+void Cpp_member_registry::add_method(const std::string &name, const Method &method,
+                                     const char *arg1_name, Value_type arg1_type, ...) {
+  std::vector<std::pair<std::string, Value_type> > signature;
+  va_list l;
+  if (arg1_name && arg1_type != Undefined) {
+    const char *n;
+    Value_type t;
+
+    va_start(l, arg1_type);
+    signature.push_back(std::make_pair(arg1_name, arg1_type));
+    do {
+      n = va_arg(l, const char*);
+      if (n) {
+        t = (Value_type)va_arg(l, int);
+        if (t != Undefined)
+          signature.push_back(std::make_pair(n, t));
+      }
+    } while (n && t != Undefined);
+    va_end(l);
+  }
+
+  std::string base_name = name.substr(0, name.find("|"));
+  Method_entry &entry = _methods[base_name];
+  if (entry.function)
+    _index.remove_function(*entry.function);
+  entry.function.reset(new Cpp_function(name, Cpp_function::Function(), signature));
+  entry.method = method;
+  _index.add_function(base_name, entry.function);
+}
+
+void Cpp_member_registry::add_varargs_method(const std::string &name, const Method &method) {
+  std::string base_name = name.substr(0, name.find("|"));
+  Method_entry &entry = _methods[base_name];
+  if (entry.function)
+    _index.remove_function(*entry.function);
+  entry.function.reset(new Cpp_function(name, Cpp_function::Function(), true));
+  entry.method = method;
+  _index.add_function(base_name, entry.function);
+}
+
+void Cpp_member_registry::add_constant(const std::string &name) {
+  _properties.push_back(std::shared_ptr<Cpp_property_name>(new Cpp_property_name(name, true)));
+  _index.add_property(_properties.back());
+}
+
+void Cpp_member_registry::add_property(const std::string &name, const std::string &getter) {
+  _properties.push_back(std::shared_ptr<Cpp_property_name>(new Cpp_property_name(name)));
+  _index.add_property(_properties.back());
+
+  if (!getter.empty()) {
+    add_method(getter, [getter, name](Cpp_object_bridge *object, const shcore::Argument_list &args) {
+      return object->get_member_method(args, getter, name);
+    }, NULL);
+  }
+}
+
+Cpp_object_bridge::Cpp_object_bridge() : naming_style(LowerCamelCase), _members(nullptr) {
   add_varargs_method("help", std::bind(&Cpp_object_bridge::help, this, _1));
 };
 
+Cpp_object_bridge::Cpp_object_bridge(const Cpp_member_registry &members)
+  : naming_style(LowerCamelCase), _members(&members) {
+}
+
 Cpp_object_bridge::~Cpp_object_bridge() {
   _funcs.clear();
   _properties.clear();
@@ -53,13 +160,73 @@ std::vector<std::string> Cpp_object_bridge::get_members_advanced(const NamingSty
   return members;
 }
 
+std::shared_ptr<Cpp_function> Cpp_object_bridge::find_function(const std::string &name) const {
+  auto func = _funcs.find(name);
+  if (func != _funcs.end())
+    return func->second;
+
+  if (_members) {
+    auto method = _members->_methods.find(name);
+    if (method != _members->_methods.end())
+      return method->second.function;
+  }
+
+  return std::shared_ptr<Cpp_function>();
+}
+
+const Cpp_member_index::Function_entry *Cpp_object_bridge::find_function(const std::string &name, NamingStyle style) const {
+  const Cpp_member_index::Function_entry *ret_val = nullptr;
+
+  if (_index)
+    ret_val = _index->function(name, style);
+
+  if (!ret_val && _members)
+    ret_val = _members->_index.function(name, style);
+
+  return ret_val;
+}
+
+const std::shared_ptr<Cpp_property_name> *Cpp_object_bridge::find_property(const std::string &name, NamingStyle style) const {
+  const std::shared_ptr<Cpp_property_name> *ret_val = nullptr;
+
+  if (_index)
+    ret_val = _index->property(name, style);
+
+  if (!ret_val && _members)
+    ret_val = _members->_index.property(name, style);
+
+  return ret_val;
+}
+
+std::vector<std::shared_ptr<Cpp_property_name> > Cpp_object_bridge::properties() const {
+  if (!_members)
+    return _properties;
+
+  std::vector<std::shared_ptr<Cpp_property_name> > ret_val(_members->_properties);
+  ret_val.insert(ret_val.end(), _properties.begin(), _properties.end());
+
+  return ret_val;
+}
+
+std::map<std::string, std::shared_ptr<Cpp_function> > Cpp_object_bridge::functions() const {
+  if (!_members)
+    return _funcs;
+
+  // The instance functions replace the class ones with the same name
+  std::map<std::string, std::shared_ptr<Cpp_function> > ret_val(_funcs);
+  for (auto &method : _members->_methods)
+    ret_val.insert(std::make_pair(method.first, method.second.function));
+
+  return ret_val;
+}
+
 std::vector<std::string> Cpp_object_bridge::get_members() const {
   std::vector<std::string> members;
 
-  for (auto prop : _properties)
+  for (auto prop : properties())
     members.push_back(prop->name(naming_style));
 
-  for (auto func : _funcs)
+  for (auto func : functions())
     members.push_back(func.second->name(naming_style));
 
   return members;
@@ -69,12 +236,12 @@ std::string Cpp_object_bridge::get_base_name(const std::string& member) const {
   std::string ret_val;
   auto style = naming_style;
 
-  auto func = std::find_if(_funcs.begin(), _funcs.end(), [member, style](const FunctionEntry &f) { return f.second->name(style) == member; });
-  if (func != _funcs.end()) {
-    ret_val = (*func).second->name(NamingStyle::LowerCamelCase);
+  auto func = find_function(member, style);
+  if (func) {
+    ret_val = func->function->name(NamingStyle::LowerCamelCase);
   } else {
-    auto prop = std::find_if(_properties.begin(), _properties.end(), [member, style](std::shared_ptr<Cpp_property_name> p) { return p->name(style) == member; });
-    if (prop != _properties.end())
+    auto prop = find_property(member, style);
+    if (prop)
       ret_val = (*prop)->name(NamingStyle::LowerCamelCase);
   }
 
@@ -82,10 +249,14 @@ std::string Cpp_object_bridge::get_base_name(const std::string& member) const {
 }
 
 std::string Cpp_object_bridge::get_function_name(const std::string& member, bool fully_specified) const {
+  auto func = find_function(member);
+  if (!func)
+    throw std::out_of_range("Invalid object function " + member);
+
   if (fully_specified)
-    return class_name() + "." + _funcs.at(member)->name(naming_style);
+    return class_name() + "." + func->name(naming_style);
   else
-    return _funcs.at(member)->name(naming_style);
+    return func->name(naming_style);
 }
 
 shcore::Value Cpp_object_bridge::get_member_method(const shcore::Argument_list &args, const std::string& method, const std::string& prop) {
@@ -97,16 +268,15 @@ shcore::Value Cpp_object_bridge::get_member_method(const shcore::Argument_list &
 Value Cpp_object_bridge::get_member_advanced(const std::string &prop, const NamingStyle &style) {
   Value ret_val;
 
-  auto func = std::find_if(_funcs.begin(), _funcs.end(), [prop, style](const FunctionEntry &f) { return f.second->name(style) == prop; });
-
-  if (func != _funcs.end()) {
+  auto func = find_function(prop, style);
+  if (func) {
     ScopedStyle ss(this, style);
-    ret_val = get_member(func->first);
+    ret_val = get_member(func->base_name);
   } else {
-    auto prop_index = std::find_if(_properties.begin(), _properties.end(), [prop, style](std::shared_ptr<Cpp_property_name> p) { return p->name(style) == prop; });
-    if (prop_index != _properties.end()) {
+    auto property = find_property(prop, style);
+    if (property) {
       ScopedStyle ss(this, style);
-      ret_val = get_member((*prop_index)->base_name());
+      ret_val = get_member((*property)->base_name());
     } else
       throw Exception::attrib_error("Invalid object member " + prop);
   }
@@ -118,31 +288,38 @@ Value Cpp_object_bridge::get_member(const std::string &prop) const {
   std::map<std::string, std::shared_ptr<Cpp_function> >::const_iterator i;
   if ((i = _funcs.find(prop)) != _funcs.end())
     return Value(std::shared_ptr<Function_base>(i->second));
+
+  if (_members) {
+    auto method = _members->_methods.find(prop);
+    if (method != _members->_methods.end()) {
+      // The class methods are bound to the instance when retrieved
+      std::shared_ptr<Cpp_function> function(new Cpp_function(*method->second.function));
+      Cpp_member_registry::Method bound(method->second.method);
+      Cpp_object_bridge *object = const_cast<Cpp_object_bridge *>(this);
+      function->_func = [bound, object](const Argument_list &args) { return bound(object, args); };
+
+      return Value(std::shared_ptr<Function_base>(function));
+    }
+  }
+
   throw Exception::attrib_error("Invalid object member " + prop);
 }
 
 bool Cpp_object_bridge::has_member_advanced(const std::string &prop, const NamingStyle &style) {
-  auto method_index = std::find_if(_funcs.begin(), _funcs.end(), [prop, style](const FunctionEntry &f) { return f.second->name(style) == prop; });
-
-  auto prop_index = std::find_if(_properties.begin(), _properties.end(), [prop, style](std::shared_ptr<Cpp_property_name> p) { return p->name(style) == prop; });
-
-  return (method_index != _funcs.end() || prop_index != _properties.end());
+  return find_function(prop, style) || find_property(prop, style);
 }
 
 bool Cpp_object_bridge::has_member(const std::string &prop) const {
-  auto method_index = std::find_if(_funcs.begin(), _funcs.end(), [prop](const FunctionEntry &f) { return f.first == prop; });
-
-  auto prop_index = std::find_if(_properties.begin(), _properties.end(), [prop](std::shared_ptr<Cpp_property_name> p) { return p->base_name() == prop; });
-
-  return (method_index != _funcs.end() || prop_index != _properties.end());
+  // The base name is the one on LowerCamelCase
+  return find_function(prop) || find_property(prop, LowerCamelCase);
 }
 
 void Cpp_object_bridge::set_member_advanced(const std::string &prop, Value value, const NamingStyle &style) {
-  auto prop_index = std::find_if(_properties.begin(), _properties.end(), [prop, style](std::shared_ptr<Cpp_property_name> p) { return p->name(style) == prop; });
-  if (prop_index != _properties.end()) {
+  auto property = find_property(prop, style);
+  if (property) {
     ScopedStyle ss(this, style);
 
-    set_member((*prop_index)->base_name(), value);
+    set_member((*property)->base_name(), value);
   } else
     throw Exception::attrib_error("Can't set object member " + prop);
 }
@@ -164,15 +341,11 @@ void Cpp_object_bridge::set_member(size_t UNUSED(index), Value UNUSED(value)) {
 }
 
 bool Cpp_object_bridge::has_method(const std::string &name) const {
-  auto method_index = _funcs.find(name);
-
-  return method_index != _funcs.end();
+  return find_function(name) != nullptr;
 }
 
 bool Cpp_object_bridge::has_method_advanced(const std::string &name, const NamingStyle &style) {
-  auto method_index = std::find_if(_funcs.begin(), _funcs.end(), [name, style](const FunctionEntry &f) { return f.second->name(style) == name; });
-
-  return method_index != _funcs.end();
+  return find_function(name, style) != nullptr;
 }
 
 void Cpp_object_bridge::add_method(const std::string &name, Cpp_function::Function func,
@@ -196,21 +369,31 @@ void Cpp_object_bridge::add_method(const std::string &name, Cpp_function::Functi
     va_end(l);
   }
 
-  auto function = std::shared_ptr<Cpp_function>(new Cpp_function(name, func, signature));
-  _funcs[name.substr(0, name.find("|"))] = function;
+  add_function(name, std::shared_ptr<Cpp_function>(new Cpp_function(name, func, signature)));
 }
 
 void Cpp_object_bridge::add_varargs_method(const std::string &name, Cpp_function::Function func) {
-  auto function = std::shared_ptr<Cpp_function>(new Cpp_function(name, func, true));
-  _funcs[name.substr(0, name.find("|"))] = function;
+  add_function(name, std::shared_ptr<Cpp_function>(new Cpp_function(name, func, true)));
+}
+
+void Cpp_object_bridge::add_function(const std::string &name, const std::shared_ptr<Cpp_function> &function) {
+  if (!_index)
+    _index.reset(new Cpp_member_index());
+
+  std::string base_name = name.substr(0, name.find("|"));
+  auto &entry = _funcs[base_name];
+  if (entry)
+    _index->remove_function(*entry);
+  entry = function;
+  _index->add_function(base_name, function);
 }
 
 void Cpp_object_bridge::add_constant(const std::string &name) {
-  _properties.push_back(std::shared_ptr<Cpp_property_name>(new Cpp_property_name(name, true)));
+  add_property_name(std::shared_ptr<Cpp_property_name>(new Cpp_property_name(name, true)));
 }
 
 void Cpp_object_bridge::add_property(const std::string &name, const std::string &getter) {
-  _properties.push_back(std::shared_ptr<Cpp_property_name>(new Cpp_property_name(name)));
+  add_property_name(std::shared_ptr<Cpp_property_name>(new Cpp_property_name(name)));
 
   if (!getter.empty())
       add_method(getter, std::bind(&Cpp_object_bridge::get_member_method, this, _1, getter, name), NULL);
@@ -219,22 +402,42 @@ void Cpp_object_bridge::add_property(const std::string &name, const std::string
 void Cpp_object_bridge::delete_property(const std::string &name, const std::string &getter) {
   auto prop_index = std::find_if(_properties.begin(), _properties.end(), [name](std::shared_ptr<Cpp_property_name> p) { return p->base_name() == name; });
   if (prop_index != _properties.end()) {
+    std::shared_ptr<Cpp_property_name> property(*prop_index);
     _properties.erase(prop_index);
+    _index->remove_property(*property);
+
+    // Another property with the same name is found from now on
+    for (auto &other : _properties) {
+      if (other->base_name() == name)
+        _index->add_property(other);
+    }
 
-    if (!getter.empty())
-      _funcs.erase(getter);
+    if (!getter.empty()) {
+      auto function = _funcs.find(getter);
+      if (function != _funcs.end()) {
+        _index->remove_function(*function->second);
+        _funcs.erase(function);
+      }
+    }
   }
 }
 
-Value Cpp_object_bridge::call_advanced(const std::string &name, const Argument_list &args, const NamingStyle &style) {
-  auto func = std::find_if(_funcs.begin(), _funcs.end(), [name, style](const FunctionEntry &f) { return f.second->name(style) == name; });
+void Cpp_object_bridge::add_property_name(const std::shared_ptr<Cpp_property_name> &property) {
+  if (!_index)
+    _index.reset(new Cpp_member_index());
 
+  _properties.push_back(property);
+  _index->add_property(property);
+}
+
+Value Cpp_object_bridge::call_advanced(const std::string &name, const Argument_list &args, const NamingStyle &style) {
   Value ret_val;
 
-  if (func != _funcs.end()) {
+  auto func = find_function(name, style);
+  if (func) {
     ScopedStyle ss(this, style);
 
-    ret_val = call(func->first, args);
+    ret_val = call(func->base_name, args);
   } else
     throw Exception::attrib_error("Invalid object function " + name);
 
@@ -243,9 +446,16 @@ Value Cpp_object_bridge::call_advanced(const std::string &name, const Argument_l
 
 Value Cpp_object_bridge::call(const std::string &name, const Argument_list &args) {
   std::map<std::string, std::shared_ptr<Cpp_function> >::const_iterator i;
-  if ((i = _funcs.find(name)) == _funcs.end())
-      throw Exception::attrib_error("Invalid object function " + name);
-  return i->second->invoke(args);
+  if ((i = _funcs.find(name)) != _funcs.end())
+    return i->second->invoke(args);
+
+  if (_members) {
+    auto method = _members->_methods.find(name);
+    if (method != _members->_methods.end())
+      return method->second.method(this, args);
+  }
+
+  throw Exception::attrib_error("Invalid object function " + name);
 }
 
 shcore::Value Cpp_object_bridge::help(const shcore::Argument_list &args) {
@@ -305,9 +515,10 @@ shcore::Value Cpp_object_bridge::help(const shcore::Argument_list &args) {
     if (!details.empty())
       ret_val += shcore::format_markup_text(details, 80, 0);
 
-    if (_properties.size()) {
+    auto properties = this->properties();
+    if (properties.size()) {
       size_t text_col = 0;
-      for (auto property : _properties) {
+      for (auto property : properties) {
         size_t new_length = property->name(naming_style).length();
         text_col = new_length > text_col ? new_length : text_col;
       }
@@ -317,7 +528,7 @@ shcore::Value Cpp_object_bridge::help(const shcore::Argument_list &args) {
       text_col += 4;
 
       ret_val += "\n\nThe following properties are currently supported.\n\n";
-      for (auto property : _properties) {
+      for (auto property : properties) {
         std::string name = property->name(naming_style);
         std::string pname = property->name(shcore::NamingStyle::LowerCamelCase);
 
@@ -339,9 +550,10 @@ shcore::Value Cpp_object_bridge::help(const shcore::Argument_list &args) {
       ret_val += "\n\n";
     }
 
-    if (_funcs.size()) {
+    auto functions = this->functions();
+    if (functions.size()) {
       size_t text_col = 0;
-      for (auto function : _funcs) {
+      for (auto function : functions) {
         size_t new_length = function.second->_name[naming_style].length();
         text_col = new_length > text_col ? new_length : text_col;
       }
@@ -352,7 +564,7 @@ shcore::Value Cpp_object_bridge::help(const shcore::Argument_list &args) {
 
       ret_val += "The following functions are currently supported.\n\n";
 
-      for (auto function : _funcs) {
+      for (auto function : functions) {
         std::string name = function.second->_name[naming_style];
 
         // Skips non public functions
@@ -468,7 +680,7 @@ std::string Cpp_function::name() {
   return _name[LowerCamelCase];
 }
 
-std::string Cpp_function::name(const NamingStyle& style) {
+const std::string &Cpp_function::name(const NamingStyle& style) const {
   return _name[style];
 }
 
@@ -530,10 +742,10 @@ Cpp_property_name::Cpp_property_name(const std::string &name, bool constant) {
   }
 }
 
-std::string Cpp_property_name::name(const NamingStyle& style) {
+const std::string &Cpp_property_name::name(const NamingStyle& style) const {
   return _name[style];
 }
 
-std::string Cpp_property_name::base_name() {
+const std::string &Cpp_property_name::base_name() const {
   return _name[LowerCamelCase];
 }
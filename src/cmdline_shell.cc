@@ -225,7 +225,12 @@ void Command_line_shell::print_cmd_line_helper() {
   println("  -i, --interactive[=full] To use in batch mode, it forces emulation of interactive mode processing.");
   println("                           Each line on the batch is processed as if it were in interactive mode.");
   println("  --force                  To use in SQL batch mode, forces processing to continue if an error is found.");
+  println("  --pipeline[=size]        To use in SQL batch mode with an X Protocol session, sends up to size");
+  println("                           statements (default 100) before reading their results.");
   println("  --log-level=value        The log level." + ngcommon::Logger::get_level_range_info());
+  println("  --log-overflow=value     What to do with debug log messages when the log writer falls behind:");
+  println("                           block (default) to wait, drop to discard them or count to discard them");
+  println("                           and log how many were discarded.");
   println("  --version                Prints the version of MySQL Shell.");
   println("  --ssl                    Enable SSL for connection(automatically enabled with other flags).");
   println("  --ssl-key=name           X509 key in PEM format.");
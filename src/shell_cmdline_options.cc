@@ -260,6 +260,18 @@ _options.ssl_info.skip = false;
       exit_code = 0;
     } else if (check_arg(argv, i, "--force", "--force"))
       _options.force = true;
+    else if (check_arg_with_value(argv, i, "--pipeline", NULL, value, true)) {
+      if (!value)
+        _options.pipeline_size = DEFAULT_PIPELINE_SIZE;
+      else {
+        _options.pipeline_size = atoi(value);
+        if (_options.pipeline_size <= 0) {
+          std::cerr << "Value for --pipeline must be a positive integer.\n";
+          exit_code = 1;
+          break;
+        }
+      }
+    }
     else if (check_arg(argv, i, "--no-wizard", "--nw"))
       _options.wizards = false;
     else if (check_arg_with_value(argv, i, "--interactive", "-i", value, true)) {
@@ -289,6 +301,18 @@ _options.ssl_info.skip = false;
         break;
       } else
         _options.log_level = nlog_level;
+    } else if (check_arg_with_value(argv, i, "--log-overflow", NULL, value)) {
+      if (strcmp(value, "block") == 0)
+        _options.log_overflow = ngcommon::Logger::OVERFLOW_BLOCK;
+      else if (strcmp(value, "drop") == 0)
+        _options.log_overflow = ngcommon::Logger::OVERFLOW_DROP;
+      else if (strcmp(value, "count") == 0)
+        _options.log_overflow = ngcommon::Logger::OVERFLOW_COUNT;
+      else {
+        std::cerr << "Value for --log-overflow must be block, drop or count.\n";
+        exit_code = 1;
+        break;
+      }
     } else if (check_arg(argv, i, "--vertical", "-E")) {
       _options.output_format = "vertical";
     } else if (exit_code == 0) {
@@ -0,0 +1,362 @@
+/* Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; version 2 of the License.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "shellcore/types.h"
+#include "shellcore/types_cpp.h"
+#include "../modules/base_resultset.h"
+#include "../modules/mod_mysqlx_resultset.h"
+
+namespace mysqlsh {
+namespace base_resultset_tests {
+
+static const int k_columns = 20;
+
+static std::vector<std::string> column_names() {
+  std::vector<std::string> names;
+  for (int index = 0; index < k_columns; index++)
+    names.push_back("column_name_" + std::to_string(index));
+
+  return names;
+}
+
+// Approximate memory used by the names held on a definition
+static size_t definition_bytes(const Row_definition &definition) {
+  size_t bytes = sizeof(Row_definition);
+  for (size_t index = 0; index < definition.size(); index++) {
+    // Name on the field list, the lookup map and the two property maps
+    bytes += 4 * (sizeof(std::string) + definition.name(index).capacity());
+  }
+
+  return bytes;
+}
+
+TEST(Row_tests, shared_definition) {
+  std::shared_ptr<Row_definition> definition(new Row_definition());
+  definition->add_field("id");
+  definition->add_field("first name");
+  definition->add_field("length");
+  definition->add_field("id");
+  definition->add_field("lastName");
+
+  Row row(definition);
+  row.add_value(shcore::Value(1));
+  row.add_value(shcore::Value("John"));
+  row.add_value(shcore::Value(3));
+  row.add_value(shcore::Value(4));
+  row.add_value(shcore::Value("Doe"));
+
+  EXPECT_EQ(5, row.get_length());
+  EXPECT_EQ(1, row.get_member("id").as_int());
+  EXPECT_EQ("John", row.get_member("first name").as_string());
+  EXPECT_EQ(5, row.get_member("length").as_int());
+
+  // Only valid identifiers not colliding with the Row members are properties
+  EXPECT_TRUE(row.has_member("id"));
+  EXPECT_TRUE(row.has_member("lastName"));
+  EXPECT_FALSE(row.has_member("first name"));
+  EXPECT_TRUE(row.has_member_advanced("last_name", shcore::LowerCaseUnderscores));
+  EXPECT_EQ("Doe", row.get_member_advanced("last_name", shcore::LowerCaseUnderscores).as_string());
+
+  // A row with its own definition behaves the same
+  Row *single = new Row();
+  shcore::Value single_value(shcore::Value::wrap(single));
+  single->add_item("id", shcore::Value(1));
+  single->add_item("lastName", shcore::Value("Doe"));
+  EXPECT_EQ(2, single->get_length());
+  EXPECT_EQ("Doe", single->get_member("lastName").as_string());
+  EXPECT_TRUE(single->has_member("lastName"));
+  EXPECT_EQ("{\"id\":1,\"lastName\":\"Doe\"}", single_value.json());
+}
+
+// Emulates fetchAll on a wide result comparing rows holding their own field
+// names (as every row did before) with rows sharing the result definition
+TEST(Row_tests, fetch_all_shared_definition) {
+  const int rows = 100;
+  std::vector<std::string> names(column_names());
+
+  size_t own_bytes = 0;
+  {
+    shcore::Value::Array_type_ref result(new shcore::Value::Array_type());
+    for (int index = 0; index < rows; index++) {
+      Row *row = new Row();
+      for (int column = 0; column < k_columns; column++)
+        row->add_item(names[column], shcore::Value(index + column));
+
+      own_bytes += definition_bytes(*row->definition) + row->value_array.capacity() * sizeof(shcore::Value);
+      result->push_back(shcore::Value::wrap(row));
+    }
+    EXPECT_EQ(rows, static_cast<int>(result->size()));
+  }
+
+  size_t shared_bytes = 0;
+  {
+    std::shared_ptr<Row_definition> definition(new Row_definition());
+    for (int column = 0; column < k_columns; column++)
+      definition->add_field(names[column]);
+    shared_bytes += definition_bytes(*definition);
+
+    shcore::Value::Array_type_ref result(new shcore::Value::Array_type());
+    for (int index = 0; index < rows; index++) {
+      Row *row = new Row(definition);
+      row->value_array.reserve(k_columns);
+      for (int column = 0; column < k_columns; column++)
+        row->add_value(shcore::Value(index + column));
+
+      shared_bytes += row->value_array.capacity() * sizeof(shcore::Value);
+      result->push_back(shcore::Value::wrap(row));
+    }
+    EXPECT_EQ(rows, static_cast<int>(result->size()));
+    EXPECT_EQ(rows + 1, definition.use_count());
+
+    auto last = result->back().as_object<Row>();
+    EXPECT_EQ(rows - 1 + 5, last->get_member("column_name_5").as_int());
+  }
+
+  EXPECT_LT(shared_bytes, own_bytes);
+}
+
+// Decodes "text" records as the result sources do, counting the decoded fields
+class Test_source : public Row_source {
+public:
+  Test_source(const std::vector<std::string> *record, int *decoded) : _record(record), _decoded(decoded) {}
+
+  virtual shcore::Value get_value(size_t index) const {
+    (*_decoded)++;
+    const std::string &field((*_record)[index]);
+    if (field.empty())
+      return shcore::Value::Null();
+
+    return shcore::Value(static_cast<int64_t>(std::stoll(field)));
+  }
+
+private:
+  const std::vector<std::string> *_record;
+  int *_decoded;
+};
+
+TEST(Row_tests, lazy_fields) {
+  std::shared_ptr<Row_definition> definition(new Row_definition());
+  definition->add_field("id");
+  definition->add_field("count");
+  definition->add_field("parent");
+
+  std::vector<std::string> record = {"1", "20", ""};
+  int decoded = 0;
+  Row *row = new Row(definition, std::shared_ptr<Row_source>(new Test_source(&record, &decoded)));
+  shcore::Value row_value(shcore::Value::wrap(row));
+
+  EXPECT_EQ(3, row->get_length());
+  EXPECT_EQ(0, decoded);
+
+  // Fields are decoded once, when first accessed
+  EXPECT_EQ(20, row->get_member("count").as_int());
+  EXPECT_EQ(20, row->get_member(1).as_int());
+  EXPECT_EQ(1, decoded);
+
+  EXPECT_EQ(shcore::Null, row->get_field_("parent").type);
+  EXPECT_EQ(2, decoded);
+
+  // Printing decodes the rest
+  EXPECT_EQ("[1,20,null]", row_value.descr());
+  EXPECT_EQ("{\"id\":1,\"count\":20,\"parent\":null}", row_value.json());
+  EXPECT_EQ(3, decoded);
+}
+
+// Wide rows where only a few columns are read, decoding every field when
+// the row is created against decoding the fields accessed
+TEST(Row_tests, fetch_all_lazy_fields) {
+  const int rows = 100;
+  const int columns = 40;
+
+  std::shared_ptr<Row_definition> definition(new Row_definition());
+  for (int column = 0; column < columns; column++)
+    definition->add_field("column_" + std::to_string(column));
+
+  std::vector<std::string> record;
+  for (int column = 0; column < columns; column++)
+    record.push_back(std::to_string(1000000 + column));
+
+  int decoded = 0;
+  int64_t sum = 0;
+  std::shared_ptr<Row_source> source(new Test_source(&record, &decoded));
+
+  for (int index = 0; index < rows; index++) {
+    Row *row = new Row(definition);
+    shcore::Value row_value(shcore::Value::wrap(row));
+    row->value_array.reserve(columns);
+    for (int column = 0; column < columns; column++)
+      row->add_value(source->get_value(column));
+
+    sum += row->get_member("column_0").as_int() + row->get_member("column_7").as_int() + row->get_member(39).as_int();
+  }
+  EXPECT_EQ(rows * columns, decoded);
+
+  decoded = 0;
+  for (int index = 0; index < rows; index++) {
+    Row *row = new Row(definition, source);
+    shcore::Value row_value(shcore::Value::wrap(row));
+
+    sum -= row->get_member("column_0").as_int() + row->get_member("column_7").as_int() + row->get_member(39).as_int();
+  }
+  EXPECT_EQ(rows * 3, decoded);
+  EXPECT_EQ(0, sum);
+}
+
+// The members are shared by all the rows and bound to a row when retrieved
+TEST(Row_tests, class_members) {
+  std::shared_ptr<Row_definition> definition(new Row_definition());
+  definition->add_field("id");
+  definition->add_field("name");
+
+  Row *first = new Row(definition);
+  shcore::Value first_value(shcore::Value::wrap(first));
+  first->add_value(shcore::Value(1));
+  first->add_value(shcore::Value("first"));
+
+  Row *second = new Row(definition);
+  shcore::Value second_value(shcore::Value::wrap(second));
+  second->add_value(shcore::Value(2));
+  second->add_value(shcore::Value("second"));
+
+  std::vector<std::string> members = {"length", "getField", "getLength", "help", "id", "name"};
+  EXPECT_EQ(members, first->get_members());
+  members = {"length", "get_field", "get_length", "help", "id", "name"};
+  EXPECT_EQ(members, first->get_members_advanced(shcore::LowerCaseUnderscores));
+
+  EXPECT_TRUE(first->has_method("getField"));
+  EXPECT_TRUE(first->has_method_advanced("get_field", shcore::LowerCaseUnderscores));
+  EXPECT_FALSE(first->has_method_advanced("get_field", shcore::LowerCamelCase));
+  EXPECT_TRUE(first->has_member("getLength"));
+
+  shcore::Argument_list args;
+  args.push_back(shcore::Value("name"));
+  EXPECT_EQ("first", first->call("getField", args).as_string());
+  EXPECT_EQ("second", second->call_advanced("get_field", args, shcore::LowerCaseUnderscores).as_string());
+  EXPECT_EQ(2, second->call("getLength", shcore::Argument_list()).as_int());
+
+  // The retrieved function stays bound to its row
+  auto get_field = std::dynamic_pointer_cast<shcore::Cpp_function>(
+      second->get_member_advanced("get_field", shcore::LowerCaseUnderscores).as_function());
+  ASSERT_TRUE(get_field != nullptr);
+  EXPECT_EQ("get_field", get_field->name(shcore::LowerCaseUnderscores));
+  ASSERT_EQ(1u, get_field->signature().size());
+  EXPECT_EQ("second", get_field->invoke(args).as_string());
+
+  try {
+    first->call("getField", shcore::Argument_list());
+    FAIL() << "Missing argument not reported";
+  } catch (const shcore::Exception &e) {
+    EXPECT_STREQ("Invalid number of arguments in Row.getField, expected 1 but got 0", e.what());
+  }
+  EXPECT_THROW(first->call("fetchOne", args), shcore::Exception);
+
+  std::string help = first->call("help", shcore::Argument_list()).as_string();
+  EXPECT_NE(std::string::npos, help.find(" - getField"));
+  EXPECT_NE(std::string::npos, help.find(" - length"));
+}
+
+// The members of a result are built once for its class
+TEST(Row_tests, result_class_members) {
+  std::vector<std::string> members = {"executionTime", "warningCount", "warnings", "columnCount", "columns",
+                                      "columnNames", "fetchAll", "fetchOne", "getColumnCount", "getColumnNames",
+                                      "getColumns", "getExecutionTime", "getWarningCount", "getWarnings", "help"};
+  mysqlx::RowResult result((std::shared_ptr< ::mysqlx::Result>()));
+  EXPECT_EQ(members, result.get_members());
+
+  mysqlx::RowResult other((std::shared_ptr< ::mysqlx::Result>()));
+  EXPECT_EQ(members, other.get_members());
+}
+
+// Each fetched row used to build its own members, now they are built once
+// for the class. Only prints the rates, run it with
+// --gtest_also_run_disabled_tests
+TEST(Row_tests, DISABLED_construction_performance) {
+  // Builds its members as every row did before
+  class Bound_row : public shcore::Cpp_object_bridge {
+  public:
+    Bound_row() {
+      add_property("length", "getLength");
+      add_method("getField", std::bind(&Bound_row::get_field, this, std::placeholders::_1), "field", shcore::String, NULL);
+      add_method("getLength", std::bind(&Bound_row::get_member_method, this, std::placeholders::_1, "getLength", "length"), NULL);
+    }
+
+    virtual std::string class_name() const { return "Row"; }
+    virtual bool operator == (const Object_bridge &other) const { return this == &other; }
+    shcore::Value get_field(const shcore::Argument_list &) { return shcore::Value(); }
+  };
+
+  const int rows = 200000;
+  std::shared_ptr<Row_definition> definition(new Row_definition());
+
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for (int index = 0; index < rows; index++)
+    shcore::Value row(shcore::Value::wrap(new Bound_row()));
+  double bound_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+  start = std::chrono::high_resolution_clock::now();
+  for (int index = 0; index < rows; index++)
+    shcore::Value row(shcore::Value::wrap(new Row(definition)));
+  double shared_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+  std::cout << "rows with own members: " << static_cast<uint64_t>(rows / bound_seconds) << " rows/sec" << std::endl;
+  std::cout << "rows with class members: " << static_cast<uint64_t>(rows / shared_seconds) << " rows/sec" << std::endl;
+}
+
+TEST(Row_tests, DISABLED_result_construction_performance) {
+  // Builds its members as every RowResult did before
+  class Bound_result : public ShellBaseResult {
+  public:
+    Bound_result() {
+      add_property("executionTime", "getExecutionTime");
+      add_property("warningCount", "getWarningCount");
+      add_property("warnings", "getWarnings");
+      add_property("columnCount", "getColumnCount");
+      add_property("columns", "getColumns");
+      add_property("columnNames", "getColumnNames");
+      add_method("fetchOne", std::bind(&Bound_result::fetch, this, std::placeholders::_1), "nothing", shcore::String, NULL);
+      add_method("fetchAll", std::bind(&Bound_result::fetch, this, std::placeholders::_1), "nothing", shcore::String, NULL);
+    }
+
+    virtual std::string class_name() const { return "RowResult"; }
+    shcore::Value fetch(const shcore::Argument_list &) { return shcore::Value(); }
+  };
+
+  const int results = 100000;
+
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for (int index = 0; index < results; index++)
+    shcore::Value result(std::shared_ptr<shcore::Object_bridge>(new Bound_result()));
+  double bound_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+  start = std::chrono::high_resolution_clock::now();
+  for (int index = 0; index < results; index++) {
+    shcore::Value result(std::shared_ptr<shcore::Object_bridge>(
+        new mysqlx::RowResult(std::shared_ptr< ::mysqlx::Result>())));
+  }
+  double shared_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+  std::cout << "results with own members: " << static_cast<uint64_t>(results / bound_seconds) << " results/sec" << std::endl;
+  std::cout << "results with class members: " << static_cast<uint64_t>(results / shared_seconds) << " results/sec" << std::endl;
+}
+
+}  // namespace base_resultset_tests
+}  // namespace mysqlsh
@@ -0,0 +1,161 @@
+/* Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; version 2 of the License.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "../mysqlxtest/common/expr_cache.h"
+
+#include "mysqlx_datatypes.pb.h"
+#include "mysqlx_expr.pb.h"
+
+using namespace mysqlx;
+
+namespace shcore {
+namespace expr_cache_tests {
+
+static std::string parse(const std::string &source, bool document_mode, std::vector<std::string> *place_holders) {
+  Expr_parser parser(source, document_mode, false, place_holders);
+  std::unique_ptr<Mysqlx::Expr::Expr> expr(parser.expr());
+  return expr->DebugString();
+}
+
+static std::string cached(Expr_cache &cache, const std::string &source, bool document_mode,
+                          std::vector<std::string> *place_holders) {
+  std::unique_ptr<Mysqlx::Expr::Expr> expr(cache.expr(source, document_mode, false, place_holders));
+  return expr->DebugString();
+}
+
+TEST(Expr_cache_tests, hits_and_misses) {
+  Expr_cache cache;
+
+  std::vector<std::string> place_holders;
+  EXPECT_EQ(parse("_id = :id", true, NULL), cached(cache, "_id = :id", true, &place_holders));
+  EXPECT_EQ(parse("_id = :id", true, NULL), cached(cache, "_id = :id", true, NULL));
+
+  // The document mode is part of the key
+  EXPECT_EQ(parse("_id = :id", false, NULL), cached(cache, "_id = :id", false, NULL));
+
+  Expr_cache::Stats stats = cache.stats();
+  EXPECT_EQ(1u, stats.hits);
+  EXPECT_EQ(2u, stats.misses);
+  EXPECT_EQ(2u, stats.entries);
+  EXPECT_LT(0u, stats.bytes);
+
+  ASSERT_EQ(1u, place_holders.size());
+  EXPECT_EQ("id", place_holders[0]);
+
+  // Errors are not cached
+  EXPECT_THROW(cache.expr("_id = ", true), Parser_error);
+  EXPECT_THROW(cache.expr("_id = ", true), Parser_error);
+  EXPECT_EQ(2u, cache.stats().entries);
+
+  cache.clear();
+  stats = cache.stats();
+  EXPECT_EQ(0u, stats.hits);
+  EXPECT_EQ(0u, stats.entries);
+  EXPECT_EQ(0u, stats.bytes);
+}
+
+// The placeholders are placed on the statement list as the parser does, both
+// when the expression is parsed and when it comes from the cache
+TEST(Expr_cache_tests, place_holders) {
+  Expr_cache cache;
+  const std::string source = "name = :name and age > :age and :name <> ''";
+
+  for (int pass = 0; pass < 2; pass++) {
+    std::vector<std::string> expected = {"age", "other"};
+    std::vector<std::string> place_holders = expected;
+
+    std::string parsed = parse(source, false, &expected);
+    EXPECT_EQ(parsed, cached(cache, source, false, &place_holders));
+    EXPECT_EQ(expected, place_holders);
+  }
+
+  EXPECT_EQ(1u, cache.stats().hits);
+}
+
+TEST(Expr_cache_tests, eviction) {
+  Expr_cache cache(2, 1024 * 1024);
+
+  delete cache.expr("a = 1");
+  delete cache.expr("b = 2");
+  delete cache.expr("a = 1");
+  delete cache.expr("c = 3");
+
+  // b is the least recently used
+  EXPECT_EQ(2u, cache.stats().entries);
+  delete cache.expr("a = 1");
+  EXPECT_EQ(2u, cache.stats().hits);
+  delete cache.expr("b = 2");
+  EXPECT_EQ(2u, cache.stats().hits);
+
+  // Limited by bytes, entries bigger than the limit are never kept
+  std::string big(100, 'x');
+  cache.set_limits(100, 150);
+  EXPECT_LE(cache.stats().bytes, 150u);
+  delete cache.expr("'" + big + "' = name");
+  EXPECT_LE(cache.stats().bytes, 150u);
+
+  cache.set_limits(0, 150);
+  EXPECT_EQ(0u, cache.stats().entries);
+  EXPECT_EQ(0u, cache.stats().bytes);
+}
+
+// The positional placeholders, a colon without a name, are named after the
+// placeholders already on the statement list, as when the expressions are
+// parsed
+TEST(Expr_cache_tests, positional_place_holders) {
+  Expr_cache cache;
+  const std::string criteria = "name = :name and age > :";
+  const std::string having = "(count > :) or :name = ''";
+
+  for (int pass = 0; pass < 2; pass++) {
+    std::vector<std::string> expected;
+    std::string parsed_criteria = parse(criteria, false, &expected);
+    std::string parsed_having = parse(having, false, &expected);
+
+    std::vector<std::string> place_holders;
+    EXPECT_EQ(parsed_criteria, cached(cache, criteria, false, &place_holders));
+    EXPECT_EQ(parsed_having, cached(cache, having, false, &place_holders));
+    EXPECT_EQ(expected, place_holders);
+
+    std::vector<std::string> names = {"name", "1", "2"};
+    EXPECT_EQ(names, place_holders);
+  }
+}
+
+TEST(Expr_cache_tests, repeated_expression) {
+  const int count = 1000;
+  const std::string source = "_id = :id and (count > 10 or name like :pattern) and tags[0] in ('a', 'b', 'c')";
+  Expr_cache cache;
+
+  std::vector<std::string> expected;
+  std::string parsed = parse(source, true, &expected);
+
+  for (int index = 0; index < count; index++) {
+    std::vector<std::string> place_holders;
+    EXPECT_EQ(parsed, cached(cache, source, true, &place_holders));
+    EXPECT_EQ(expected, place_holders);
+  }
+
+  EXPECT_EQ(static_cast<uint64_t>(count - 1), cache.stats().hits);
+  EXPECT_EQ(1u, cache.stats().misses);
+}
+
+}  // namespace expr_cache_tests
+}  // namespace shcore
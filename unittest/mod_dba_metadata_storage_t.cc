@@ -0,0 +1,219 @@
+/* Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; version 2 of the License.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <unistd.h>
+#else
+#include <process.h>
+#define getpid _getpid
+#endif
+
+#include "gtest/gtest.h"
+#include "shellcore/shell_core.h"
+#include "shellcore/shell_core_options.h"
+#include "modules/mod_mysql_session.h"
+#include "modules/adminapi/mod_dba.h"
+#include "modules/adminapi/mod_dba_metadata_storage.h"
+#include "test_utils.h"
+
+namespace mysqlsh {
+namespace dba {
+namespace metadata_storage_tests {
+
+class Metadata_snapshot_tests : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    _shell_core.reset(new shcore::Shell_core(&_output_handler.deleg));
+
+    const char *uri = getenv("MYSQL_URI");
+    const char *pwd = getenv("MYSQL_PWD");
+    const char *port = getenv("MYSQL_PORT");
+
+    std::string mysql_uri = "mysql://";
+    mysql_uri.append(uri);
+    if (port) {
+      mysql_uri.append(":");
+      mysql_uri.append(port);
+    }
+
+    shcore::Argument_list args;
+    args.push_back(shcore::Value(mysql_uri));
+    if (pwd)
+      args.push_back(shcore::Value(pwd));
+
+    _shell_core->connect_dev_session(args, mysqlsh::SessionType::Classic);
+    _session = std::dynamic_pointer_cast<mysql::ClassicSession>(_shell_core->get_dev_session());
+
+    _dba.reset(new Dba(_shell_core.get()));
+    _md.reset(new MetadataStorage(_dba.get()));
+
+    _options = *shcore::Shell_core_options::get();
+
+    _created_schema = !_md->metadata_schema_exists();
+    if (_created_schema)
+      _md->create_metadata_schema();
+
+    // Unique names so existing metadata is not touched
+    _suffix = std::to_string(getpid());
+    _cluster = "snapshot_test_" + _suffix;
+
+    _md->execute_sql("INSERT INTO mysql_innodb_cluster_metadata.hosts (host_name, location) "
+                     "VALUES ('snapshot_host_" + _suffix + "', '')");
+    _host_id = last_insert_id();
+    _md->execute_sql("INSERT INTO mysql_innodb_cluster_metadata.clusters (cluster_name) VALUES ('" + _cluster + "')");
+    uint64_t cluster_id = last_insert_id();
+    _md->execute_sql("INSERT INTO mysql_innodb_cluster_metadata.replicasets "
+                     "(cluster_id, replicaset_type, replicaset_name, active) "
+                     "VALUES (" + std::to_string(cluster_id) + ", 'gr', 'default', 1)");
+    _replicaset_id = last_insert_id();
+
+    add_instance("first");
+    add_instance("second");
+  }
+
+  virtual void TearDown() {
+    *shcore::Shell_core_options::get() = _options;
+
+    if (_created_schema) {
+      _md->drop_metadata_schema();
+    } else {
+      _md->execute_sql("DELETE FROM mysql_innodb_cluster_metadata.instances "
+                       "WHERE replicaset_id = " + std::to_string(_replicaset_id));
+      _md->execute_sql("DELETE FROM mysql_innodb_cluster_metadata.replicasets "
+                       "WHERE replicaset_id = " + std::to_string(_replicaset_id));
+      _md->execute_sql("DELETE FROM mysql_innodb_cluster_metadata.clusters WHERE cluster_name = '" + _cluster + "'");
+      _md->execute_sql("DELETE FROM mysql_innodb_cluster_metadata.hosts "
+                       "WHERE host_id = " + std::to_string(_host_id));
+    }
+
+    shcore::Argument_list args;
+    _session->close(args);
+  }
+
+  uint64_t last_insert_id() {
+    return _md->execute_sql("SELECT LAST_INSERT_ID()")->fetch_one()->get_value(0).as_uint();
+  }
+
+  void add_instance(const std::string &name) {
+    _md->execute_sql("INSERT INTO mysql_innodb_cluster_metadata.instances "
+                     "(host_id, replicaset_id, mysql_server_uuid, instance_name, role, addresses) "
+                     "VALUES (" + std::to_string(_host_id) + ", " + std::to_string(_replicaset_id) + ", "
+                     "'" + name + "-" + _suffix + "', '" + name + "_" + _suffix + "', 'HA', "
+                     "'{\"mysqlClassic\": \"" + name + ":3306\"}')");
+  }
+
+  // Changes the label of an instance without going through the metadata
+  // storage, as another client would
+  void rename_outside(const std::string &name, const std::string &label) {
+    _session->execute_sql("UPDATE mysql_innodb_cluster_metadata.instances SET instance_name = '" + label + "' "
+                          "WHERE mysql_server_uuid = '" + name + "-" + _suffix + "'");
+  }
+
+  void set_ttl(int ttl) {
+    (*shcore::Shell_core_options::get())[SHCORE_METADATA_CACHE_TTL] = shcore::Value(ttl);
+  }
+
+  Shell_test_output_handler _output_handler;
+  std::shared_ptr<shcore::Shell_core> _shell_core;
+  std::shared_ptr<mysql::ClassicSession> _session;
+  std::shared_ptr<Dba> _dba;
+  std::shared_ptr<MetadataStorage> _md;
+  shcore::Value::Map_type _options;
+  bool _created_schema;
+  std::string _suffix;
+  std::string _cluster;
+  uint64_t _host_id;
+  uint64_t _replicaset_id;
+};
+
+TEST_F(Metadata_snapshot_tests, instances_in_order) {
+  auto snapshot = _md->get_cluster_snapshot(_cluster);
+
+  EXPECT_TRUE(snapshot->cluster_exists);
+  ASSERT_EQ(2U, snapshot->instances.size());
+  EXPECT_EQ("first_" + _suffix, snapshot->instances[0].label);
+  EXPECT_EQ("first:3306", snapshot->instances[0].address);
+  EXPECT_EQ(_replicaset_id, snapshot->instances[0].replicaset_id);
+  EXPECT_EQ("second_" + _suffix, snapshot->instances[1].label);
+
+  // The instances are not members of any group
+  EXPECT_TRUE(snapshot->instances[0].member_state.type == shcore::Null);
+  EXPECT_TRUE(snapshot->instances[1].member_state.type == shcore::Null);
+}
+
+TEST_F(Metadata_snapshot_tests, cluster_not_found) {
+  auto snapshot = _md->get_cluster_snapshot("no_such_cluster_" + _suffix);
+
+  EXPECT_FALSE(snapshot->cluster_exists);
+  EXPECT_TRUE(snapshot->instances.empty());
+}
+
+TEST_F(Metadata_snapshot_tests, no_ttl_reads_again) {
+  set_ttl(0);
+  _md->get_cluster_snapshot(_cluster);
+
+  rename_outside("first", "renamed_" + _suffix);
+  EXPECT_EQ("renamed_" + _suffix, _md->get_cluster_snapshot(_cluster)->instances[0].label);
+}
+
+TEST_F(Metadata_snapshot_tests, ttl_reuses_metadata) {
+  set_ttl(60);
+  auto loaded = _md->get_cluster_snapshot(_cluster);
+
+  rename_outside("first", "renamed_" + _suffix);
+  auto reused = _md->get_cluster_snapshot(_cluster);
+  EXPECT_EQ("first_" + _suffix, reused->instances[0].label);
+
+  // The group state is read again on a copy, the loaded snapshot is not
+  // changed under the caller holding it
+  EXPECT_NE(loaded.get(), reused.get());
+  EXPECT_EQ(loaded->single_primary_mode.type, reused->single_primary_mode.type);
+  EXPECT_EQ(loaded->primary_member, reused->primary_member);
+}
+
+TEST_F(Metadata_snapshot_tests, ttl_expires) {
+  set_ttl(1);
+  _md->get_cluster_snapshot(_cluster);
+
+  rename_outside("first", "renamed_" + _suffix);
+  std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+  EXPECT_EQ("renamed_" + _suffix, _md->get_cluster_snapshot(_cluster)->instances[0].label);
+}
+
+TEST_F(Metadata_snapshot_tests, write_invalidates) {
+  set_ttl(60);
+  _md->get_cluster_snapshot(_cluster);
+
+  // Reads keep the snapshot, a write through the storage discards it
+  _md->execute_sql("SELECT 1");
+  rename_outside("first", "renamed_" + _suffix);
+  EXPECT_EQ("first_" + _suffix, _md->get_cluster_snapshot(_cluster)->instances[0].label);
+
+  add_instance("third");
+  auto snapshot = _md->get_cluster_snapshot(_cluster);
+  ASSERT_EQ(3U, snapshot->instances.size());
+  EXPECT_EQ("renamed_" + _suffix, snapshot->instances[0].label);
+  EXPECT_EQ("third_" + _suffix, snapshot->instances[2].label);
+}
+
+}  // namespace metadata_storage_tests
+}  // namespace dba
+}  // namespace mysqlsh
@@ -0,0 +1,143 @@
+/* Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; version 2 of the License.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "modules/adminapi/mod_dba_common.h"
+
+namespace mysqlsh {
+namespace dba {
+namespace probe_tests {
+
+static std::vector<std::string> addresses(int count) {
+  std::vector<std::string> ret_val;
+  for (int index = 0; index < count; index++)
+    ret_val.push_back("host" + std::to_string(index) + ":3306");
+  return ret_val;
+}
+
+TEST(Instance_probe_tests, results_in_order) {
+  std::vector<InstanceProbe> probes = probe_instances(addresses(9), [](const std::string &address) {
+    // The later instances answer first
+    int index = std::stoi(address.substr(4));
+    std::this_thread::sleep_for(std::chrono::milliseconds((9 - index) * 5));
+    if (index % 4 == 1)
+      throw std::runtime_error("Can't connect to MySQL server on '" + address + "'");
+    return shcore::Value("value of " + address);
+  }, 4);
+
+  ASSERT_EQ(9u, probes.size());
+  for (size_t index = 0; index < probes.size(); index++) {
+    std::string address = "host" + std::to_string(index) + ":3306";
+    EXPECT_EQ(address, probes[index].address);
+    if (index % 4 == 1) {
+      EXPECT_EQ(shcore::Undefined, probes[index].value.type);
+      EXPECT_EQ("Can't connect to MySQL server on '" + address + "'", probes[index].error);
+    } else {
+      EXPECT_EQ("value of " + address, probes[index].value.as_string());
+      EXPECT_EQ("", probes[index].error);
+    }
+
+    // Each probe reports its own latency
+    EXPECT_GE(probes[index].elapsed.count(), static_cast<long>((9 - index) * 5));
+  }
+
+  EXPECT_TRUE(probe_instances(std::vector<std::string>(), [](const std::string &) {
+    return shcore::Value();
+  }).empty());
+}
+
+TEST(Instance_probe_tests, bounded_threads) {
+  std::shared_ptr<std::atomic<int>> running(new std::atomic<int>(0));
+  std::shared_ptr<std::atomic<int>> most(new std::atomic<int>(0));
+
+  std::vector<InstanceProbe> probes = probe_instances(addresses(12), [running, most](const std::string &) {
+    int now = ++*running;
+    int seen = most->load();
+    while (now > seen && !most->compare_exchange_weak(seen, now));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    --*running;
+    return shcore::Value("ok");
+  }, 3);
+
+  EXPECT_EQ(12u, probes.size());
+  EXPECT_LE(most->load(), 3);
+  EXPECT_GT(most->load(), 1);
+}
+
+// Unreachable instances wait for their connect timeout at the same time, and
+// no more than the deadline
+TEST(Instance_probe_tests, deadline) {
+  // The hung probes only return once released, after probe_instances()
+  std::shared_ptr<std::atomic<bool>> released(new std::atomic<bool>(false));
+
+  std::vector<InstanceProbe> probes = probe_instances(addresses(9), [released](const std::string &address) {
+    if (address == "host3:3306" || address == "host7:3306") {
+      while (!released->load())
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return shcore::Value("ok");
+  }, 9, std::chrono::milliseconds(1000));
+  released->store(true);
+
+  ASSERT_EQ(9u, probes.size());
+  for (size_t index = 0; index < probes.size(); index++) {
+    if (index == 3 || index == 7) {
+      EXPECT_EQ(shcore::Undefined, probes[index].value.type);
+      EXPECT_EQ("Timeout probing the instance after 1 seconds", probes[index].error);
+      EXPECT_EQ(1000, probes[index].elapsed.count());
+    } else {
+      EXPECT_EQ("ok", probes[index].value.as_string());
+      EXPECT_EQ("", probes[index].error);
+    }
+  }
+}
+
+// The instances not probed yet when the deadline hits are never probed
+TEST(Instance_probe_tests, nothing_started_after_deadline) {
+  std::shared_ptr<std::atomic<bool>> released(new std::atomic<bool>(false));
+  std::shared_ptr<std::atomic<int>> started(new std::atomic<int>(0));
+  std::shared_ptr<std::atomic<int>> running(new std::atomic<int>(0));
+
+  std::vector<InstanceProbe> probes = probe_instances(addresses(5), [released, started, running](const std::string &) {
+    ++*started;
+    ++*running;
+    while (!released->load())
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    --*running;
+    return shcore::Value("ok");
+  }, 2, std::chrono::milliseconds(100));
+
+  ASSERT_EQ(5u, probes.size());
+  for (auto &probe : probes)
+    EXPECT_EQ("Timeout probing the instance after 100 ms", probe.error);
+
+  // Once the running probes finish their threads stop
+  released->store(true);
+  while (running->load())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_LE(started->load(), 2);
+}
+
+}  // namespace probe_tests
+}  // namespace dba
+}  // namespace mysqlsh
@@ -0,0 +1,150 @@
+/* Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; version 2 of the License.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "gtest/gtest.h"
+#include "modules/adminapi/mod_dba_provisioning_interface.h"
+
+namespace mysqlsh {
+namespace dba {
+namespace provisioning_tests {
+
+#ifndef _WIN32
+// Stands for mysqlprovision running as a worker: answers each command with a
+// warning holding its process id and the exit code, and dies on the commands
+// having "die" as the password
+static const char *k_worker_script =
+    "#!/bin/sh\n"
+    "[ \"$1\" = \"--worker\" ] || exit 4\n"
+    "while read -r line; do\n"
+    "  echo \"{\\\"type\\\": \\\"WARNING\\\", \\\"msg\\\": \\\"$$\\\"}\"\n"
+    "  case \"$line\" in *'\"die'*) exit 3;; esac\n"
+    "  echo '{\"type\": \"EXIT\", \"exit_code\": 0}'\n"
+    "done\n";
+
+class Provisioning_worker_tests : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    _script = "/tmp/mysqlprovision_worker_" + std::to_string(getpid());
+    std::ofstream file(_script.c_str());
+    file << script();
+    file.close();
+    chmod(_script.c_str(), 0700);
+
+    _options = *shcore::Shell_core_options::get();
+    (*shcore::Shell_core_options::get())[SHCORE_GADGETS_PATH] = shcore::Value(_script);
+    (*shcore::Shell_core_options::get())[SHCORE_PROVISIONING_WORKER] = shcore::Value::True();
+  }
+
+  virtual void TearDown() {
+    *shcore::Shell_core_options::get() = _options;
+    std::remove(_script.c_str());
+  }
+
+  virtual std::string script() {
+    return k_worker_script;
+  }
+
+  // The process id the worker reported, or the exit code when it failed
+  std::string check(ProvisioningInterface &mp, const std::string &password) {
+    shcore::Value::Array_type_ref errors;
+    shcore::Value::Map_type_ref ssl(new shcore::Value::Map_type());
+    int exit_code = mp.check("root", "localhost", 3306, password, ssl, "", false, errors);
+    if (exit_code)
+      return "exit " + std::to_string(exit_code);
+
+    EXPECT_TRUE(errors && errors->size() == 1);
+    return errors ? (*errors)[0].as_map()->get_string("msg") : "";
+  }
+
+  std::string _script;
+  shcore::Value::Map_type _options;
+  shcore::Interpreter_delegate _delegate;
+};
+
+TEST_F(Provisioning_worker_tests, reuse_and_restart) {
+  ProvisioningInterface mp(&_delegate);
+
+  // The commands run on the same process
+  std::string worker = check(mp, "secret");
+  EXPECT_EQ(std::to_string(std::stoi(worker)), worker);
+  EXPECT_EQ(worker, check(mp, "secret"));
+
+  // A worker dying on a command gives its exit code, the next command starts
+  // a new one
+  EXPECT_EQ("exit 3", check(mp, "die"));
+  std::string restarted = check(mp, "secret");
+  EXPECT_NE(worker, restarted);
+  EXPECT_EQ(restarted, check(mp, "secret"));
+}
+
+// Runs the commands on the worker loop of mysqlprovision itself, which needs
+// a python with Connector/Python: the tests do nothing without one
+class Provisioning_python_worker_tests : public Provisioning_worker_tests {
+protected:
+  static void SetUpTestCase() {
+    _has_python = std::system("python -c 'import mysql.connector' >/dev/null 2>&1") == 0;
+  }
+
+  virtual std::string script() {
+    // No bytecode is written, so the source tree is left as it is
+    std::string python_home = std::string(MYSQLX_SOURCE_HOME) + "/python";
+    return "#!/bin/sh\n"
+           "PYTHONDONTWRITEBYTECODE=1 "
+           "PYTHONPATH=" + python_home + "${PYTHONPATH:+:$PYTHONPATH} "
+           "exec python " + python_home + "/front_end/mysqlprovision.py \"$@\"\n";
+  }
+
+  static bool _has_python;
+};
+
+bool Provisioning_python_worker_tests::_has_python = false;
+
+TEST_F(Provisioning_python_worker_tests, commands_on_worker) {
+  if (!_has_python) {
+    std::cout << "Skipped: no python with Connector/Python found" << std::endl;
+    return;
+  }
+
+  ProvisioningInterface mp(&_delegate);
+  shcore::Value::Map_type_ref ssl(new shcore::Value::Map_type());
+
+  // Nothing listens on port 1: each command reads the password from its own
+  // input and ends on a SystemExit, whose code is given back while the worker
+  // goes on with the next command
+  for (int attempt = 0; attempt < 3; attempt++) {
+    shcore::Value::Array_type_ref errors;
+    EXPECT_EQ(1, mp.check("root", "127.0.0.1", 1, "secret", ssl, "", false, errors));
+
+    ASSERT_TRUE(errors && !errors->empty());
+    std::string msg = errors->back().as_map()->get_string("msg");
+    EXPECT_NE(std::string::npos, msg.find("Can't connect")) << msg;
+  }
+}
+#endif
+
+}  // namespace provisioning_tests
+}  // namespace dba
+}  // namespace mysqlsh
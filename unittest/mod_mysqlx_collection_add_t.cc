@@ -0,0 +1,80 @@
+/* Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; version 2 of the License.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "ngs_common/protocol_protobuf.h"
+#include "shellcore/types.h"
+#include "mysqlxtest/common/expr_parser.h"
+#include "../modules/mod_mysqlx_collection_add.h"
+
+namespace mysqlsh {
+namespace collection_add_tests {
+
+static shcore::Value build_document(int index) {
+  shcore::Value::Map_type_ref address(new shcore::Value::Map_type());
+  (*address)["street"] = shcore::Value("Main Street " + std::to_string(index));
+  (*address)["zip"] = shcore::Value(10000 + index);
+
+  shcore::Value::Array_type_ref tags(new shcore::Value::Array_type());
+  tags->push_back(shcore::Value("first"));
+  tags->push_back(shcore::Value(true));
+  tags->push_back(shcore::Value::Null());
+
+  shcore::Value::Map_type_ref document(new shcore::Value::Map_type());
+  (*document)["_id"] = shcore::Value("00000000000000000000000000" + std::to_string(100000 + index));
+  (*document)["name"] = shcore::Value("Document \"number\" " + std::to_string(index));
+  (*document)["count"] = shcore::Value(index);
+  (*document)["balance"] = shcore::Value(-index);
+  (*document)["ratio"] = shcore::Value(index + 0.5);
+  (*document)["active"] = shcore::Value(index % 2 == 0);
+  (*document)["address"] = shcore::Value(address);
+  (*document)["tags"] = shcore::Value(tags);
+
+  return shcore::Value(document);
+}
+
+static Mysqlx::Expr::Expr *parse_document(const shcore::Value &document) {
+  ::mysqlx::Expr_parser parser(document.json(), true);
+  return parser.expr();
+}
+
+// The direct conversion must produce the same expression the server got when
+// the document was serialized to JSON and parsed
+TEST(Collection_add_tests, convert_document) {
+  for (int index = 0; index < 10; index++) {
+    shcore::Value document = build_document(index);
+
+    std::unique_ptr<Mysqlx::Expr::Expr> parsed(parse_document(document));
+    std::unique_ptr<Mysqlx::Expr::Expr> converted(mysqlx::CollectionAdd::convert_document(document));
+
+    EXPECT_EQ(parsed->DebugString(), converted->DebugString());
+  }
+
+  // Integers out of the 32 bit range are kept as they are
+  shcore::Value::Map_type_ref document(new shcore::Value::Map_type());
+  (*document)["big"] = shcore::Value(static_cast<int64_t>(1) << 40);
+  (*document)["unsigned"] = shcore::Value(static_cast<uint64_t>(-1));
+  std::unique_ptr<Mysqlx::Expr::Expr> converted(mysqlx::CollectionAdd::convert_document(shcore::Value(document)));
+
+  ASSERT_EQ(2, converted->object().fld_size());
+  EXPECT_EQ(static_cast<uint64_t>(1) << 40, converted->object().fld(0).value().literal().v_unsigned_int());
+  EXPECT_EQ(static_cast<uint64_t>(-1), converted->object().fld(1).value().literal().v_unsigned_int());
+}
+
+}  // namespace collection_add_tests
+}  // namespace mysqlsh
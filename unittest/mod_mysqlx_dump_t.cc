@@ -0,0 +1,138 @@
+/* Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; version 2 of the License.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "shellcore/types.h"
+#include "../modules/mod_mysqlx_dump.h"
+#include "../modules/mod_mysqlx_import.h"
+
+namespace mysqlsh {
+namespace dump_tests {
+
+TEST(Dumper_tests, encode_file_name) {
+  EXPECT_EQ("my_table-1", mysqlx::Dumper::encode_file_name("my_table-1"));
+  EXPECT_EQ("a%2Fb%40c%20d", mysqlx::Dumper::encode_file_name("a/b@c d"));
+  EXPECT_EQ("%C3%B1", mysqlx::Dumper::encode_file_name("\xC3\xB1"));
+}
+
+TEST(Dumper_tests, split_range) {
+  auto ranges = mysqlx::Dumper::split_range(1, 10, 3);
+  ASSERT_EQ(3, static_cast<int>(ranges.size()));
+  EXPECT_EQ(1u, ranges[0].first);
+  EXPECT_EQ(4u, ranges[0].second);
+  EXPECT_EQ(5u, ranges[1].first);
+  EXPECT_EQ(7u, ranges[1].second);
+  EXPECT_EQ(8u, ranges[2].first);
+  EXPECT_EQ(10u, ranges[2].second);
+
+  // Never more ranges than values
+  ranges = mysqlx::Dumper::split_range(5, 6, 10);
+  ASSERT_EQ(2, static_cast<int>(ranges.size()));
+  EXPECT_EQ(5u, ranges[0].second);
+  EXPECT_EQ(6u, ranges[1].first);
+
+  // The whole 64 bit range is covered without overflowing
+  const uint64_t max = static_cast<uint64_t>(-1);
+  ranges = mysqlx::Dumper::split_range(0, max, 4);
+  ASSERT_EQ(4, static_cast<int>(ranges.size()));
+  EXPECT_EQ(0u, ranges[0].first);
+  for (size_t index = 1; index < ranges.size(); index++)
+    EXPECT_EQ(ranges[index - 1].second + 1, ranges[index].first);
+  EXPECT_EQ(max, ranges[3].second);
+
+  EXPECT_TRUE(mysqlx::Dumper::split_range(2, 1, 4).empty());
+}
+
+// Every field written by the dumper must be read back as it was
+TEST(Dumper_tests, append_field) {
+  std::vector<std::string> fields = {"plain", "", "with,comma", "\"quoted\"", "two\nlines", "cr\r", "\\N",
+                                     std::string("bin\0ary", 7)};
+
+  std::string line;
+  for (auto &field : fields) {
+    if (!line.empty())
+      line.push_back(',');
+    mysqlx::Dumper::append_field(&line, field.data(), field.size());
+  }
+  line.append(",\\N\n");
+
+  std::stringstream stream(line);
+  mysqlx::Csv_reader reader(stream);
+  std::vector<shcore::Value> record;
+  ASSERT_TRUE(reader.next(&record));
+  ASSERT_EQ(fields.size() + 1, record.size());
+  for (size_t index = 0; index < fields.size(); index++)
+    EXPECT_EQ(fields[index], record[index].as_string());
+  EXPECT_EQ(shcore::Null, record[fields.size()].type);
+  EXPECT_FALSE(reader.next(&record));
+}
+
+// The rows of a single column table holding empty strings are not lost when
+// the dump is loaded
+TEST(Dumper_tests, empty_field_round_trip) {
+  std::vector<std::string> rows = {"first", "", "", "last", ""};
+
+  std::string dump;
+  for (auto &row : rows) {
+    mysqlx::Dumper::append_field(&dump, row.data(), row.size());
+    dump.push_back('\n');
+  }
+
+  std::stringstream stream(dump);
+  mysqlx::Csv_reader reader(stream);
+  std::vector<shcore::Value> record;
+  for (auto &row : rows) {
+    ASSERT_TRUE(reader.next(&record));
+    ASSERT_EQ(1u, record.size());
+    EXPECT_EQ(row, record[0].as_string());
+  }
+  EXPECT_FALSE(reader.next(&record));
+  EXPECT_EQ(rows.size(), reader.records());
+}
+
+TEST(Dumper_tests, gzip_buffer) {
+  if (!mysqlx::Gzip_buffer::is_available())
+    return;
+
+  std::string path = "dumper_tests_gzip_buffer.csv.gz";
+  std::string data;
+  for (int index = 0; index < 100000; index++)
+    data.append(std::to_string(index)).append(",value\n");
+
+  mysqlx::Gzip_buffer output;
+  ASSERT_TRUE(output.open(path, "wb"));
+  std::ostream output_stream(&output);
+  output_stream.write(data.data(), data.size());
+  EXPECT_TRUE(output.close());
+
+  mysqlx::Gzip_buffer input;
+  ASSERT_TRUE(input.open(path, "rb"));
+  std::istream input_stream(&input);
+  std::stringstream read;
+  read << input_stream.rdbuf();
+  EXPECT_TRUE(input.close());
+
+  EXPECT_EQ(data, read.str());
+
+  std::remove(path.c_str());
+}
+
+}  // namespace dump_tests
+}  // namespace mysqlsh
@@ -0,0 +1,94 @@
+/* Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; version 2 of the License.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "shellcore/types.h"
+#include "../modules/mod_mysqlx_import.h"
+
+namespace mysqlsh {
+namespace import_tests {
+
+static std::vector<std::vector<shcore::Value> > read_all(const std::string &data, char separator = ',') {
+  std::stringstream stream(data);
+  mysqlx::Csv_reader reader(stream, separator);
+
+  std::vector<std::vector<shcore::Value> > records;
+  std::vector<shcore::Value> record;
+  while (reader.next(&record))
+    records.push_back(record);
+
+  EXPECT_EQ(records.size(), reader.records());
+
+  return records;
+}
+
+TEST(Csv_reader_tests, plain_fields) {
+  auto records = read_all("id,name\n1,John\r\n\n2,Jane");
+
+  ASSERT_EQ(3, static_cast<int>(records.size()));
+  EXPECT_EQ("id", records[0][0].as_string());
+  EXPECT_EQ("name", records[0][1].as_string());
+  EXPECT_EQ("John", records[1][1].as_string());
+  EXPECT_EQ("2", records[2][0].as_string());
+  EXPECT_EQ("Jane", records[2][1].as_string());
+}
+
+TEST(Csv_reader_tests, quoted_fields) {
+  auto records = read_all("1,\"Doe, John\",\"say \"\"hi\"\"\"\n2,\"two\nlines\",\"\"\n");
+
+  ASSERT_EQ(2, static_cast<int>(records.size()));
+  EXPECT_EQ("Doe, John", records[0][1].as_string());
+  EXPECT_EQ("say \"hi\"", records[0][2].as_string());
+  EXPECT_EQ("two\nlines", records[1][1].as_string());
+  EXPECT_EQ("", records[1][2].as_string());
+}
+
+TEST(Csv_reader_tests, blank_lines) {
+  // Only the lines without quotes nor separators are blank
+  auto records = read_all("\n\"\"\n\r\n,\n\"\"");
+
+  ASSERT_EQ(3, static_cast<int>(records.size()));
+  ASSERT_EQ(1, static_cast<int>(records[0].size()));
+  EXPECT_EQ("", records[0][0].as_string());
+  ASSERT_EQ(2, static_cast<int>(records[1].size()));
+  EXPECT_EQ("", records[1][1].as_string());
+  ASSERT_EQ(1, static_cast<int>(records[2].size()));
+  EXPECT_EQ("", records[2][0].as_string());
+}
+
+TEST(Csv_reader_tests, null_fields) {
+  auto records = read_all("1\t\\N\t\"\\N\"\t\n", '\t');
+
+  ASSERT_EQ(1, static_cast<int>(records.size()));
+  ASSERT_EQ(4, static_cast<int>(records[0].size()));
+  EXPECT_EQ(shcore::Null, records[0][1].type);
+  EXPECT_EQ("\\N", records[0][2].as_string());
+  EXPECT_EQ("", records[0][3].as_string());
+}
+
+TEST(Csv_reader_tests, unterminated_quote) {
+  std::stringstream stream("1,\"open\n2,3\n");
+  mysqlx::Csv_reader reader(stream);
+  std::vector<shcore::Value> record;
+
+  EXPECT_THROW(reader.next(&record), shcore::Exception);
+}
+
+}  // namespace import_tests
+}  // namespace mysqlsh
@@ -0,0 +1,171 @@
+/* Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; version 2 of the License.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngs_common/protocol_protobuf.h"
+#include "mysqlxtest/mysqlx_crud.h"
+
+namespace mysqlx {
+namespace crud_statement_tests {
+
+// Gives access to the message and its encoding, which execute() sends
+class Test_find : public FindStatement {
+public:
+  Test_find(std::shared_ptr<Collection> coll, const std::string &searchCondition)
+    : FindStatement(coll, searchCondition) {}
+
+  const std::string &encoded() {
+    return encode(*m_find, Mysqlx::Crud::Find::kArgsFieldNumber, "FindStatement");
+  }
+
+  const Mysqlx::Crud::Find &message() const { return *m_find; }
+};
+
+class Test_select : public SelectStatement {
+public:
+  Test_select(std::shared_ptr<Table> table, const std::vector<std::string> &fieldList)
+    : SelectStatement(table, fieldList) {}
+
+  const std::string &encoded() {
+    return encode(*m_find, Mysqlx::Crud::Find::kArgsFieldNumber, "SelectStatement");
+  }
+
+  const Mysqlx::Crud::Find &message() const { return *m_find; }
+};
+
+// Collections and tables only keep a weak reference to their schema
+static std::shared_ptr<Schema> test_schema() {
+  static std::shared_ptr<Schema> schema(new Schema(std::shared_ptr<Session>(), "test"));
+  return schema;
+}
+
+// The message the statement sent before, with the arguments on it
+static std::string full_message(const Mysqlx::Crud::Find &message, const std::vector<std::string> &ids) {
+  Mysqlx::Crud::Find find(message);
+  for (std::vector<std::string>::const_iterator id = ids.begin(); id != ids.end(); ++id) {
+    Mysqlx::Datatypes::Scalar *arg = find.mutable_args()->Add();
+    arg->set_type(Mysqlx::Datatypes::Scalar::V_STRING);
+    arg->mutable_v_string()->set_value(*id);
+  }
+  return find.SerializeAsString();
+}
+
+static std::string parsed(const std::string &payload) {
+  Mysqlx::Crud::Find find;
+  EXPECT_TRUE(find.ParseFromString(payload));
+  return find.SerializeAsString();
+}
+
+TEST(Crud_statement_tests, rebind_and_reencode) {
+  std::shared_ptr<Collection> coll(new Collection(test_schema(), "docs"));
+  Test_find find(coll, "_id = :id or parent = :id2");
+  find.limit(1);
+
+  EXPECT_THROW(find.encoded(), std::logic_error);
+
+  find.bind("id", DocumentValue(std::string("first")));
+  try {
+    find.encoded();
+    FAIL() << "Missing binding not reported";
+  } catch (const std::logic_error &e) {
+    EXPECT_STREQ("Missing value bindings for the next placeholders: id2", e.what());
+  }
+
+  find.bind("id2", DocumentValue(std::string("root")));
+  EXPECT_EQ(full_message(find.message(), {"first", "root"}), parsed(find.encoded()));
+
+  // Only the bound values change between executions
+  find.bind("id", DocumentValue(std::string("second")));
+  EXPECT_EQ(full_message(find.message(), {"second", "root"}), parsed(find.encoded()));
+  EXPECT_EQ(full_message(find.message(), {"second", "root"}), parsed(find.encoded()));
+
+  // Changing the statement discards the encoded message
+  find.skip(10);
+  EXPECT_EQ(10u, find.message().limit().offset());
+  EXPECT_EQ(full_message(find.message(), {"second", "root"}), parsed(find.encoded()));
+
+  // Copies share the message and its encoding, but not the bound values
+  Test_find copy(find);
+  copy.bind("id", DocumentValue(std::string("third")));
+  EXPECT_EQ(full_message(find.message(), {"third", "root"}), parsed(copy.encoded()));
+  EXPECT_EQ(full_message(find.message(), {"second", "root"}), parsed(find.encoded()));
+
+  EXPECT_THROW(find.bind("unknown", DocumentValue(std::string("value"))), std::logic_error);
+}
+
+TEST(Crud_statement_tests, no_placeholders) {
+  std::shared_ptr<Table> table(new Table(test_schema(), "rows"));
+  Test_select select(table, {"name", "age"});
+  select.where("age > 10").limit(5);
+
+  EXPECT_EQ(select.message().SerializeAsString(), select.encoded());
+  EXPECT_EQ(select.message().SerializeAsString(), select.encoded());
+}
+
+// Executes/sec of a point lookup: the encoding done on each execute() before,
+// with the bound values on the message, against the reused encoding. Only
+// prints the rates, run it with --gtest_also_run_disabled_tests
+TEST(Crud_statement_tests, DISABLED_point_lookup_performance) {
+  const int count = 200000;
+  std::shared_ptr<Collection> coll(new Collection(test_schema(), "docs"));
+
+  std::vector<std::string> ids;
+  for (int index = 0; index < 100; index++)
+    ids.push_back("0000000000000000000000" + std::to_string(100000 + index));
+
+  Test_find find(coll, "_id = :id");
+  find.fields("{'_id': _id, 'name': name, 'address': address.street}");
+  size_t bytes = 0;
+
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  Mysqlx::Crud::Find message(find.message());
+  for (int index = 0; index < count; index++) {
+    find.bind("id", DocumentValue(ids[index % ids.size()]));
+
+    Mysqlx::Datatypes::Scalar *arg = new Mysqlx::Datatypes::Scalar();
+    arg->set_type(Mysqlx::Datatypes::Scalar::V_STRING);
+    arg->mutable_v_string()->set_value(ids[index % ids.size()]);
+    message.mutable_args()->Clear();
+    message.mutable_args()->AddAllocated(arg);
+    ASSERT_TRUE(message.IsInitialized());
+
+    std::string payload;
+    message.SerializeToString(&payload);
+    bytes += payload.size();
+  }
+  double full_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+  start = std::chrono::high_resolution_clock::now();
+  for (int index = 0; index < count; index++) {
+    find.bind("id", DocumentValue(ids[index % ids.size()]));
+    bytes -= find.encoded().size();
+  }
+  double encoded_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+  std::cout << "full message: " << static_cast<uint64_t>(count / full_seconds) << " executes/sec" << std::endl;
+  std::cout << "encoded message: " << static_cast<uint64_t>(count / encoded_seconds) << " executes/sec" << std::endl;
+
+  // Both encode the same messages
+  EXPECT_EQ(0u, bytes);
+}
+
+}  // namespace crud_statement_tests
+}  // namespace mysqlx
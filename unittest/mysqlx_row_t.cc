@@ -0,0 +1,230 @@
+/* Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; version 2 of the License.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "ngs_common/protocol_protobuf.h"
+#include "mysqlx.h"
+#include "mysqlx_connection.h"
+#include "mysqlx_row.h"
+#include "mysqlx_resultset.pb.h"
+
+namespace mysqlx {
+namespace row_tests {
+
+// 1000 rows holding the numbers from 0 to 999 in order
+static const int k_rows = 1000;
+static const char *k_rows_query =
+    "select a.d * 100 + b.d * 10 + c.d as n, 'some string column value' as s from "
+    "(select 0 d union all select 1 union all select 2 union all select 3 union all select 4 union all "
+    " select 5 union all select 6 union all select 7 union all select 8 union all select 9) a, "
+    "(select 0 d union all select 1 union all select 2 union all select 3 union all select 4 union all "
+    " select 5 union all select 6 union all select 7 union all select 8 union all select 9) b, "
+    "(select 0 d union all select 1 union all select 2 union all select 3 union all select 4 union all "
+    " select 5 union all select 6 union all select 7 union all select 8 union all select 9) c "
+    "order by n";
+
+// The rows are decoded into the message and field strings of the previous
+// row when it was released, which is seen on the field data staying at the
+// same address
+class Mysqlx_row_tests : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    const char *uri = getenv("MYSQL_URI");
+    const char *pwd = getenv("MYSQL_PWD");
+    const char *port = getenv("MYSQLX_PORT");
+
+    std::string xuri = "mysqlx://";
+    xuri.append(uri);
+    if (port) {
+      xuri.append(":");
+      xuri.append(port);
+    }
+
+    _session = openSession(xuri, pwd ? pwd : "", Ssl_config(), false, 60000);
+  }
+
+  virtual void TearDown() {
+    _session->close();
+  }
+
+  // Reads the remaining rows of the result, keeping them referenced when
+  // hold_rows is set, and gives the addresses of their string field data
+  std::set<const char *> read_rows(std::shared_ptr<Result> result, int first, bool hold_rows) {
+    std::vector<std::shared_ptr<Row> > rows;
+    std::set<const char *> buffers;
+
+    // next() decodes through read_row(), the row is released before reading
+    // the next one unless it is held
+    int expected = first;
+    for (;;) {
+      std::shared_ptr<Row> row(result->next());
+      if (!row)
+        break;
+
+      EXPECT_EQ(expected++, row->sInt64Field(0));
+      size_t length;
+      buffers.insert(row->stringField(1, length));
+      if (hold_rows)
+        rows.push_back(row);
+    }
+
+    EXPECT_EQ(k_rows, expected);
+
+    return buffers;
+  }
+
+  std::shared_ptr<Session> _session;
+};
+
+TEST_F(Mysqlx_row_tests, row_reused_when_released) {
+  std::shared_ptr<Result> result = _session->executeSql(k_rows_query);
+
+  // The first row allocates the message and fields reused for the rest
+  size_t length;
+  std::shared_ptr<Row> row = result->next();
+  EXPECT_EQ(0, row->sInt64Field(0));
+  const char *buffer = row->stringField(1, length);
+  Row *first = row.get();
+  row.reset();
+
+  row = result->next();
+  EXPECT_EQ(first, row.get());
+  row.reset();
+
+  std::set<const char *> buffers = read_rows(result, 2, false);
+  ASSERT_EQ(1u, buffers.size());
+  EXPECT_EQ(buffer, *buffers.begin());
+}
+
+TEST_F(Mysqlx_row_tests, row_not_reused_when_held) {
+  std::shared_ptr<Result> result = _session->executeSql(k_rows_query);
+  std::shared_ptr<Row> first = result->next();
+  EXPECT_EQ(0, first->sInt64Field(0));
+  size_t length;
+  const char *buffer = first->stringField(1, length);
+
+  // Every row still referenced by the caller gets its own message and fields
+  std::set<const char *> buffers = read_rows(result, 1, true);
+  EXPECT_EQ(static_cast<size_t>(k_rows - 1), buffers.size());
+  EXPECT_EQ(0u, buffers.count(buffer));
+
+  // The rows held keep their values
+  EXPECT_EQ(0, first->sInt64Field(0));
+  EXPECT_EQ(buffer, first->stringField(1, length));
+}
+
+// Builds a stream of length prefixed row frames like the ones coming from the
+// server, each row having an int, a double and a string field
+static std::vector<char> build_row_stream(int rows, std::vector<std::size_t> *offsets) {
+  std::vector<char> stream;
+
+  for (int index = 0; index < rows; index++) {
+    Mysqlx::Resultset::Row row;
+    std::string field;
+
+    google::protobuf::io::StringOutputStream raw(&field);
+    {
+      google::protobuf::io::CodedOutputStream out(&raw);
+      out.WriteVarint64(google::protobuf::internal::WireFormatLite::ZigZagEncode64(index));
+    }
+    row.add_field(field);
+
+    field.clear();
+    {
+      google::protobuf::io::StringOutputStream raw_double(&field);
+      google::protobuf::io::CodedOutputStream out(&raw_double);
+      out.WriteLittleEndian64(google::protobuf::internal::WireFormatLite::EncodeDouble(index * 0.5));
+    }
+    row.add_field(field);
+
+    field = "some string column value of a regular length";
+    field.push_back('\0');
+    row.add_field(field);
+
+    std::string payload;
+    row.SerializeToString(&payload);
+
+    uint32_t length = static_cast<uint32_t>(payload.size());
+    offsets->push_back(stream.size());
+    stream.insert(stream.end(), reinterpret_cast<char*>(&length), reinterpret_cast<char*>(&length) + sizeof(length));
+    stream.insert(stream.end(), payload.begin(), payload.end());
+  }
+
+  return stream;
+}
+
+static uint32_t frame_length(const std::vector<char> &stream, std::size_t offset) {
+  uint32_t length;
+  std::memcpy(&length, &stream[offset], sizeof(length));
+  return length;
+}
+
+static void print_rate(const char *label, int rows, std::chrono::high_resolution_clock::duration elapsed) {
+  double seconds = std::chrono::duration<double>(elapsed).count();
+  std::cout << label << ": " << static_cast<uint64_t>(seconds > 0 ? rows / seconds : 0) << " rows/sec" << std::endl;
+}
+
+// Rows/sec of the old decode path (payload copied into a new buffer and a
+// std::string, new message per row) against parsing in place into a reused
+// row. Only prints the rates, run it with --gtest_also_run_disabled_tests
+TEST(Mysqlx_row_decode_tests, DISABLED_decode_from_buffer) {
+  const int rows = 200000;
+  std::vector<std::size_t> offsets;
+  std::vector<char> stream = build_row_stream(rows, &offsets);
+
+  double copy_total = 0;
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for (std::size_t index = 0; index < offsets.size(); index++) {
+    uint32_t length = frame_length(stream, offsets[index]);
+    char *mbuf = new char[length];
+    std::memcpy(mbuf, &stream[offsets[index] + sizeof(length)], length);
+
+    Mysqlx::Resultset::Row *row = new Mysqlx::Resultset::Row();
+    row->ParseFromString(std::string(mbuf, length));
+
+    copy_total += Row_decoder::double_from_buffer(row->field(1));
+    delete row;
+    delete[] mbuf;
+  }
+  print_rate("copy and parse", rows, std::chrono::high_resolution_clock::now() - start);
+
+  double reuse_total = 0;
+  std::unique_ptr<Mysqlx::Resultset::Row> row(new Mysqlx::Resultset::Row());
+  start = std::chrono::high_resolution_clock::now();
+  for (std::size_t index = 0; index < offsets.size(); index++) {
+    uint32_t length = frame_length(stream, offsets[index]);
+
+    row->Clear();
+    ASSERT_TRUE(row->ParseFromArray(&stream[offsets[index] + sizeof(length)], static_cast<int>(length)));
+
+    EXPECT_EQ(static_cast<int64_t>(index), Row_decoder::s64_from_buffer(row->field(0)));
+    reuse_total += Row_decoder::double_from_buffer(row->field(1));
+  }
+  print_rate("parse in place", rows, std::chrono::high_resolution_clock::now() - start);
+
+  EXPECT_EQ(copy_total, reuse_total);
+}
+
+}  // namespace row_tests
+}  // namespace mysqlx
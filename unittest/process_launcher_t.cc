@@ -0,0 +1,174 @@
+/* Copyright (c) 2017, Oracle and/or its affiliates. All rights reserved.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; version 2 of the License.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include <algorithm>
+#include <csignal>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "common/process_launcher/process_launcher.h"
+
+namespace ngcommon {
+namespace process_launcher_tests {
+
+static std::vector<std::string> split(const std::string &output, size_t chunk_size, std::string *preamble,
+                                      std::string *remaining) {
+  Json_record_splitter splitter;
+  std::vector<std::string> records;
+  std::string record;
+
+  for (size_t offset = 0; offset < output.size(); offset += chunk_size) {
+    splitter.append(output.data() + offset, std::min(chunk_size, output.size() - offset));
+
+    std::string text;
+    if (splitter.take_preamble(&text))
+      *preamble += text;
+
+    while (splitter.next_record(&record))
+      records.push_back(record);
+  }
+
+  *remaining = splitter.remaining();
+  return records;
+}
+
+TEST(Process_launcher_tests, json_record_splitter) {
+  const std::string output = "Enter the password: {\"type\": \"INFO\",\r\n"
+                             "\"msg\": \"first\"}\r\n"
+                             "{\"type\": \"DEBUG\", \"msg\": \"{second}\"}\n"
+                             "Not a record\n"
+                             "{\"type\": \"ERROR\", \"msg\": \"third\"}\n"
+                             "{\"type\": ";
+
+  // The records are the same whatever the output is split on
+  for (size_t chunk_size : {1, 2, 7, 4096}) {
+    std::string preamble, remaining;
+    std::vector<std::string> records = split(output, chunk_size, &preamble, &remaining);
+
+    ASSERT_EQ(3u, records.size());
+    EXPECT_EQ("{\"type\": \"INFO\",\r\n\"msg\": \"first\"}\r", records[0]);
+    EXPECT_EQ("{\"type\": \"DEBUG\", \"msg\": \"{second}\"}", records[1]);
+    EXPECT_EQ("Not a record\n{\"type\": \"ERROR\", \"msg\": \"third\"}", records[2]);
+    EXPECT_EQ("Enter the password: ", preamble);
+    EXPECT_EQ("{\"type\": ", remaining);
+  }
+
+  // Without records the whole output remains
+  std::string preamble, remaining;
+  EXPECT_TRUE(split("Some error\nhappened\n", 3, &preamble, &remaining).empty());
+  EXPECT_EQ("", preamble);
+  EXPECT_EQ("Some error\nhappened\n", remaining);
+}
+
+#ifndef _WIN32
+TEST(Process_launcher_tests, read_line) {
+  const char *args[] = {"/bin/sh", "-c", "printf 'first\\nsecond\\n\\nlast'", NULL};
+  Process_launcher p(args[0], args);
+  p.start();
+
+  std::vector<std::string> lines;
+  std::string line;
+  while (p.read_line(&line))
+    lines.push_back(line);
+
+  std::vector<std::string> expected = {"first\n", "second\n", "\n", "last"};
+  EXPECT_EQ(expected, lines);
+  EXPECT_EQ(0, p.wait());
+}
+
+TEST(Process_launcher_tests, mixed_reads) {
+  const char *args[] = {"/bin/sh", "-c", "printf 'first line\\nsecond line\\n'", NULL};
+  Process_launcher p(args[0], args);
+  p.start();
+
+  // The buffered output is taken first by the other reads
+  std::string line;
+  ASSERT_TRUE(p.read_line(&line));
+  EXPECT_EQ("first line\n", line);
+
+  char buf[7];
+  ASSERT_EQ(6, p.read(buf, 6));
+  buf[6] = 0;
+  EXPECT_STREQ("second", buf);
+
+  std::string rest;
+  while (p.read_available(&rest) > 0) {
+  }
+  EXPECT_EQ(" line\n", rest);
+  EXPECT_EQ(0, p.wait());
+}
+
+TEST(Process_launcher_tests, finish) {
+  // cat ends once its input is closed
+  const char *cat_args[] = {"/bin/cat", NULL};
+  Process_launcher cat(cat_args[0], cat_args);
+  cat.start();
+
+  ASSERT_EQ(5, cat.write("text\n", 5));
+  std::string line;
+  ASSERT_TRUE(cat.read_line(&line));
+  EXPECT_EQ("text\n", line);
+  EXPECT_EQ(0, cat.finish());
+
+  // A process already reaped by wait() is not waited for again
+  const char *exit_args[] = {"/bin/sh", "-c", "exit 3", NULL};
+  Process_launcher exited(exit_args[0], exit_args);
+  exited.start();
+  EXPECT_EQ(3, exited.wait());
+  EXPECT_EQ(0, exited.finish());
+
+  // A writer blocked on a full output pipe is not waited for
+  const char *yes_args[] = {"/usr/bin/yes", NULL};
+  Process_launcher yes(yes_args[0], yes_args);
+  yes.start();
+  EXPECT_NE(0, yes.finish(10000));
+
+  // Neither is one ignoring its input, it is killed after the timeout
+  const char *sleep_args[] = {"/bin/sleep", "60", NULL};
+  Process_launcher sleeping(sleep_args[0], sleep_args);
+  sleeping.start();
+  EXPECT_EQ(128 + SIGKILL, sleeping.finish(100));
+}
+
+// The records are split as the output blocks come, whatever they hold
+TEST(Process_launcher_tests, json_output_blocks) {
+  const char *args[] = {"/bin/sh", "-c",
+                        "yes '{\"type\": \"DEBUG\", \"msg\": \"Checking the configuration of the instance\"}' 2>/dev/null | "
+                        "head -n 20000",
+                        NULL};
+  Process_launcher p(args[0], args);
+  p.start();
+
+  Json_record_splitter splitter;
+  std::string output, record;
+  size_t records = 0;
+  while (p.read_available(&output) > 0) {
+    splitter.append(output.data(), output.size());
+    output.clear();
+
+    while (splitter.next_record(&record)) {
+      EXPECT_EQ("{\"type\": \"DEBUG\", \"msg\": \"Checking the configuration of the instance\"}", record);
+      records++;
+    }
+  }
+  EXPECT_EQ(0, p.wait());
+
+  EXPECT_EQ(20000u, records);
+}
+#endif
+
+}  // namespace process_launcher_tests
+}  // namespace ngcommon
@@ -17,6 +17,9 @@ validateMember(members, 'resetSession');
 validateMember(members, 'startSandboxInstance');
 validateMember(members, 'checkInstanceConfiguration');
 validateMember(members, 'stopSandboxInstance');
+validateMember(members, 'deploySandboxInstances');
+validateMember(members, 'startSandboxInstances');
+validateMember(members, 'stopSandboxInstances');
 validateMember(members, 'configureLocalInstance');
 validateMember(members, 'verbose');
 validateMember(members, 'rebootClusterFromCompleteOutage');
@@ -17,6 +17,9 @@ validateMember(members, 'resetSession');
 validateMember(members, 'startSandboxInstance');
 validateMember(members, 'checkInstanceConfiguration');
 validateMember(members, 'stopSandboxInstance');
+validateMember(members, 'deploySandboxInstances');
+validateMember(members, 'startSandboxInstances');
+validateMember(members, 'stopSandboxInstances');
 validateMember(members, 'configureLocalInstance');
 validateMember(members, 'verbose');
 validateMember(members, 'rebootClusterFromCompleteOutage');
@@ -98,3 +101,15 @@ var c2 = dba.getCluster('devCluster');
 
 //@ Dba: getCluster
 print(c2);
+
+//@# Dba: deploySandboxInstances errors
+dba.deploySandboxInstances([]);
+dba.deploySandboxInstances([1000, 1000], {password: 'root'});
+dba.startSandboxInstances([1000], {maxThreads: 0});
+dba.deploySandboxInstances([1000], {password: 'root', portx: 50000});
+
+//@ Dba: stopSandboxInstances result of each port
+var result = dba.stopSandboxInstances([1000, 1001], {password: 'root'});
+println('Instances: ' + result.length);
+for (var index = 0; index < result.length; index++)
+  println(result[index].port + ' ' + result[index].status + ': ' + result[index].error);
@@ -18,6 +18,8 @@ The following functions are currently supported.
                                    localhost.
  - deploySandboxInstance           Creates a new MySQL Server instance on
                                    localhost.
+ - deploySandboxInstances          Creates new MySQL Server instances on
+                                   localhost, concurrently.
  - dropMetadataSchema              Drops the Metadata Schema.
  - getCluster                      Retrieves a cluster from the Metadata Store.
  - help                            Provides help about this class and it's
@@ -30,8 +32,12 @@ The following functions are currently supported.
                                    Dba operations.
  - startSandboxInstance            Starts an existing MySQL Server instance on
                                    localhost.
+ - startSandboxInstances           Starts existing MySQL Server instances on
+                                   localhost, concurrently.
  - stopSandboxInstance             Stops a running MySQL Server instance on
                                    localhost.
+ - stopSandboxInstances            Stops running MySQL Server instances on
+                                   localhost, concurrently.
 
 For more help on a specific function use: dba.help('<functionName>')
 
@@ -1,5 +1,5 @@
 //@ Session: validating members
-|Session Members: 14|
+|Session Members: 17|
 |createCluster: OK|
 |deleteSandboxInstance: OK|
 |deploySandboxInstance: OK|
@@ -10,6 +10,9 @@
 |startSandboxInstance: OK|
 |checkInstanceConfiguration: OK|
 |stopSandboxInstance: OK|
+|deploySandboxInstances: OK|
+|startSandboxInstances: OK|
+|stopSandboxInstances: OK|
 |dropMetadataSchema: OK|
 |configureLocalInstance: OK|
 |verbose: OK|
@@ -1,5 +1,5 @@
 //@ Session: validating members
-|Session Members: 14|
+|Session Members: 17|
 |createCluster: OK|
 |deleteSandboxInstance: OK|
 |deploySandboxInstance: OK|
@@ -10,6 +10,9 @@
 |startSandboxInstance: OK|
 |checkInstanceConfiguration: OK|
 |stopSandboxInstance: OK|
+|deploySandboxInstances: OK|
+|startSandboxInstances: OK|
+|stopSandboxInstances: OK|
 |dropMetadataSchema: OK|
 |configureLocalInstance: OK|
 |verbose: OK|
@@ -157,3 +160,14 @@
 
 //@ Dba: getCluster
 |<Cluster:devCluster>|
+
+//@# Dba: deploySandboxInstances errors
+||Dba.deploySandboxInstances: The list of ports can not be empty
+||Dba.deploySandboxInstances: Invalid value for the list of ports: 1000 is duplicated
+||Dba.startSandboxInstances: Invalid value for 'maxThreads': Please use a number greater than 0
+||Dba.deploySandboxInstances: Invalid values in the options: portx, it can not be shared by the instances
+
+//@ Dba: stopSandboxInstances result of each port
+|Instances: 2|
+|1000 error: Invalid value for 'port': Please use a valid TCP port number >= 1024 and <= 65535|
+|1001 error: Invalid value for 'port': Please use a valid TCP port number >= 1024 and <= 65535|
@@ -25,6 +25,9 @@ validateMember(members, 'reset_session');
 validateMember(members, 'start_sandbox_instance');
 validateMember(members, 'check_instance_configuration');
 validateMember(members, 'stop_sandbox_instance');
+validateMember(members, 'deploy_sandbox_instances');
+validateMember(members, 'start_sandbox_instances');
+validateMember(members, 'stop_sandbox_instances');
 validateMember(members, 'configure_local_instance');
 validateMember(members, 'verbose');
 validateMember(members, 'reboot_cluster_from_complete_outage');
@@ -24,6 +24,9 @@ validateMember(members, 'reset_session');
 validateMember(members, 'start_sandbox_instance');
 validateMember(members, 'check_instance_configuration');
 validateMember(members, 'stop_sandbox_instance');
+validateMember(members, 'deploy_sandbox_instances');
+validateMember(members, 'start_sandbox_instances');
+validateMember(members, 'stop_sandbox_instances');
 validateMember(members, 'configure_local_instance');
 validateMember(members, 'verbose');
 validateMember(members, 'reboot_cluster_from_complete_outage');
@@ -107,3 +110,15 @@ c2 = dba.get_cluster('devCluster');
 
 #@ Dba: get_cluster
 print c2
+
+#@# Dba: deploy_sandbox_instances errors
+dba.deploy_sandbox_instances([])
+dba.deploy_sandbox_instances([1000, 1000], {'password': 'root'})
+dba.start_sandbox_instances([1000], {'maxThreads': 0})
+dba.deploy_sandbox_instances([1000], {'password': 'root', 'portx': 50000})
+
+#@ Dba: stop_sandbox_instances result of each port
+result = dba.stop_sandbox_instances([1000, 1001], {'password': 'root'})
+print 'Instances:', len(result)
+for instance in result:
+  print '%s %s: %s' % (instance.port, instance.status, instance.error)
@@ -18,6 +18,8 @@ The following functions are currently supported.
                                        instance on localhost.
  - deploy_sandbox_instance             Creates a new MySQL Server instance on
                                        localhost.
+ - deploy_sandbox_instances            Creates new MySQL Server instances on
+                                       localhost, concurrently.
  - drop_metadata_schema                Drops the Metadata Schema.
  - get_cluster                         Retrieves a cluster from the Metadata
                                        Store.
@@ -31,8 +33,12 @@ The following functions are currently supported.
                                        the Dba operations.
  - start_sandbox_instance              Starts an existing MySQL Server instance
                                        on localhost.
+ - start_sandbox_instances             Starts existing MySQL Server instances
+                                       on localhost, concurrently.
  - stop_sandbox_instance               Stops a running MySQL Server instance on
                                        localhost.
+ - stop_sandbox_instances              Stops running MySQL Server instances on
+                                       localhost, concurrently.
 
 For more help on a specific function use: dba.help('<functionName>')
 
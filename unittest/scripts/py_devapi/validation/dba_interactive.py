@@ -1,5 +1,5 @@
 #@ Session: validating members
-|Session Members: 14|
+|Session Members: 17|
 |create_cluster: OK|
 |delete_sandbox_instance: OK|
 |deploy_sandbox_instance: OK|
@@ -10,6 +10,9 @@
 |start_sandbox_instance: OK|
 |check_instance_configuration: OK|
 |stop_sandbox_instance: OK|
+|deploy_sandbox_instances: OK|
+|start_sandbox_instances: OK|
+|stop_sandbox_instances: OK|
 |drop_metadata_schema: OK|
 |configure_local_instance: OK|
 |verbose: OK|
@@ -1,5 +1,5 @@
 #@ Session: validating members
-|Session Members: 14|
+|Session Members: 17|
 |create_cluster: OK|
 |delete_sandbox_instance: OK|
 |deploy_sandbox_instance: OK|
@@ -10,6 +10,9 @@
 |start_sandbox_instance: OK|
 |check_instance_configuration: OK|
 |stop_sandbox_instance: OK|
+|deploy_sandbox_instances: OK|
+|start_sandbox_instances: OK|
+|stop_sandbox_instances: OK|
 |drop_metadata_schema: OK|
 |configure_local_instance: OK|
 |verbose: OK|
@@ -157,3 +160,14 @@
 
 #@ Dba: get_cluster
 |<Cluster:devCluster>|
+
+#@# Dba: deploy_sandbox_instances errors
+||Dba.deploy_sandbox_instances: The list of ports can not be empty
+||Dba.deploy_sandbox_instances: Invalid value for the list of ports: 1000 is duplicated
+||Dba.start_sandbox_instances: Invalid value for 'maxThreads': Please use a number greater than 0
+||Dba.deploy_sandbox_instances: Invalid values in the options: portx, it can not be shared by the instances
+
+#@ Dba: stop_sandbox_instances result of each port
+|Instances: 2|
+|1000 error: Invalid value for 'port': Please use a valid TCP port number >= 1024 and <= 65535|
+|1001 error: Invalid value for 'port': Please use a valid TCP port number >= 1024 and <= 65535|
@@ -115,6 +115,8 @@ public:
       return session_type_name(options->session_type);
     else if (option == "force")
       return AS__STRING(options->force);
+    else if (option == "pipeline_size")
+      return AS__STRING(options->pipeline_size);
     else if (option == "interactive")
       return AS__STRING(options->interactive);
     else if (option == "full_interactive")
@@ -129,6 +131,8 @@ public:
       return AS__STRING(options->trace_protocol);
     else if (option == "log_level")
       return AS__STRING(options->log_level);
+    else if (option == "log_overflow")
+      return AS__STRING(options->log_overflow);
     else if (option == "initial-mode")
       return shell_mode_name(options->initial_mode);
     else if (option == "session-type")
@@ -420,6 +424,7 @@ TEST(Shell_cmdline_options, default_values) {
 
   EXPECT_FALSE(options.interactive);
   EXPECT_EQ(options.log_level, ngcommon::Logger::LOG_INFO);
+  EXPECT_EQ(options.log_overflow, ngcommon::Logger::OVERFLOW_BLOCK);
   EXPECT_TRUE(options.output_format.empty());
   EXPECT_EQ(NULL, options.password);
   EXPECT_FALSE(options.passwords_from_stdin);
@@ -505,6 +510,7 @@ TEST_F(Shell_cmdline_options_t, app) {
   test_option_with_no_value("-E", "output_format", "vertical");
   test_option_with_no_value("--trace-proto", "trace_protocol", "1");
   test_option_with_no_value("--force", "force", "1");
+  test_option_with_value("pipeline", "", "500", "100", !IS_CONNECTION_DATA, IS_NULLABLE, "pipeline_size");
   test_option_with_no_value("--interactive", "interactive", "1");
   test_option_with_no_value("-i", "interactive", "1");
   test_option_with_no_value("--no-wizard", "wizards", "0");
@@ -514,6 +520,9 @@ TEST_F(Shell_cmdline_options_t, app) {
   //test_option_with_value("interactive", "", "full", "1", !IS_CONNECTION_DATA, IS_NULLABLE, "full_interactive", "1");
 
   test_option_with_no_value("--passwords-from-stdin", "passwords_from_stdin", "1");
+
+  test_option_with_value("log-overflow", "", "drop", "", !IS_CONNECTION_DATA, !IS_NULLABLE, "log_overflow", "2");
+  test_option_with_value("log-overflow", "", "count", "", !IS_CONNECTION_DATA, !IS_NULLABLE, "log_overflow", "3");
 }
 
 TEST_F(Shell_cmdline_options_t, test_session_type_conflicts) {
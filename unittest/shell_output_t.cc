@@ -166,5 +166,59 @@ a: 13)";
   MY_EXPECT_STDOUT_CONTAINS(expected_output);
 }
 
+TEST_F(Shell_output_test, streamed_table_output) {
+  // Results bigger than the sample used to size the columns are streamed
+  std::string digits = "(select 0 as d union all select 1 union all select 2 union all select 3 union all "
+                       "select 4 union all select 5 union all select 6 union all select 7 union all "
+                       "select 8 union all select 9)";
+  std::stringstream stream("select a.d + b.d * 10 + c.d * 100 + d.d * 1000 as n from " +
+                           digits + " a, " + digits + " b, " + digits + " c, " + digits + " d;");
+  _ret_val = _interactive_shell->process_stream(stream, "STDIN", {});
+  EXPECT_EQ(0, _ret_val);
+
+  // The numbers past the sample are sized by their type, so none is cut
+  MY_EXPECT_STDOUT_CONTAINS(" 9999 |");
+  MY_EXPECT_STDOUT_CONTAINS("10000 rows in set");
+}
+
+TEST_F(Shell_output_test, streamed_table_wide_value) {
+  // The sample gives the width of the text column, the wider value after it
+  // is cut to that width
+  std::string digits = "(select 0 as d union all select 1 union all select 2 union all select 3 union all "
+                       "select 4 union all select 5 union all select 6 union all select 7 union all "
+                       "select 8 union all select 9)";
+  std::stringstream stream("select if(n = 1500, 'a value wider than its column', 'narrow') as value_column "
+                           "from (select a.d + b.d * 10 + c.d * 100 + d.d * 1000 as n from " +
+                           digits + " a, " + digits + " b, " + digits + " c, " + digits + " d) t order by n;");
+  _ret_val = _interactive_shell->process_stream(stream, "STDIN", {});
+  EXPECT_EQ(0, _ret_val);
+
+  MY_EXPECT_STDOUT_CONTAINS("| a value w... |");
+  MY_EXPECT_STDOUT_NOT_CONTAINS("wider than");
+  MY_EXPECT_STDOUT_CONTAINS("10000 rows in set");
+}
+
+TEST_F(Shell_output_test, output_streaming_option) {
+  _interactive_shell->process_line("\\js");
+  _interactive_shell->process_line("var result = session.runSql('select 11 as a');");
+
+  (*options)[SHCORE_OUTPUT_STREAMING] = Value::True();
+  _interactive_shell->process_line("result");
+  (*options)[SHCORE_OUTPUT_STREAMING] = Value::False();
+
+  std::string expected_output =
+R"(+----+
+| a  |
++----+
+| 11 |
++----+)";
+  MY_EXPECT_STDOUT_CONTAINS(expected_output);
+
+  // The streamed records are no longer available
+  wipe_all();
+  _interactive_shell->process_line("result.fetchOne()");
+  MY_EXPECT_STDOUT_CONTAINS("null");
+}
+
 } //namespace Shell_output_tests
 } //namespace shcore
@@ -17,6 +17,7 @@
 #include <cstdlib>
 #include <fstream>
 #include <string>
+#include <vector>
 #include <boost/pointer_cast.hpp>
 
 #include "gtest/gtest.h"
@@ -26,7 +27,9 @@
 
 #include "shellcore/shell_core.h"
 #include "shellcore/shell_sql.h"
+#include "shellcore/shell_core_options.h"
 #include "../modules/base_session.h"
+#include "../modules/base_resultset.h"
 //#include "../modules/mod_session.h"
 //#include "../modules/mod_schema.h"
 #include "shellcore/common.h"
@@ -76,12 +79,12 @@ protected:
     return _returned_value;
   }
 
-  void connect() {
+  void connect(mysqlsh::SessionType type = mysqlsh::SessionType::Classic) {
     const char *uri = getenv("MYSQL_URI");
     const char *pwd = getenv("MYSQL_PWD");
-    const char *port = getenv("MYSQL_PORT");
+    const char *port = getenv(type == mysqlsh::SessionType::Classic ? "MYSQL_PORT" : "MYSQLX_PORT");
 
-    std::string mysql_uri = "mysql://";
+    std::string mysql_uri = type == mysqlsh::SessionType::Classic ? "mysql://" : "mysqlx://";
     mysql_uri.append(uri);
     if (port) {
       mysql_uri.append(":");
@@ -93,7 +96,7 @@ protected:
     if (pwd)
       args.push_back(Value(pwd));
 
-    env.shell_core->connect_dev_session(args, mysqlsh::SessionType::Classic);
+    env.shell_core->connect_dev_session(args, type);
   }
 };
 
@@ -488,5 +491,93 @@ TEST_F(Shell_sql_test, continued_stmt_hash_comment_batch) {
   EXPECT_EQ("mysql-sql> ", env.shell_sql->prompt());
 }
 
+// In batch mode the statements on a Node session are pipelined
+class Shell_sql_pipeline_test : public Shell_sql_test {
+protected:
+  shcore::Value::Map_type _options;
+  std::vector<shcore::Value> _results;
+
+  virtual void SetUp() {
+    _options = *Shell_core_options::get();
+    (*Shell_core_options::get())[SHCORE_INTERACTIVE] = Value::False();
+    (*Shell_core_options::get())[SHCORE_BATCH_PIPELINE_SIZE] = Value(2);
+
+    connect(mysqlsh::SessionType::Node);
+  }
+
+  virtual void TearDown() {
+    Shell_sql_test::TearDown();
+    *Shell_core_options::get() = _options;
+  }
+
+  void collect_result(shcore::Value result) {
+    _results.push_back(result);
+  }
+
+  void run_batch(const std::string &batch) {
+    Input_state state;
+    std::string query(batch);
+    auto processor = std::bind(&Shell_sql_pipeline_test::collect_result, this, _1);
+    env.shell_sql->handle_input(query, state, processor);
+    env.shell_sql->finish_input(processor);
+  }
+
+  // The first column of the first row on the result, -1 if it failed
+  int64_t first_value(shcore::Value result) {
+    if (result.type != shcore::Object)
+      return -1;
+
+    auto row = result.as_object()->call("fetchOne", shcore::Argument_list());
+    return row.as_object<mysqlsh::Row>()->get_member(0).as_int();
+  }
+};
+
+TEST_F(Shell_sql_pipeline_test, result_order) {
+  // The large statement does not fit the window with the others in flight
+  std::string large = "select length('" + std::string(20000, 'x') + "') as a";
+  run_batch("select 1 as a;select 2 as a;" + large + ";select 3 as a;");
+
+  ASSERT_EQ(4U, _results.size());
+  EXPECT_EQ(1, first_value(_results[0]));
+  EXPECT_EQ(2, first_value(_results[1]));
+  EXPECT_EQ(20000, first_value(_results[2]));
+  EXPECT_EQ(3, first_value(_results[3]));
+  EXPECT_EQ("", env.output_handler.std_err);
+}
+
+TEST_F(Shell_sql_pipeline_test, error_skips_the_rest) {
+  run_batch("select 1 as a;select * from unexisting.table;select 3 as a;select 4 as a;");
+
+  // The statements after the failure are not executed
+  ASSERT_EQ(2U, _results.size());
+  EXPECT_EQ(1, first_value(_results[0]));
+  EXPECT_EQ(-1, first_value(_results[1]));
+  EXPECT_NE(std::string::npos,
+            env.output_handler.std_err.find("(statement #2: select * from unexisting.table)"));
+
+  // A new batch starts a new pipeline
+  _results.clear();
+  env.output_handler.wipe_err();
+  run_batch("select 5 as a;");
+  ASSERT_EQ(1U, _results.size());
+  EXPECT_EQ(5, first_value(_results[0]));
+  EXPECT_EQ("", env.output_handler.std_err);
+}
+
+TEST_F(Shell_sql_pipeline_test, error_with_force) {
+  (*Shell_core_options::get())[SHCORE_BATCH_CONTINUE_ON_ERROR] = Value::True();
+  run_batch("select 1 as a;select * from unexisting.table;select 3 as a;select * from unexisting.other;select 5 as a;");
+
+  ASSERT_EQ(5U, _results.size());
+  EXPECT_EQ(1, first_value(_results[0]));
+  EXPECT_EQ(-1, first_value(_results[1]));
+  EXPECT_EQ(3, first_value(_results[2]));
+  EXPECT_EQ(-1, first_value(_results[3]));
+  EXPECT_EQ(5, first_value(_results[4]));
+  EXPECT_NE(std::string::npos,
+            env.output_handler.std_err.find("(statement #2: select * from unexisting.table)"));
+  EXPECT_NE(std::string::npos,
+            env.output_handler.std_err.find("(statement #4: select * from unexisting.other)"));
+}
 }
 }
@@ -13,10 +13,13 @@
  along with this program; if not, write to the Free Software
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
 
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
+#include <iostream>
 #include <string>
+#include <vector>
 #include <boost/lexical_cast.hpp>
 
 #include "gtest/gtest.h"
@@ -151,6 +154,124 @@ TEST(Functions, function_wrappers) {
       }
 }
 
+// The members added to an object are found by their name on each style
+TEST(Functions, members_by_style) {
+  class Test_object : public Cpp_object_bridge {
+  public:
+    Test_object() {
+      add_property("columnCount", "getColumnCount");
+      add_constant("MAX_SIZE");
+      add_method("getName|get_the_name", std::bind(&Test_object::name, this, "first", std::placeholders::_1), NULL);
+    }
+
+    virtual std::string class_name() const { return "Test"; }
+    virtual bool operator == (const Object_bridge &other) const { return this == &other; }
+    virtual Value get_member(const std::string &prop) const {
+      if (prop == "columnCount")
+        return Value(3);
+      return Cpp_object_bridge::get_member(prop);
+    }
+
+    Value name(const std::string &value, const Argument_list &) { return Value(value); }
+
+    void replace_name() {
+      add_method("getName|get_other_name", std::bind(&Test_object::name, this, "second", std::placeholders::_1), NULL);
+    }
+
+    void set_column_count(bool add) {
+      if (add)
+        add_property("columnCount", "getColumnCount");
+      else
+        delete_property("columnCount", "getColumnCount");
+    }
+  };
+
+  Test_object object;
+  EXPECT_TRUE(object.has_member("columnCount"));
+  EXPECT_TRUE(object.has_member_advanced("column_count", LowerCaseUnderscores));
+  EXPECT_FALSE(object.has_member_advanced("column_count", LowerCamelCase));
+  EXPECT_TRUE(object.has_member_advanced("MAX_SIZE", LowerCamelCase));
+  EXPECT_TRUE(object.has_member_advanced("MAX_SIZE", LowerCaseUnderscores));
+  EXPECT_EQ(3, object.get_member_advanced("column_count", LowerCaseUnderscores).as_int());
+  EXPECT_EQ(3, object.call_advanced("get_column_count", Argument_list(), LowerCaseUnderscores).as_int());
+
+  EXPECT_TRUE(object.has_method_advanced("get_the_name", LowerCaseUnderscores));
+  EXPECT_EQ("first", object.call_advanced("get_the_name", Argument_list(), LowerCaseUnderscores).as_string());
+
+  // A method added again replaces the names of the previous one
+  object.replace_name();
+  EXPECT_FALSE(object.has_method_advanced("get_the_name", LowerCaseUnderscores));
+  EXPECT_EQ("second", object.call_advanced("get_other_name", Argument_list(), LowerCaseUnderscores).as_string());
+  EXPECT_EQ("second", object.call_advanced("getName", Argument_list(), LowerCamelCase).as_string());
+
+  // With the same property added twice the other one remains after deleting one
+  object.set_column_count(true);
+  object.set_column_count(false);
+  EXPECT_TRUE(object.has_member_advanced("column_count", LowerCaseUnderscores));
+  object.set_column_count(false);
+  EXPECT_FALSE(object.has_member_advanced("column_count", LowerCaseUnderscores));
+  EXPECT_FALSE(object.has_member("getColumnCount"));
+  EXPECT_THROW(object.get_member_advanced("column_count", LowerCaseUnderscores), Exception);
+}
+
+TEST(ValueTests, Move) {
+  shcore::Value s("a string long enough to not fit on the inline buffer");
+  shcore::Value moved(std::move(s));
+  EXPECT_EQ(shcore::Undefined, s.type);
+  EXPECT_EQ("a string long enough to not fit on the inline buffer", moved.as_string());
+
+  shcore::Value::Map_type_ref map(new shcore::Value::Map_type());
+  (*map)["inner"] = shcore::Value::new_array();
+  shcore::Value m(map);
+  EXPECT_EQ(2, map.use_count());
+
+  shcore::Value target(1);
+  target = std::move(m);
+  EXPECT_EQ(shcore::Undefined, m.type);
+  EXPECT_EQ(shcore::Map, target.type);
+  EXPECT_EQ(2, map.use_count());
+
+  // Assigning a value owned by the target itself
+  target = (*target.as_map())["inner"];
+  EXPECT_EQ(shcore::Array, target.type);
+
+  target = std::move(target);
+  EXPECT_EQ(shcore::Array, target.type);
+
+  shcore::Value copy(target);
+  EXPECT_EQ(copy, target);
+  EXPECT_EQ(copy.as_array().get(), target.as_array().get());
+}
+
+// Copying values into containers and moving them, as done when results and
+// argument lists are built
+TEST(ValueTests, CopyMoveIntoContainers) {
+  const int count = 1000;
+  std::vector<shcore::Value> source;
+  source.reserve(count);
+  for (int index = 0; index < count; index++)
+    source.push_back(shcore::Value("value " + std::to_string(index % 100)));
+
+  shcore::Value::Array_type_ref copied(new shcore::Value::Array_type());
+  for (const auto &value : source)
+    copied->push_back(value);
+  EXPECT_EQ("value 99", source.back().as_string());
+
+  shcore::Value::Array_type_ref moved(new shcore::Value::Array_type());
+  for (auto &value : source)
+    moved->push_back(std::move(value));
+
+  shcore::Argument_list args;
+  for (int index = 0; index < count; index++)
+    args.push_back(index % 2 ? shcore::Value(index) : shcore::Value::new_map());
+
+  EXPECT_EQ(*copied, *moved);
+  EXPECT_EQ(shcore::Undefined, source.back().type);
+  EXPECT_EQ(count, static_cast<int>(args.size()));
+  EXPECT_EQ(shcore::Map, args[0].type);
+  EXPECT_EQ(count - 1, args[count - 1].as_int());
+}
+
 TEST(Parsing, Integer) {
   const std::string data = "1984";
   shcore::Value v = shcore::Value::parse(data);
@@ -348,6 +469,97 @@ TEST(Parsing, Array) {
   EXPECT_EQ(array2->size(), 0);
 }
 
+// A document as those returned by collection.find(), of about 2 KB
+static std::string sample_document(int id, char quote) {
+  std::string q(1, quote);
+  std::string doc = "{" + q + "_id" + q + ": " + q + "4C514FF38144B714E7119BCF48B4" + std::to_string(1000 + id) + q +
+                    ", " + q + "name" + q + ": " + q + "Customer " + std::to_string(id) + q +
+                    ", " + q + "age" + q + ": " + std::to_string(20 + id % 50) +
+                    ", " + q + "balance" + q + ": " + std::to_string(id) + ".25" +
+                    ", " + q + "active" + q + ": " + (id % 2 ? "true" : "false") +
+                    ", " + q + "manager" + q + ": null" +
+                    ", " + q + "address" + q + ": {" + q + "street" + q + ": " + q + "Main Street " + std::to_string(id) + q +
+                    ", " + q + "city" + q + ": " + q + "Springfield" + q + ", " + q + "zip" + q + ": 12345}" +
+                    ", " + q + "tags" + q + ": [" + q + "retail" + q + ", " + q + "priority" + q + ", " + q + "north" + q + "]" +
+                    ", " + q + "orders" + q + ": [";
+  for (int order = 0; order < 20; order++) {
+    if (order)
+      doc.append(", ");
+    doc.append("{" + q + "number" + q + ": " + std::to_string(id * 100 + order) +
+               ", " + q + "date" + q + ": " + q + "2017-03-" + std::to_string(10 + order) + q +
+               ", " + q + "total" + q + ": " + std::to_string(order * 17) + ".5" +
+               ", " + q + "items" + q + ": [" + std::to_string(order) + ", " + std::to_string(order + 1) + "]" +
+               ", " + q + "shipped" + q + ": " + (order % 3 ? "true" : "false") + "}");
+  }
+  doc.append("]}");
+  return doc;
+}
+
+TEST(Parsing, JsonDocument) {
+  // Standard JSON and the single quoted version taken by the legacy parser
+  // give the same value
+  shcore::Value v = shcore::Value::parse(sample_document(7, '"'));
+  EXPECT_EQ(v, shcore::Value::parse(sample_document(7, '\'')));
+  EXPECT_EQ(v, shcore::Value::parse(v.repr()));
+  EXPECT_EQ(v, shcore::Value::parse(v.json(true)));
+
+  Value::Map_type_ref map = v.as_map();
+  EXPECT_EQ(shcore::Null, (*map)["manager"].type);
+  EXPECT_EQ(shcore::Integer, (*map)["age"].type);
+  EXPECT_EQ(shcore::Float, (*map)["balance"].type);
+  EXPECT_EQ(20u, (*map)["orders"].as_array()->size());
+  EXPECT_EQ(12345, (*(*map)["address"].as_map())["zip"].as_int());
+
+  // Only the given length is parsed
+  const char *data = "123456";
+  EXPECT_EQ(shcore::Value(123), shcore::Value::parse(data, 3));
+  EXPECT_EQ(shcore::Value(123), shcore::Value::parse(std::string("123 456")));
+
+  // The last duplicate key wins
+  EXPECT_EQ(2, shcore::Value::parse("{\"a\": 1, \"a\": 2}").as_map()->get_int("a"));
+
+  EXPECT_EQ("\xC3\xB1\n/", shcore::Value::parse("\"\\u00f1\\n\\/\"").as_string());
+  EXPECT_EQ(shcore::UInteger, shcore::Value::parse("18446744073709551615").type);
+  EXPECT_EQ(shcore::Integer, shcore::Value::parse("-9223372036854775808").type);
+
+  EXPECT_THROW(shcore::Value::parse("{\"a\": }"), shcore::Exception);
+  EXPECT_THROW(shcore::Value::parse("[1, 2"), shcore::Exception);
+}
+
+// Documents/sec parsing documents of about 2 KB, standard JSON against the
+// single quoted version, which is only handled by the legacy parser. Only
+// prints the rates, run it with --gtest_also_run_disabled_tests
+TEST(Parsing, DISABLED_DocumentPerformance) {
+  const int count = 20000;
+  std::vector<std::string> json;
+  std::vector<std::string> legacy;
+  size_t bytes = 0;
+  for (int index = 0; index < 100; index++) {
+    json.push_back(sample_document(index, '"'));
+    legacy.push_back(sample_document(index, '\''));
+    bytes += json.back().size();
+  }
+
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for (int index = 0; index < count; index++)
+    EXPECT_EQ(shcore::Map, shcore::Value::parse(legacy[index % legacy.size()]).type);
+  double legacy_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+  start = std::chrono::high_resolution_clock::now();
+  for (int index = 0; index < count; index++) {
+    const std::string &doc = json[index % json.size()];
+    EXPECT_EQ(shcore::Map, shcore::Value::parse(doc.data(), doc.size()).type);
+  }
+  double json_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+  double megabytes = static_cast<double>(bytes) / json.size() * count / (1024 * 1024);
+  std::cout << "documents of " << bytes / json.size() << " bytes" << std::endl;
+  std::cout << "legacy parser: " << static_cast<uint64_t>(count / legacy_seconds) << " documents/sec, "
+            << megabytes / legacy_seconds << " MB/sec" << std::endl;
+  std::cout << "json parser: " << static_cast<uint64_t>(count / json_seconds) << " documents/sec, "
+            << megabytes / json_seconds << " MB/sec" << std::endl;
+}
+
 TEST(Argument_map, all) {
   {
     Argument_map args;
@@ -17,9 +17,12 @@
 * 02110-1301  USA
 */
 
+#include <clocale>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <string>
 #include <stack>
 
@@ -116,4 +119,66 @@ TEST(utils_general, make_account) {
     EXPECT_EQ(t.account, make_account(t.user, t.host));
   }
 }
+
+TEST(utils_general, parse_numbers) {
+  struct Case {
+    const char *text;
+    bool valid;
+    int64_t value;
+  };
+  static std::vector<Case> int_cases{
+    {"0", true, 0},
+    {"42", true, 42},
+    {"+42", true, 42},
+    {"-42", true, -42},
+    {"9223372036854775807", true, std::numeric_limits<int64_t>::max()},
+    {"-9223372036854775808", true, std::numeric_limits<int64_t>::min()},
+    {"9223372036854775808", false, 0},
+    {"-9223372036854775809", false, 0},
+    {"", false, 0},
+    {"-", false, 0},
+    {"-+1", false, 0},
+    {"12a", false, 0},
+    {" 12", false, 0}
+  };
+  for (auto &t : int_cases) {
+    SCOPED_TRACE(t.text);
+    int64_t value = 0;
+    EXPECT_EQ(t.valid, parse_int64(t.text, strlen(t.text), &value));
+    if (t.valid) {
+      EXPECT_EQ(t.value, value);
+    }
+  }
+
+  uint64_t unsigned_value = 0;
+  EXPECT_TRUE(parse_uint64("18446744073709551615", 20, &unsigned_value));
+  EXPECT_EQ(std::numeric_limits<uint64_t>::max(), unsigned_value);
+  EXPECT_FALSE(parse_uint64("18446744073709551616", 20, &unsigned_value));
+  EXPECT_FALSE(parse_uint64("-1", 2, &unsigned_value));
+
+  // Only the given length is parsed
+  int64_t value = 0;
+  EXPECT_TRUE(parse_int64("1234", 2, &value));
+  EXPECT_EQ(12, value);
+
+  double double_value = 0;
+  EXPECT_TRUE(parse_double("-1.5e3", 6, &double_value));
+  EXPECT_EQ(-1500.0, double_value);
+  EXPECT_TRUE(parse_double("0.1", 3, &double_value));
+  EXPECT_EQ(0.1, double_value);
+  EXPECT_TRUE(parse_double("2.52", 3, &double_value));
+  EXPECT_EQ(2.5, double_value);
+  EXPECT_FALSE(parse_double("1.5x", 4, &double_value));
+  EXPECT_FALSE(parse_double("1e999", 5, &double_value));
+  EXPECT_FALSE(parse_double("", 0, &double_value));
+
+  // The locale set by the application does not change the decimal point
+  std::string numeric_locale = setlocale(LC_NUMERIC, NULL);
+  if (setlocale(LC_NUMERIC, "de_DE.UTF-8") || setlocale(LC_NUMERIC, "de_DE")) {
+    EXPECT_TRUE(parse_double("0.5", 3, &double_value));
+    EXPECT_EQ(0.5, double_value);
+    EXPECT_FALSE(parse_double("0,5", 3, &double_value));
+    setlocale(LC_NUMERIC, numeric_locale.c_str());
+  }
+}
 }
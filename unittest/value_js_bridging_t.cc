@@ -13,10 +13,13 @@
  along with this program; if not, write to the Free Software
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
 
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
+#include <iostream>
 #include <string>
+#include <vector>
 #include <boost/format.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
@@ -27,6 +30,7 @@
 #include "shellcore/types_cpp.h"
 #include "shellcore/object_registry.h"
 #include "shellcore/jscript_context.h"
+#include "shellcore/obj_date.h"
 #include "test_utils.h"
 #include "shellcore/common.h"
 #include "modules/mod_sys.h"
@@ -439,5 +443,66 @@ TEST_F(JavaScript, js_date_object) {
   ASSERT_TRUE(object.as_object()->class_name() == "Date");
   ASSERT_EQ("\"2014-01-01 0:00:00\"", object.repr());
 }
+
+TEST_F(JavaScript, date_to_js_and_back) {
+  v8::Isolate::Scope isolate_scope(env.js->isolate());
+  v8::HandleScope handle_scope(env.js->isolate());
+  v8::TryCatch try_catch;
+  v8::Context::Scope context_scope(v8::Local<v8::Context>::New(env.js->isolate(),
+                                                               env.js->context()));
+
+  std::vector<shcore::Value> dates = {
+    shcore::Value(Object_bridge_ref(new Date(2014, 0, 1, 0, 0, 0))),
+    shcore::Value(Object_bridge_ref(new Date(2017, 11, 31, 23, 59, 59.5f))),
+    shcore::Value(Object_bridge_ref(new Date(1969, 6, 20, 20, 17, 40)))
+  };
+
+  for (auto &date : dates) {
+    v8::Handle<v8::Value> js_date = env.js->shcore_value_to_v8_value(date);
+    ASSERT_TRUE(js_date->IsDate());
+    EXPECT_EQ(date.repr(), env.js->v8_value_to_shcore_value(js_date).repr());
+  }
+
+  // Months are 0 based on both sides
+  env.js->set_global("date", dates[0]);
+  EXPECT_EQ("2014-0-1", env.js->execute("date.getFullYear() + '-' + date.getMonth() + '-' + date.getDate()").as_string());
+
+  ASSERT_EQ("\"2017-12-31 23:59:59.500\"", env.js->execute("new Date(2017, 11, 31, 23, 59, 59, 500)").repr());
+}
+
+// Dates/sec converted each way, only prints the rates: run it with
+// --gtest_also_run_disabled_tests
+TEST_F(JavaScript, DISABLED_date_conversion_performance) {
+  v8::Isolate::Scope isolate_scope(env.js->isolate());
+  v8::HandleScope handle_scope(env.js->isolate());
+  v8::TryCatch try_catch;
+  v8::Context::Scope context_scope(v8::Local<v8::Context>::New(env.js->isolate(),
+                                                               env.js->context()));
+
+  const int count = 1000000;
+  const int batch = 1000;
+  shcore::Value date(Object_bridge_ref(new Date(2017, 4, 17, 10, 30, 15)));
+  double to_js_seconds = 0;
+  double to_native_seconds = 0;
+
+  for (int index = 0; index < count; index += batch) {
+    v8::HandleScope batch_scope(env.js->isolate());
+    std::vector<v8::Handle<v8::Value> > js_dates(batch);
+
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    for (int item = 0; item < batch; item++)
+      js_dates[item] = env.js->shcore_value_to_v8_value(date);
+    std::chrono::high_resolution_clock::time_point middle = std::chrono::high_resolution_clock::now();
+    for (int item = 0; item < batch; item++)
+      ASSERT_EQ(Object, env.js->v8_value_to_shcore_value(js_dates[item]).type);
+    std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+    to_js_seconds += std::chrono::duration<double>(middle - start).count();
+    to_native_seconds += std::chrono::duration<double>(end - middle).count();
+  }
+
+  std::cout << "to JS: " << static_cast<uint64_t>(count / to_js_seconds) << " dates/sec" << std::endl;
+  std::cout << "to native: " << static_cast<uint64_t>(count / to_native_seconds) << " dates/sec" << std::endl;
+}
 }
 }
@@ -32,9 +32,18 @@
 #include <ifaddrs.h>
 #include <net/if.h>
 #include <netdb.h>
+#include <locale.h>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
 #endif
 #include "utils_connection.h"
 #include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 
 #include <boost/format.hpp>
 
@@ -839,6 +848,88 @@ std::string replace_text(const std::string& source, const std::string& from, con
   return ret_val;
 }
 
+bool parse_uint64(const char *data, size_t length, uint64_t *out_value) {
+  const char *end = data + length;
+  if (data < end && *data == '+')
+    data++;
+
+  if (data == end)
+    return false;
+
+  uint64_t value = 0;
+  for (; data < end; data++) {
+    if (*data < '0' || *data > '9')
+      return false;
+
+    uint64_t digit = *data - '0';
+    if (value > (std::numeric_limits<uint64_t>::max() - digit) / 10)
+      return false;
+
+    value = value * 10 + digit;
+  }
+
+  *out_value = value;
+  return true;
+}
+
+bool parse_int64(const char *data, size_t length, int64_t *out_value) {
+  bool negative = length > 0 && *data == '-';
+  uint64_t value;
+
+  if (negative) {
+    if (length == 1 || data[1] == '+' || !parse_uint64(data + 1, length - 1, &value))
+      return false;
+  } else if (!parse_uint64(data, length, &value)) {
+    return false;
+  }
+
+  // The magnitude of INT64_MIN is one more than INT64_MAX
+  uint64_t limit = static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + (negative ? 1 : 0);
+  if (value > limit)
+    return false;
+
+  *out_value = negative ? static_cast<int64_t>(0 - value) : static_cast<int64_t>(value);
+  return true;
+}
+
+#ifdef WIN32
+typedef _locale_t c_locale_t;
+#define strtod_l _strtod_l
+#else
+typedef locale_t c_locale_t;
+#endif
+
+// The numbers are always written with a dot, whatever the locale the
+// application set
+static c_locale_t c_numeric_locale() {
+#ifdef WIN32
+  static c_locale_t locale = _create_locale(LC_NUMERIC, "C");
+#else
+  static c_locale_t locale = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
+#endif
+  return locale;
+}
+
+bool parse_double(const char *data, size_t length, double *out_value) {
+  // strtod needs a terminated string, numbers are short enough to be copied
+  // on the stack
+  char buffer[64];
+  if (length == 0 || length >= sizeof(buffer) || isspace(static_cast<unsigned char>(*data)))
+    return false;
+
+  memcpy(buffer, data, length);
+  buffer[length] = '\0';
+
+  char *end;
+  errno = 0;
+  double value = strtod_l(buffer, &end, c_numeric_locale());
+  if (end != buffer + length || (errno == ERANGE && std::fabs(value) == HUGE_VAL))
+    return false;
+
+  *out_value = value;
+  return true;
+}
+
 std::string get_my_hostname() {
   char hostname[1024]  {'\0'};
 
@@ -71,6 +71,12 @@ std::string SHCORE_PUBLIC get_member_name(const std::string& name, shcore::Namin
 std::string SHCORE_PUBLIC format_text(const std::vector<std::string>& lines, size_t width, size_t left_padding, bool paragraph_per_line);
 std::string SHCORE_PUBLIC format_markup_text(const std::vector<std::string>& lines, size_t width, size_t left_padding);
 std::string SHCORE_PUBLIC replace_text(const std::string& source, const std::string& from, const std::string& to);
+
+// Non throwing conversions of the text on a buffer which don't allocate, they
+// return false if it is not entirely a number or the number is out of range
+bool SHCORE_PUBLIC parse_int64(const char *data, size_t length, int64_t *out_value);
+bool SHCORE_PUBLIC parse_uint64(const char *data, size_t length, uint64_t *out_value);
+bool SHCORE_PUBLIC parse_double(const char *data, size_t length, double *out_value);
 std::string get_my_hostname();
 bool is_local_host(const std::string &host, bool check_hostname);
 }